@@ -50,7 +50,8 @@ int main(void)
     // Load animation data
     int animsCount = 0;
     ModelAnimation *anims = LoadModelAnimations("resources/models/iqm/guyanim.iqm", &animsCount);
-    int animFrameCounter = 0;
+    Transform *animPose = (Transform *)MemAlloc(model.boneCount*sizeof(Transform));  // Animation bones pose (model space)
+    float animTime = 0.0f;
 
     DisableCursor();                    // Catch cursor
     SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
@@ -66,10 +67,11 @@ int main(void)
         // Play animation when spacebar is held down
         if (IsKeyDown(KEY_SPACE))
         {
-            animFrameCounter++;
-            UpdateModelAnimation(model, anims[0], animFrameCounter);
-            if (animFrameCounter >= anims[0].frameCount) animFrameCounter = 0;
+            animTime += GetFrameTime();
+            UpdateModelAnimationTime(model, anims[0], animTime);
         }
+
+        GetModelAnimationPose(anims[0], animTime, animPose);
         //----------------------------------------------------------------------------------
 
         // Draw
@@ -84,7 +86,7 @@ int main(void)
 
                 for (int i = 0; i < model.boneCount; i++)
                 {
-                    DrawCube(anims[0].framePoses[animFrameCounter][i].translation, 0.2f, 0.2f, 0.2f, RED);
+                    DrawCube(animPose[i].translation, 0.2f, 0.2f, 0.2f, RED);
                 }
 
                 DrawGrid(10, 1.0f);         // Draw a grid
@@ -102,6 +104,7 @@ int main(void)
     //--------------------------------------------------------------------------------------
     UnloadTexture(texture);                     // Unload texture
     UnloadModelAnimations(anims, animsCount);   // Unload model animations data
+    MemFree(animPose);                          // Unload animation pose
     UnloadModel(model);                         // Unload model
 
     CloseWindow();                  // Close window and OpenGL context
@@ -55,8 +55,9 @@ int main(void)
     // Load gltf model animations
     int animsCount = 0;
     unsigned int animIndex = 0;
-    unsigned int animCurrentFrame = 0;
+    float animTime = 0.0f;
     ModelAnimation *modelAnimations = LoadModelAnimations("resources/models/gltf/greenman.glb", &animsCount);
+    Transform *animPose = (Transform *)MemAlloc(characterModel.boneCount*sizeof(Transform));    // Animation bones pose (model space)
 
     // indices of bones for sockets
     int boneSocketIndex[BONE_SOCKETS] = { -1, -1, -1 };
@@ -113,8 +114,9 @@ int main(void)
         
         // Update model animation
         ModelAnimation anim = modelAnimations[animIndex];
-        animCurrentFrame = (animCurrentFrame + 1)%anim.frameCount;
-        UpdateModelAnimation(characterModel, anim, animCurrentFrame);
+        animTime += GetFrameTime();
+        UpdateModelAnimationTime(characterModel, anim, animTime);
+        GetModelAnimationPose(anim, animTime, animPose);
         //----------------------------------------------------------------------------------
 
         // Draw
@@ -127,7 +129,6 @@ int main(void)
                 // Draw character
                 Quaternion characterRotate = QuaternionFromAxisAngle((Vector3){ 0.0f, 1.0f, 0.0f }, angle*DEG2RAD);
                 characterModel.transform = MatrixMultiply(QuaternionToMatrix(characterRotate), MatrixTranslate(position.x, position.y, position.z));
-                UpdateModelAnimation(characterModel, anim, animCurrentFrame);
                 DrawMesh(characterModel.meshes[0], characterModel.materials[1], characterModel.transform);
 
                 // Draw equipments (hat, sword, shield)
@@ -135,7 +136,7 @@ int main(void)
                 {
                     if (!showEquip[i]) continue;
 
-                    Transform *transform = &anim.framePoses[animCurrentFrame][boneSocketIndex[i]];
+                    Transform *transform = &animPose[boneSocketIndex[i]];
                     Quaternion inRotation = characterModel.bindPose[boneSocketIndex[i]].rotation;
                     Quaternion outRotation = transform->rotation;
                     
@@ -165,6 +166,7 @@ int main(void)
     // De-Initialization
     //--------------------------------------------------------------------------------------
     UnloadModelAnimations(modelAnimations, animsCount);
+    MemFree(animPose);
     UnloadModel(characterModel);         // Unload character model and meshes/material
     
     // Unload equipment model and meshes/material
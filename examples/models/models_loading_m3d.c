@@ -51,8 +51,10 @@ int main(void)
 
     // Load animations
     int animsCount = 0;
-    int animFrameCounter = 0, animId = 0;
+    int animId = 0;
+    float animTime = 0.0f;
     ModelAnimation *anims = LoadModelAnimations(modelFileName, &animsCount); // Load skeletal animation data
+    Transform *animPose = (Transform *)MemAlloc(model.boneCount*sizeof(Transform));    // Animation bones pose (model space)
 
     DisableCursor();                    // Limit cursor to relative movement inside the window
 
@@ -71,22 +73,22 @@ int main(void)
             // Play animation when spacebar is held down (or step one frame with N)
             if (IsKeyDown(KEY_SPACE) || IsKeyPressed(KEY_N))
             {
-                animFrameCounter++;
+                animTime += IsKeyDown(KEY_SPACE)? GetFrameTime() : 1.0f/60.0f;
 
-                if (animFrameCounter >= anims[animId].frameCount) animFrameCounter = 0;
-
-                UpdateModelAnimation(model, anims[animId], animFrameCounter);
+                UpdateModelAnimationTime(model, anims[animId], animTime);
+                GetModelAnimationPose(anims[animId], animTime, animPose);
                 animPlaying = true;
             }
 
             // Select animation by pressing C
             if (IsKeyPressed(KEY_C))
             {
-                animFrameCounter = 0;
+                animTime = 0.0f;
                 animId++;
 
                 if (animId >= (int)animsCount) animId = 0;
-                UpdateModelAnimation(model, anims[animId], 0);
+                UpdateModelAnimationTime(model, anims[animId], 0.0f);
+                GetModelAnimationPose(anims[animId], 0.0f, animPose);
                 animPlaying = true;
             }
         }
@@ -134,12 +136,11 @@ int main(void)
                         else
                         {
                             // Display the frame-pose skeleton
-                            DrawCube(anims[animId].framePoses[animFrameCounter][i].translation, 0.05f, 0.05f, 0.05f, RED);
+                            DrawCube(animPose[i].translation, 0.05f, 0.05f, 0.05f, RED);
 
                             if (anims[animId].bones[i].parent >= 0)
                             {
-                                DrawLine3D(anims[animId].framePoses[animFrameCounter][i].translation,
-                                    anims[animId].framePoses[animFrameCounter][anims[animId].bones[i].parent].translation, RED);
+                                DrawLine3D(animPose[i].translation, animPose[anims[animId].bones[i].parent].translation, RED);
                             }
                         }
                     }
@@ -164,6 +165,7 @@ int main(void)
 
     // Unload model animations data
     UnloadModelAnimations(anims, animsCount);
+    MemFree(animPose);
 
     UnloadModel(model);         // Unload model
 
@@ -90,6 +90,10 @@
 
 #define MAX_AUTOMATION_EVENTS       16384       // Maximum number of automation events to record
 
+#define MAX_SCREENSHOT_JOBS             4       // Maximum number of screenshots saved at the same time (on loader threads)
+// NOTE: ".qoi" requires SUPPORT_FILEFORMAT_QOI, it encodes much faster than PNG
+#define SCREENSHOT_FILE_EXTENSION   ".png"      // Automatic screenshots (F12) file extension
+
 //------------------------------------------------------------------------------------
 // Module: rlgl - Configuration values
 //------------------------------------------------------------------------------------
@@ -149,7 +153,12 @@
 
 // rshapes: Configuration values
 //------------------------------------------------------------------------------------
-#define SPLINE_SEGMENT_DIVISIONS       24       // Spline segments subdivisions
+#define SPLINE_SEGMENT_DIVISIONS       24       // Spline segments subdivisions (fixed, used with no flattening tolerance)
+#define SPLINE_FLATTEN_TOLERANCE     0.25f      // Spline flattening tolerance in pixels, segment divisions adapted to curvature and scale
+#define SPLINE_SEGMENT_MAX_DIVISIONS  256       // Spline segments maximum adaptive subdivisions
+#define SHAPES_TRIG_CACHE_SIZE         16       // Unit circle tables cached by segment count, shared by circular shapes
+#define LINES_GPU_MIN_POINTS          128       // Minimum line strip points to be expanded on GPU (shorter strips are batched)
+#define LINES_MITER_LIMIT             4.0f      // Line miter joins limit (miter length/thickness), bevel join used over it
 
 
 //------------------------------------------------------------------------------------
@@ -179,7 +188,17 @@
 // Support multiple image editing functions to scale, adjust colors, flip, draw on images, crop...
 // If not defined, still some functions are supported: rl_ImageFormat(), rl_ImageCrop(), rl_ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION      1
+// Support video playback functionality, video frames (QOI) decoded on loader threads
+// NOTE: Video audio track playback requires SUPPORT_MODULE_RAUDIO, video export requires SUPPORT_FILEFORMAT_QOI
+#define SUPPORT_VIDEO_PLAYBACK          1
 
+// rtextures: Configuration values
+//------------------------------------------------------------------------------------
+#define IMAGE_EXPORT_COMPRESSION        8       // Default PNG export compression level: 0 (none), 1-3 (fast, multithreaded), 4-9 (smaller files)
+#define MAX_IMAGE_TEXTURES              8       // Maximum number of image textures with modified regions tracked
+#define MAX_IMAGE_DIRTY_RECS           16       // Maximum number of modified regions tracked per image texture
+#define MAX_VIRTUAL_TEXTURE_LOADS      16       // Maximum number of virtual texture tiles loading at the same time (per virtual texture)
+#define MAX_VIDEO_FRAMES                4       // Maximum number of video frames decoded ahead (per video)
 
 //------------------------------------------------------------------------------------
 // Module: rtext - Configuration Flags
@@ -221,11 +240,16 @@
 // Support procedural mesh generation functions, uses external par_shapes.h library
 // NOTE: Some generated meshes DO NOT include generated texture coordinates
 #define SUPPORT_MESH_GENERATION         1
+// Draw basic 3d shapes (cube, sphere, cylinder, capsule) from retained meshes, instanced
+// NOTE: Instances are queued and drawn together on next render batch draw
+#define SUPPORT_INSTANCED_SHAPES        1
 
 // rmodels: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_MATERIAL_MAPS              12       // Maximum number of shader maps supported
 #define MAX_MESH_VERTEX_BUFFERS         7       // Maximum vertex buffers (VBO) per mesh
+#define ANIMATION_KEYFRAME_TOLERANCE  0.0001f   // Maximum error allowed on animation keyframes reduction (0.0f keeps all keyframes)
+#define MAX_SHAPE_MESHES_CACHE         32       // Maximum basic 3d shapes tessellations retained as meshes
 
 //------------------------------------------------------------------------------------
 // Module: raudio - Configuration Flags
@@ -246,6 +270,13 @@
 #define AUDIO_DEVICE_SAMPLE_RATE           0    // Device sample rate (device default)
 
 #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels
+#define MAX_AUDIO_BUSES                    8    // Maximum number of audio buses, bus 0 is the main mix
+#define AUDIO_RESAMPLER_QUALITY            1    // Mixer resampler quality: 0 (linear, fastest), 1 (8 taps), 2 (16 taps), 3 (32 taps, best)
+#define AUDIO_SPATIAL_MIN_DISTANCE      1.0f    // Spatial sounds default distance for full volume
+#define AUDIO_SPATIAL_MAX_DISTANCE    100.0f    // Spatial sounds default distance for silence
+#define AUDIO_SPATIAL_SPEED_OF_SOUND  343.3f    // Spatial sounds speed of sound for doppler effect, in world units per second
+#define AUDIO_SPATIAL_VIRTUAL_VOLUME 0.0001f    // Spatial sounds below this volume are virtualized: not mixed, only advanced
+#define AUDIO_SOUND_PREFIX_FRAMES       1024    // Compressed sounds decoded frames kept in memory for zero-latency starts
 
 //------------------------------------------------------------------------------------
 // Module: utils - Configuration Flags
@@ -256,9 +287,15 @@
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG                1
 //#define SUPPORT_TRACELOG_DEBUG          1
+// Loader threads for asynchronous loading: rl_LoadImageAsync(), models textures decoding
+// NOTE: Not available on PLATFORM_WEB, jobs are run on the calling thread
+#define SUPPORT_LOADER_THREADS          1
 
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH       256       // Max length of one trace-log message
+#define MAX_FILEIO_PACKS                8       // Max number of pack files mounted at the same time
+#define MAX_LOADER_THREADS              4       // Max number of loader threads
+#define MAX_LOADER_JOBS               256       // Max number of loader jobs pending at the same time
 
 #endif // CONFIG_H
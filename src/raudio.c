@@ -183,6 +183,16 @@ typedef struct tagBITMAPINFOHEADER {
 #include <stdlib.h>                     // Required for: malloc(), free()
 #include <stdio.h>                      // Required for: FILE, fopen(), fclose(), fread()
 #include <string.h>                     // Required for: strcmp() [Used in rl_IsFileExtension(), rl_LoadWaveFromMemory(), rl_LoadMusicStreamFromMemory()]
+#include <math.h>                       // Required for: sqrtf() [Used in UpdateAudioBufferSpatialInLockedState()], sin(), sqrt() [Used in InitAudioResampler()]
+
+// Mixer resampler vector instructions, available by default on x86-64 and arm64 targets
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>              // Required for: _mm_loadu_ps(), _mm_mul_ps(), _mm_add_ps() [Used in ResampleFrames()]
+    #define AUDIO_RESAMPLER_SSE
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>               // Required for: vld1q_f32(), vmlaq_f32() [Used in ResampleFrames()]
+    #define AUDIO_RESAMPLER_NEON
+#endif
 
 #if defined(RAUDIO_STANDALONE)
     #ifndef TRACELOG
@@ -298,6 +308,40 @@ typedef struct tagBITMAPINFOHEADER {
 #ifndef MAX_AUDIO_BUFFER_POOL_CHANNELS
     #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels
 #endif
+#ifndef MAX_AUDIO_BUSES
+    #define MAX_AUDIO_BUSES                    8    // Maximum number of audio buses, bus 0 is the main mix
+#endif
+#ifndef AUDIO_RESAMPLER_QUALITY
+    #define AUDIO_RESAMPLER_QUALITY            1    // Mixer resampler quality: 0 (linear, fastest), 1 (8 taps), 2 (16 taps), 3 (32 taps, best)
+#endif
+#if (AUDIO_RESAMPLER_QUALITY <= 0)
+    #define AUDIO_RESAMPLER_TAPS               2    // Mixer resampler filter taps (linear interpolation)
+#elif (AUDIO_RESAMPLER_QUALITY == 1)
+    #define AUDIO_RESAMPLER_TAPS               8    // Mixer resampler filter taps (windowed sinc)
+#elif (AUDIO_RESAMPLER_QUALITY == 2)
+    #define AUDIO_RESAMPLER_TAPS              16    // Mixer resampler filter taps (windowed sinc)
+#else
+    #define AUDIO_RESAMPLER_TAPS              32    // Mixer resampler filter taps (windowed sinc)
+#endif
+#define AUDIO_RESAMPLER_PHASES               128    // Mixer resampler filter phases, coefficients are interpolated between phases
+#define AUDIO_RESAMPLER_BANDS                  8    // Mixer resampler filter cutoff bands, higher bands for higher resampling ratios
+#define AUDIO_RESAMPLER_BLOCK_FRAMES        1024    // Mixer resampler input frames processed per block
+#define AUDIO_RESAMPLER_MAX_RATIO          32.0f    // Mixer resampler maximum input/output ratio (pitch)
+#ifndef AUDIO_SPATIAL_MIN_DISTANCE
+    #define AUDIO_SPATIAL_MIN_DISTANCE      1.0f    // Spatial sounds default distance for full volume
+#endif
+#ifndef AUDIO_SPATIAL_MAX_DISTANCE
+    #define AUDIO_SPATIAL_MAX_DISTANCE    100.0f    // Spatial sounds default distance for silence
+#endif
+#ifndef AUDIO_SPATIAL_SPEED_OF_SOUND
+    #define AUDIO_SPATIAL_SPEED_OF_SOUND  343.3f    // Spatial sounds speed of sound for doppler effect
+#endif
+#ifndef AUDIO_SPATIAL_VIRTUAL_VOLUME
+    #define AUDIO_SPATIAL_VIRTUAL_VOLUME 0.0001f    // Spatial sounds below this volume are not mixed
+#endif
+#ifndef AUDIO_SOUND_PREFIX_FRAMES
+    #define AUDIO_SOUND_PREFIX_FRAMES       1024    // Compressed sounds decoded frames kept for zero-latency starts
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -338,6 +382,18 @@ typedef enum {
     AUDIO_BUFFER_USAGE_STREAM
 } AudioBufferUsage;
 
+#if defined(SUPPORT_FILEFORMAT_QOA)
+// Compressed audio data (QOA), decoded by frames on mixing
+// NOTE: Data is owned by the source sound and shared with its aliases
+typedef struct AudioCompressedData {
+    qoa_desc desc;                  // QOA data description: channels, sample rate, total frames
+    unsigned char *data;            // QOA encoded data (including file header)
+    unsigned int dataSize;          // QOA encoded data size in bytes
+    short *prefix;                  // Decoded frames at sound start, avoids decoding on play start
+    unsigned int prefixFrames;      // Decoded frames count at sound start
+} AudioCompressedData;
+#endif
+
 // Audio buffer struct
 struct rAudioBuffer {
     ma_data_converter converter;    // Audio data converter
@@ -349,6 +405,16 @@ struct rAudioBuffer {
     float pitch;                    // Audio buffer pitch
     float pan;                      // Audio buffer pan (0.0f to 1.0f)
 
+    bool spatial;                   // Audio buffer is spatial, volume/pan/doppler computed on mixing
+    rl_Vector3 position;            // Audio buffer spatial position
+    rl_Vector3 velocity;            // Audio buffer spatial velocity (doppler)
+    float minDistance;              // Audio buffer spatial distance for full volume
+    float maxDistance;              // Audio buffer spatial distance for silence
+    float spatialVolume;            // Audio buffer spatial volume, computed on mixing
+    float spatialPan;               // Audio buffer spatial pan, computed on mixing
+    float doppler;                  // Audio buffer spatial doppler pitch factor, computed on mixing
+    int bus;                        // Audio buffer output bus (0 is main mix)
+
     bool playing;                   // Audio buffer state: AUDIO_PLAYING
     bool paused;                    // Audio buffer state: AUDIO_PAUSED
     bool looping;                   // Audio buffer looping, default to true for AudioStreams
@@ -361,6 +427,17 @@ struct rAudioBuffer {
 
     unsigned char *data;            // Data buffer, on music stream keeps filling
 
+    struct AudioCompressedData *compressed; // Compressed data source, decoded on mixing (NULL for PCM data)
+    short *decodedFrames;           // Decoded compressed frames scratch buffer (one QOA frame)
+    int decodedFrameIndex;          // Compressed frame index available in scratch buffer (-1 if none)
+
+    unsigned char *fileData;        // Music file data streamed from memory, owned by buffer (mapped from pack files)
+    int fileDataSize;               // Music file data size
+
+    float resamplerFrames[AUDIO_RESAMPLER_TAPS*AUDIO_DEVICE_CHANNELS]; // Resampler input frames kept for next output frame filter
+    unsigned int resamplerFrameCount;   // Resampler input frames kept count
+    ma_uint64 resamplerPosition;    // Resampler position over kept input frames (32.32 fixed point)
+
     rAudioBuffer *next;             // Next audio buffer on the list
     rAudioBuffer *prev;             // Previous audio buffer on the list
 };
@@ -382,6 +459,7 @@ typedef struct AudioData {
         ma_device device;           // miniaudio device
         ma_mutex lock;              // miniaudio mutex lock
         bool isReady;               // Check if audio device is ready
+        bool isOffline;             // Check if audio context is offline (no device, mixing on rl_RenderAudio())
         size_t pcmBufferSize;       // Pre-allocated buffer size
         void *pcmBuffer;            // Pre-allocated buffer to read audio data from file/memory
     } System;
@@ -390,6 +468,25 @@ typedef struct AudioData {
         AudioBuffer *last;          // Pointer to last AudioBuffer in the list
         int defaultSize;            // Default audio buffer size for audio streams
     } Buffer;
+    struct {
+        float volume;               // Bus volume
+        bool muted;                 // Bus mute state
+        bool active;                // Bus received frames on current mixing
+        rAudioProcessor *processor; // Bus processors chain, run once over bus mixed frames
+        float *frames;              // Bus mixed frames (device format)
+        unsigned int framesCapacity; // Bus mixed frames capacity
+    } Bus[MAX_AUDIO_BUSES];
+    struct {
+        rl_Vector3 position;        // Listener position
+        rl_Vector3 forward;         // Listener forward direction (normalized)
+        rl_Vector3 right;           // Listener right direction (normalized)
+        rl_Vector3 velocity;        // Listener velocity (doppler)
+    } Listener;
+    struct {
+        bool isReady;               // Resampler filter computed
+        // Polyphase filter coefficients: [band][phase][tap][channel], repeated per channel for vector processing
+        float filter[AUDIO_RESAMPLER_BANDS*(AUDIO_RESAMPLER_PHASES + 1)*AUDIO_RESAMPLER_TAPS*AUDIO_DEVICE_CHANNELS];
+    } Resampler;
     rAudioProcessor *mixedProcessor;
 } AudioData;
 
@@ -403,6 +500,8 @@ static AudioData AUDIO = {          // Global AUDIO context
     // standard double-buffering system, a 4096 samples buffer has been chosen, it should be enough
     // In case of music-stalls, just increase this number
     .Buffer.defaultSize = 0,
+    .Listener.forward = { 0.0f, 0.0f, -1.0f },
+    .Listener.right = { 1.0f, 0.0f, 0.0f },
     .mixedProcessor = NULL
 };
 
@@ -415,9 +514,25 @@ static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage);
 static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount);
 static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount);
 
+static ma_uint32 ReadAudioBufferFramesConverted(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount);
+
+static void InitAudioResampler(void);           // Init mixer resampler polyphase filter (shared by all buffers)
+static void ResetAudioBufferResampler(AudioBuffer *buffer);     // Reset audio buffer resampler input frames and position
+static double GetAudioBufferResamplerRatio(AudioBuffer *buffer);  // Get audio buffer resampling ratio: input frames per output frame
+static ma_uint64 ResampleFrames(const float *framesIn, float *framesOut, ma_uint32 frameCount, ma_uint64 position, ma_uint64 step, const float *filter);
+
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
 
+#if defined(SUPPORT_FILEFORMAT_QOA)
+static rl_Sound LoadSoundFromCompressedData(AudioCompressedData *compressed);    // Load sound from compressed data (takes ownership)
+static void ReadAudioBufferCompressedFrames(AudioBuffer *audioBuffer, short *framesOut, ma_uint32 framePos, ma_uint32 frameCount);
+#endif
+
+static void UpdateAudioBufferSpatialInLockedState(AudioBuffer *buffer);  // Update spatial volume, pan and doppler from listener
+static void SkipAudioBufferFramesInLockedState(AudioBuffer *buffer, ma_uint32 frameCount);  // Advance buffer as if mixed (virtualized buffers)
+static float *GetAudioBusFramesInLockedState(int bus, ma_uint32 frameCount);  // Get bus mixing frames, cleared on first request per mixing
+
 static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer);
 static void StopAudioBufferInLockedState(AudioBuffer *buffer);
 static void UpdateAudioStreamInLockedState(rl_AudioStream stream, const void *data, int frameCount);
@@ -431,6 +546,10 @@ static const char *rl_GetFileNameWithoutExt(const char *filePath);     // Get fi
 static unsigned char *rl_LoadFileData(const char *fileName, int *dataSize);    // Load file data as byte array (read)
 static bool rl_SaveFileData(const char *fileName, void *data, int dataSize);   // Save data to file from byte array (write)
 static bool rl_SaveFileText(const char *fileName, char *text);         // Save text data to file (write), string must be '\0' terminated
+
+// NOTE: Memory mapped file data not supported on standalone mode
+#define rl_LoadFileDataMapped(fileName, dataSize) rl_LoadFileData(fileName, dataSize)
+#define rl_UnloadFileDataMapped(data, dataSize) RL_FREE(data)
 #endif
 
 //----------------------------------------------------------------------------------
@@ -500,6 +619,8 @@ void rl_InitAudioDevice(void)
         return;
     }
 
+    InitAudioResampler();   // Filter must be ready before mixing starts on device thread
+
     // Keep the device running the whole time. May want to consider doing something a bit smarter and only have the device running
     // while there's at least one sound being played
     result = ma_device_start(&AUDIO.System.device);
@@ -511,6 +632,8 @@ void rl_InitAudioDevice(void)
         return;
     }
 
+    for (int i = 0; i < MAX_AUDIO_BUSES; i++) AUDIO.Bus[i].volume = 1.0f;
+
     TRACELOG(LOG_INFO, "AUDIO: Device initialized successfully");
     TRACELOG(LOG_INFO, "    > Backend:       miniaudio | %s", ma_get_backend_name(AUDIO.System.context.backend));
     TRACELOG(LOG_INFO, "    > Format:        %s -> %s", ma_get_format_name(AUDIO.System.device.playback.format), ma_get_format_name(AUDIO.System.device.playback.internalFormat));
@@ -521,16 +644,71 @@ void rl_InitAudioDevice(void)
     AUDIO.System.isReady = true;
 }
 
+// Initialize audio context without device, for offline rendering
+// NOTE: Mixing runs synchronously on rl_RenderAudio() calls, as fast as possible,
+// sounds, music and processors behave as with a device playing at provided sample rate
+void rl_InitAudioDeviceOffline(int sampleRate)
+{
+    if (AUDIO.System.isReady)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Device already initialized");
+        return;
+    }
+
+    if (ma_mutex_init(&AUDIO.System.lock) != MA_SUCCESS)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for mixing");
+        return;
+    }
+
+    // Device is never initialized, only the mixing parameters are set
+    memset(&AUDIO.System.device, 0, sizeof(ma_device));
+    AUDIO.System.device.sampleRate = (sampleRate > 0)? sampleRate : 44100;
+    AUDIO.System.device.playback.format = AUDIO_DEVICE_FORMAT;
+    AUDIO.System.device.playback.channels = AUDIO_DEVICE_CHANNELS;
+    ma_device_set_master_volume(&AUDIO.System.device, 1.0f);
+
+    for (int i = 0; i < MAX_AUDIO_BUSES; i++) AUDIO.Bus[i].volume = 1.0f;
+
+    TRACELOG(LOG_INFO, "AUDIO: Offline device initialized successfully");
+    TRACELOG(LOG_INFO, "    > Format:        %s", ma_get_format_name(AUDIO.System.device.playback.format));
+    TRACELOG(LOG_INFO, "    > Channels:      %d", AUDIO.System.device.playback.channels);
+    TRACELOG(LOG_INFO, "    > Sample rate:   %d", AUDIO.System.device.sampleRate);
+
+    InitAudioResampler();
+
+    AUDIO.System.isOffline = true;
+    AUDIO.System.isReady = true;
+}
+
 // Close the audio device for all contexts
 void rl_CloseAudioDevice(void)
 {
     if (AUDIO.System.isReady)
     {
         ma_mutex_uninit(&AUDIO.System.lock);
-        ma_device_uninit(&AUDIO.System.device);
-        ma_context_uninit(&AUDIO.System.context);
+        if (!AUDIO.System.isOffline)
+        {
+            ma_device_uninit(&AUDIO.System.device);
+            ma_context_uninit(&AUDIO.System.context);
+        }
+
+        for (int i = 0; i < MAX_AUDIO_BUSES; i++)
+        {
+            rAudioProcessor *processor = AUDIO.Bus[i].processor;
+            while (processor)
+            {
+                rAudioProcessor *next = processor->next;
+                RL_FREE(processor);
+                processor = next;
+            }
+
+            RL_FREE(AUDIO.Bus[i].frames);
+            memset(&AUDIO.Bus[i], 0, sizeof(AUDIO.Bus[i]));
+        }
 
         AUDIO.System.isReady = false;
+        AUDIO.System.isOffline = false;
         RL_FREE(AUDIO.System.pcmBuffer);
         AUDIO.System.pcmBuffer = NULL;
         AUDIO.System.pcmBufferSize = 0;
@@ -560,6 +738,84 @@ float rl_GetMasterVolume(void)
     return volume;
 }
 
+// Set listener position, orientation and velocity for spatial sounds
+// NOTE: Orientation is defined as camera: target point and up vector
+void rl_SetAudioListener(rl_Vector3 position, rl_Vector3 target, rl_Vector3 up, rl_Vector3 velocity)
+{
+    rl_Vector3 forward = { target.x - position.x, target.y - position.y, target.z - position.z };
+    float length = sqrtf(forward.x*forward.x + forward.y*forward.y + forward.z*forward.z);
+    if (length > 0.0f) { forward.x /= length; forward.y /= length; forward.z /= length; }
+    else forward = (rl_Vector3){ 0.0f, 0.0f, -1.0f };
+
+    // Right vector: cross(forward, up)
+    rl_Vector3 right = { forward.y*up.z - forward.z*up.y, forward.z*up.x - forward.x*up.z, forward.x*up.y - forward.y*up.x };
+    length = sqrtf(right.x*right.x + right.y*right.y + right.z*right.z);
+    if (length > 0.0f) { right.x /= length; right.y /= length; right.z /= length; }
+    else right = (rl_Vector3){ 1.0f, 0.0f, 0.0f };
+
+    ma_mutex_lock(&AUDIO.System.lock);
+    AUDIO.Listener.position = position;
+    AUDIO.Listener.forward = forward;
+    AUDIO.Listener.right = right;
+    AUDIO.Listener.velocity = velocity;
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
+// Render mixed audio frames into buffer, offline mode only
+// NOTE: Buffer must fit frameCount*AUDIO_DEVICE_CHANNELS floats, master volume is applied,
+// music streams must be updated between renders, render size should not exceed stream buffer size
+int rl_RenderAudio(float *buffer, int frameCount)
+{
+    if (!AUDIO.System.isOffline)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Rendering requires offline device, use rl_InitAudioDeviceOffline()");
+        return 0;
+    }
+
+    if ((buffer == NULL) || (frameCount <= 0)) return 0;
+
+    OnSendAudioDataToDevice(&AUDIO.System.device, buffer, NULL, frameCount);
+
+    // Master volume is applied by the device on playback, apply it here
+    float volume = rl_GetMasterVolume();
+    if (volume != 1.0f)
+    {
+        for (int i = 0; i < frameCount*(int)AUDIO.System.device.playback.channels; i++) buffer[i] *= volume;
+    }
+
+    return frameCount;
+}
+
+// Render mixed audio frames into a new wave, offline mode only
+// NOTE: Mixed frames are converted to 16bit samples, rl_Wave can be exported with rl_ExportWave() to any supported fileformat (WAV, QOA...)
+rl_Wave rl_RenderAudioWave(int frameCount)
+{
+    rl_Wave wave = { 0 };
+
+    if (!AUDIO.System.isOffline)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Rendering requires offline device, use rl_InitAudioDeviceOffline()");
+        return wave;
+    }
+
+    if (frameCount <= 0) return wave;
+
+    wave.data = RL_MALLOC(frameCount*AUDIO.System.device.playback.channels*sizeof(float));
+
+    if (wave.data != NULL)
+    {
+        wave.frameCount = rl_RenderAudio((float *)wave.data, frameCount);
+        wave.sampleRate = AUDIO.System.device.sampleRate;
+        wave.sampleSize = 32;
+        wave.channels = AUDIO.System.device.playback.channels;
+
+        // QOA export requires 16bit samples, mixer output is clipped on conversion
+        rl_WaveFormat(&wave, wave.sampleRate, 16, wave.channels);
+    }
+
+    return wave;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Audio Buffer management
 //----------------------------------------------------------------------------------
@@ -577,9 +833,8 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
 
     if (sizeInFrames > 0) audioBuffer->data = RL_CALLOC(sizeInFrames*channels*ma_get_bytes_per_sample(format), 1);
 
-    // Audio data runs through a format converter
-    ma_data_converter_config converterConfig = ma_data_converter_config_init(format, AUDIO_DEVICE_FORMAT, channels, AUDIO_DEVICE_CHANNELS, sampleRate, AUDIO.System.device.sampleRate);
-    converterConfig.allowDynamicSampleRate = true;
+    // Audio data runs through a format converter, sample rate conversion (and pitch) is done by mixer resampler
+    ma_data_converter_config converterConfig = ma_data_converter_config_init(format, AUDIO_DEVICE_FORMAT, channels, AUDIO_DEVICE_CHANNELS, sampleRate, sampleRate);
 
     ma_result result = ma_data_converter_init(&converterConfig, NULL, &audioBuffer->converter);
 
@@ -595,6 +850,13 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     audioBuffer->pitch = 1.0f;
     audioBuffer->pan = 0.5f;
 
+    audioBuffer->spatial = false;
+    audioBuffer->minDistance = AUDIO_SPATIAL_MIN_DISTANCE;
+    audioBuffer->maxDistance = AUDIO_SPATIAL_MAX_DISTANCE;
+    audioBuffer->spatialVolume = 1.0f;
+    audioBuffer->spatialPan = 0.5f;
+    audioBuffer->doppler = 1.0f;
+
     audioBuffer->callback = NULL;
     audioBuffer->processor = NULL;
 
@@ -606,6 +868,8 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     audioBuffer->frameCursorPos = 0;
     audioBuffer->sizeInFrames = sizeInFrames;
 
+    ResetAudioBufferResampler(audioBuffer);
+
     // Buffers should be marked as processed by default so that a call to
     // rl_UpdateAudioStream() immediately after initialization works correctly
     audioBuffer->isSubBufferProcessed[0] = true;
@@ -625,6 +889,7 @@ void UnloadAudioBuffer(AudioBuffer *buffer)
         UntrackAudioBuffer(buffer);
         ma_data_converter_uninit(&buffer->converter, NULL);
         RL_FREE(buffer->data);
+        RL_FREE(buffer->decodedFrames);
         RL_FREE(buffer);
     }
 }
@@ -646,10 +911,32 @@ void PlayAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        // Compressed data scratch buffer is only allocated for voices that are actually played
+        short *decodedFrames = NULL;
+        if ((buffer->compressed != NULL) && (buffer->decodedFrames == NULL))
+        {
+            decodedFrames = (short *)RL_MALLOC(QOA_FRAME_LEN*buffer->compressed->desc.channels*sizeof(short));
+
+            if (decodedFrames == NULL)
+            {
+                TRACELOG(LOG_WARNING, "SOUND: Failed to allocate compressed sound decoding buffer, sound not played");
+                return;
+            }
+        }
+#endif
         ma_mutex_lock(&AUDIO.System.lock);
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        if (decodedFrames != NULL)
+        {
+            buffer->decodedFrames = decodedFrames;
+            buffer->decodedFrameIndex = -1;
+        }
+#endif
         buffer->playing = true;
         buffer->paused = false;
         buffer->frameCursorPos = 0;
+        ResetAudioBufferResampler(buffer);      // Discard resampler input frames from previous playback
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -705,9 +992,7 @@ void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
         // Note that this changes the duration of the sound:
         //  - higher pitches will make the sound faster
         //  - lower pitches make it slower
-        ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/pitch);
-        ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
-
+        // NOTE: Mixer resampler ratio is computed from pitch on mixing
         buffer->pitch = pitch;
         ma_mutex_unlock(&AUDIO.System.lock);
     }
@@ -770,14 +1055,14 @@ rl_Wave rl_LoadWave(const char *fileName)
 {
     rl_Wave wave = { 0 };
 
-    // Loading file to memory
+    // Loading file to memory, decoded directly from file mapping
     int dataSize = 0;
-    unsigned char *fileData = rl_LoadFileData(fileName, &dataSize);
+    unsigned char *fileData = rl_LoadFileDataMapped(fileName, &dataSize);
 
     // Loading wave from memory data
     if (fileData != NULL) wave = rl_LoadWaveFromMemory(rl_GetFileExtension(fileName), fileData, dataSize);
 
-    rl_UnloadFileData(fileData);
+    rl_UnloadFileDataMapped(fileData, dataSize);
 
     return wave;
 }
@@ -962,12 +1247,135 @@ rl_Sound rl_LoadSoundFromWave(rl_Wave wave)
     return sound;
 }
 
+// Load sound from file keeping data compressed in memory
+// NOTE: QOA files are kept as loaded, other fileformats are decoded and encoded to QOA,
+// sound frames are decoded on mixing (~5x smaller than 16bit PCM, ~10x smaller than device float format)
+// NOTE: Decoding costs ~20us per playing voice per 1024 frames mixed (stereo 44100 Hz, x86-64), ~10x PCM sounds mixing
+rl_Sound rl_LoadSoundCompressed(const char *fileName)
+{
+    rl_Sound sound = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_QOA)
+    if (rl_IsFileExtension(fileName, ".qoa"))
+    {
+        int dataSize = 0;
+        unsigned char *fileData = rl_LoadFileData(fileName, &dataSize);
+
+        if (fileData != NULL)
+        {
+            AudioCompressedData *compressed = (AudioCompressedData *)RL_CALLOC(1, sizeof(AudioCompressedData));
+
+            if (compressed == NULL)
+            {
+                TRACELOG(LOG_WARNING, "SOUND: [%s] Failed to allocate memory for compressed data", fileName);
+                rl_UnloadFileData(fileData);
+            }
+            else if (qoa_decode_header(fileData, dataSize, &compressed->desc) > 0)
+            {
+                compressed->data = fileData;
+                compressed->dataSize = dataSize;
+
+                sound = LoadSoundFromCompressedData(compressed);
+            }
+            else
+            {
+                TRACELOG(LOG_WARNING, "SOUND: [%s] Failed to load QOA data", fileName);
+                rl_UnloadFileData(fileData);
+                RL_FREE(compressed);
+            }
+        }
+    }
+    else
+    {
+        rl_Wave wave = rl_LoadWave(fileName);
+
+        sound = rl_LoadSoundFromWaveCompressed(wave);
+
+        rl_UnloadWave(wave);
+    }
+#else
+    TRACELOG(LOG_WARNING, "SOUND: Compressed sounds require QOA support, loading uncompressed");
+    sound = rl_LoadSound(fileName);
+#endif
+
+    return sound;
+}
+
+// Load sound from wave data, compressed in memory
+// NOTE: rl_Wave data is encoded to QOA (16bit, up to 8 channels), wave data must be unallocated manually
+rl_Sound rl_LoadSoundFromWaveCompressed(rl_Wave wave)
+{
+    rl_Sound sound = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_QOA)
+    if ((wave.data != NULL) && (wave.channels <= QOA_MAX_CHANNELS))
+    {
+        rl_Wave waveCopy = wave;
+        if (wave.sampleSize != 16)
+        {
+            waveCopy = rl_WaveCopy(wave);
+            rl_WaveFormat(&waveCopy, wave.sampleRate, 16, wave.channels);
+        }
+
+        AudioCompressedData *compressed = (AudioCompressedData *)RL_CALLOC(1, sizeof(AudioCompressedData));
+
+        if ((compressed != NULL) && (waveCopy.data != NULL))
+        {
+            compressed->desc.channels = waveCopy.channels;
+            compressed->desc.samplerate = waveCopy.sampleRate;
+            compressed->desc.samples = waveCopy.frameCount;
+            compressed->data = (unsigned char *)qoa_encode((short *)waveCopy.data, &compressed->desc, &compressed->dataSize);
+        }
+
+        if (waveCopy.data != wave.data) rl_UnloadWave(waveCopy);
+
+        if ((compressed != NULL) && (compressed->data != NULL)) sound = LoadSoundFromCompressedData(compressed);
+        else
+        {
+            TRACELOG(LOG_WARNING, "SOUND: Failed to compress wave data");
+            RL_FREE(compressed);
+        }
+    }
+    else if (wave.data != NULL) TRACELOG(LOG_WARNING, "SOUND: Compressed sounds support up to %i channels", QOA_MAX_CHANNELS);
+#else
+    TRACELOG(LOG_WARNING, "SOUND: Compressed sounds require QOA support, loading uncompressed");
+    sound = rl_LoadSoundFromWave(wave);
+#endif
+
+    return sound;
+}
+
 // Clone sound from existing sound data, clone does not own wave data
 // NOTE: rl_Wave data must be unallocated manually and will be shared across all clones
 rl_Sound rl_LoadSoundAlias(rl_Sound source)
 {
     rl_Sound sound = { 0 };
 
+#if defined(SUPPORT_FILEFORMAT_QOA)
+    if (source.stream.buffer->compressed != NULL)
+    {
+        // Compressed data is shared, every alias decodes frames into its own scratch buffer
+        AudioBuffer *audioBuffer = LoadAudioBuffer(ma_format_s16, source.stream.channels, source.stream.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+
+        if (audioBuffer == NULL)
+        {
+            TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
+            return sound; // Early return to avoid dereferencing the audioBuffer null pointer
+        }
+
+        audioBuffer->sizeInFrames = source.stream.buffer->sizeInFrames;
+        audioBuffer->volume = source.stream.buffer->volume;
+        audioBuffer->compressed = source.stream.buffer->compressed;
+        audioBuffer->decodedFrameIndex = -1;
+
+        sound.frameCount = source.frameCount;
+        sound.stream = source.stream;
+        sound.stream.buffer = audioBuffer;
+
+        return sound;
+    }
+#endif
+
     if (source.stream.buffer->data != NULL)
     {
         AudioBuffer *audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
@@ -1017,7 +1425,19 @@ void rl_UnloadWave(rl_Wave wave)
 // Unload sound
 void rl_UnloadSound(rl_Sound sound)
 {
+#if defined(SUPPORT_FILEFORMAT_QOA)
+    // NOTE: Compressed data is owned by the source sound, freed once the buffer is untracked from mixer
+    AudioCompressedData *compressed = (sound.stream.buffer != NULL)? sound.stream.buffer->compressed : NULL;
+#endif
     UnloadAudioBuffer(sound.stream.buffer);
+#if defined(SUPPORT_FILEFORMAT_QOA)
+    if (compressed != NULL)
+    {
+        RL_FREE(compressed->data);
+        RL_FREE(compressed->prefix);
+        RL_FREE(compressed);
+    }
+#endif
     //TRACELOG(LOG_INFO, "SOUND: Unloaded sound data from RAM");
 }
 
@@ -1028,6 +1448,7 @@ void rl_UnloadSoundAlias(rl_Sound alias)
     {
         UntrackAudioBuffer(alias.stream.buffer);
         ma_data_converter_uninit(&alias.stream.buffer->converter, NULL);
+        RL_FREE(alias.stream.buffer->decodedFrames);
         RL_FREE(alias.stream.buffer);
     }
 }
@@ -1035,7 +1456,11 @@ void rl_UnloadSoundAlias(rl_Sound alias)
 // Update sound buffer with new data
 void rl_UpdateSound(rl_Sound sound, const void *data, int frameCount)
 {
-    if (sound.stream.buffer != NULL)
+    if ((sound.stream.buffer != NULL) && (sound.stream.buffer->compressed != NULL))
+    {
+        TRACELOG(LOG_WARNING, "SOUND: Compressed sounds data can not be updated");
+    }
+    else if (sound.stream.buffer != NULL)
     {
         StopAudioBuffer(sound.stream.buffer);
 
@@ -1220,13 +1645,90 @@ void rl_SetSoundPan(rl_Sound sound, float pan)
     SetAudioBufferPan(sound.stream.buffer, pan);
 }
 
+// Set sound position and velocity, sound becomes spatial
+// NOTE: Volume, pan and doppler pitch are computed on mixing from listener, set with rl_SetAudioListener(),
+// inaudible sounds are virtualized: they keep playing but they are not mixed
+void rl_SetSoundPosition(rl_Sound sound, rl_Vector3 position, rl_Vector3 velocity)
+{
+    if (sound.stream.buffer != NULL)
+    {
+        ma_mutex_lock(&AUDIO.System.lock);
+        sound.stream.buffer->spatial = true;
+        sound.stream.buffer->position = position;
+        sound.stream.buffer->velocity = velocity;
+        ma_mutex_unlock(&AUDIO.System.lock);
+    }
+}
+
+// Set sound spatialization, disabled sounds are mixed with their volume, pan and pitch only
+// NOTE: Sound position and velocity are kept, spatialization can be enabled again
+void rl_SetSoundSpatial(rl_Sound sound, bool spatial)
+{
+    if (sound.stream.buffer != NULL)
+    {
+        ma_mutex_lock(&AUDIO.System.lock);
+        sound.stream.buffer->spatial = spatial;
+
+        if (!spatial)
+        {
+            sound.stream.buffer->spatialVolume = 1.0f;
+            sound.stream.buffer->spatialPan = 0.5f;
+            sound.stream.buffer->doppler = 1.0f;
+        }
+        ma_mutex_unlock(&AUDIO.System.lock);
+    }
+}
+
+// Set spatial sound attenuation range
+// NOTE: Full volume until minDistance, inverse distance attenuation faded to silence at maxDistance
+void rl_SetSoundSpatialRange(rl_Sound sound, float minDistance, float maxDistance)
+{
+    if ((sound.stream.buffer != NULL) && (minDistance > 0.0f) && (maxDistance > minDistance))
+    {
+        ma_mutex_lock(&AUDIO.System.lock);
+        sound.stream.buffer->minDistance = minDistance;
+        sound.stream.buffer->maxDistance = maxDistance;
+        ma_mutex_unlock(&AUDIO.System.lock);
+    }
+}
+
 // Convert wave data to desired format
 void rl_WaveFormat(rl_Wave *wave, int sampleRate, int sampleSize, int channels)
 {
+    if ((wave->sampleRate == (unsigned int)sampleRate) && (wave->sampleSize == (unsigned int)sampleSize) && (wave->channels == (unsigned int)channels)) return;
+
     ma_format formatIn = ((wave->sampleSize == 8)? ma_format_u8 : ((wave->sampleSize == 16)? ma_format_s16 : ma_format_f32));
     ma_format formatOut = ((sampleSize == 8)? ma_format_u8 : ((sampleSize == 16)? ma_format_s16 : ma_format_f32));
 
     ma_uint32 frameCountIn = wave->frameCount;
+    ma_uint32 frameSizeIn = wave->channels*wave->sampleSize/8;
+    ma_uint32 frameSizeOut = channels*sampleSize/8;
+
+    // Same sample rate conversion not growing frame size is done in-place, by chunks,
+    // output chunk is always written behind input data still to be read
+    if ((wave->sampleRate == (unsigned int)sampleRate) && (frameSizeOut <= frameSizeIn))
+    {
+        ma_uint8 chunk[4096] = { 0 };
+        ma_uint32 chunkFrameCap = sizeof(chunk)/frameSizeOut;
+        if (chunkFrameCap > sizeof(chunk)/frameSizeIn) chunkFrameCap = sizeof(chunk)/frameSizeIn;
+
+        for (ma_uint32 frame = 0; frame < frameCountIn; frame += chunkFrameCap)
+        {
+            ma_uint32 framesToConvert = ((frameCountIn - frame) < chunkFrameCap)? (frameCountIn - frame) : chunkFrameCap;
+
+            ma_convert_frames(chunk, framesToConvert, formatOut, channels, sampleRate, (ma_uint8 *)wave->data + frame*frameSizeIn, framesToConvert, formatIn, wave->channels, wave->sampleRate);
+            memcpy((ma_uint8 *)wave->data + frame*frameSizeOut, chunk, framesToConvert*frameSizeOut);
+        }
+
+        void *data = RL_REALLOC(wave->data, frameCountIn*frameSizeOut);
+        if (data != NULL) wave->data = data;
+
+        wave->sampleSize = sampleSize;
+        wave->channels = channels;
+
+        return;
+    }
+
     ma_uint32 frameCount = (ma_uint32)ma_convert_frames(NULL, 0, formatOut, channels, sampleRate, NULL, frameCountIn, formatIn, wave->channels, wave->sampleRate);
 
     if (frameCount == 0)
@@ -1235,12 +1737,13 @@ void rl_WaveFormat(rl_Wave *wave, int sampleRate, int sampleSize, int channels)
         return;
     }
 
-    void *data = RL_MALLOC(frameCount*channels*(sampleSize/8));
+    void *data = RL_MALLOC(frameCount*frameSizeOut);
 
     frameCount = (ma_uint32)ma_convert_frames(data, frameCount, formatOut, channels, sampleRate, wave->data, frameCountIn, formatIn, wave->channels, wave->sampleRate);
     if (frameCount == 0)
     {
         TRACELOG(LOG_WARNING, "WAVE: Failed format conversion");
+        RL_FREE(data);
         return;
     }
 
@@ -1328,6 +1831,30 @@ rl_Music rl_LoadMusicStream(const char *fileName)
     rl_Music music = { 0 };
     bool musicLoaded = false;
 
+#if !defined(RAUDIO_STANDALONE)
+    // Packed files can not be opened by decoders, music is streamed from mapped file data
+    if (IsFileInPacks(fileName))
+    {
+        int dataSize = 0;
+        unsigned char *data = rl_LoadFileDataMapped(fileName, &dataSize);
+
+        if (data != NULL)
+        {
+            music = rl_LoadMusicStreamFromMemory(rl_GetFileExtension(fileName), data, dataSize);
+
+            // File data is required until music is unloaded
+            if (music.stream.buffer != NULL)
+            {
+                music.stream.buffer->fileData = data;
+                music.stream.buffer->fileDataSize = dataSize;
+            }
+            else rl_UnloadFileDataMapped(data, dataSize);
+        }
+
+        return music;
+    }
+#endif
+
     if (false) { }
 #if defined(SUPPORT_FILEFORMAT_WAV)
     else if (rl_IsFileExtension(fileName, ".wav"))
@@ -1737,6 +2264,10 @@ bool rl_IsMusicReady(rl_Music music)
 // Unload music stream
 void rl_UnloadMusicStream(rl_Music music)
 {
+    // NOTE: Music file data is unloaded after the decoder context
+    unsigned char *fileData = (music.stream.buffer != NULL)? music.stream.buffer->fileData : NULL;
+    int fileDataSize = (music.stream.buffer != NULL)? music.stream.buffer->fileDataSize : 0;
+
     rl_UnloadAudioStream(music.stream);
 
     if (music.ctxData != NULL)
@@ -1764,6 +2295,8 @@ void rl_UnloadMusicStream(rl_Music music)
         else if (music.ctxType == MUSIC_MODULE_MOD) { jar_mod_unload((jar_mod_context_t *)music.ctxData); RL_FREE(music.ctxData); }
 #endif
     }
+
+    if (fileData != NULL) rl_UnloadFileDataMapped(fileData, fileDataSize);
 }
 
 // Start music playing (open stream) from beginning
@@ -2327,6 +2860,107 @@ void rl_DetachAudioMixedProcessor(AudioCallback process)
     ma_mutex_unlock(&AUDIO.System.lock);
 }
 
+// Set sound output bus
+// NOTE: Bus 0 is the main mix, buses from 1 are mixed separately, processed and added to main mix
+void rl_SetSoundBus(rl_Sound sound, int bus)
+{
+    rl_SetAudioStreamBus(sound.stream, bus);
+}
+
+// Set audio stream output bus
+void rl_SetAudioStreamBus(rl_AudioStream stream, int bus)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES))
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Bus %i out of range (max buses: %i)", bus, MAX_AUDIO_BUSES);
+        return;
+    }
+
+    if (stream.buffer != NULL)
+    {
+        ma_mutex_lock(&AUDIO.System.lock);
+        stream.buffer->bus = bus;
+        ma_mutex_unlock(&AUDIO.System.lock);
+    }
+}
+
+// Set volume for a submix bus
+void rl_SetAudioBusVolume(int bus, float volume)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES)) return;
+
+    ma_mutex_lock(&AUDIO.System.lock);
+    AUDIO.Bus[bus].volume = volume;
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
+// Set mute state for a submix bus
+// NOTE: Sounds routed to a muted bus keep playing but they are not mixed
+void rl_SetAudioBusMute(int bus, bool mute)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES)) return;
+
+    ma_mutex_lock(&AUDIO.System.lock);
+    AUDIO.Bus[bus].muted = mute;
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
+// Add processor to a submix bus, processors run once over the bus mixed frames
+// NOTE: Bus 0 processors run over the main mix, before mixed processors
+void rl_AttachAudioBusProcessor(int bus, AudioCallback process)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES)) return;
+
+    ma_mutex_lock(&AUDIO.System.lock);
+
+    rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
+    processor->process = process;
+
+    rAudioProcessor *last = AUDIO.Bus[bus].processor;
+
+    while (last && last->next)
+    {
+        last = last->next;
+    }
+    if (last)
+    {
+        processor->prev = last;
+        last->next = processor;
+    }
+    else AUDIO.Bus[bus].processor = processor;
+
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
+// Remove processor from a submix bus
+void rl_DetachAudioBusProcessor(int bus, AudioCallback process)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES)) return;
+
+    ma_mutex_lock(&AUDIO.System.lock);
+
+    rAudioProcessor *processor = AUDIO.Bus[bus].processor;
+
+    while (processor)
+    {
+        rAudioProcessor *next = processor->next;
+        rAudioProcessor *prev = processor->prev;
+
+        if (processor->process == process)
+        {
+            if (AUDIO.Bus[bus].processor == processor) AUDIO.Bus[bus].processor = next;
+            if (prev) prev->next = next;
+            if (next) next->prev = prev;
+
+            RL_FREE(processor);
+        }
+
+        processor = next;
+    }
+
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
@@ -2397,6 +3031,10 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         ma_uint32 framesToRead = totalFramesRemaining;
         if (framesToRead > framesRemainingInOutputBuffer) framesToRead = framesRemainingInOutputBuffer;
 
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        if (audioBuffer->compressed != NULL) ReadAudioBufferCompressedFrames(audioBuffer, (short *)((unsigned char *)framesOut + (framesRead*frameSizeInBytes)), audioBuffer->frameCursorPos, framesToRead);
+        else
+#endif
         memcpy((unsigned char *)framesOut + (framesRead*frameSizeInBytes), audioBuffer->data + (audioBuffer->frameCursorPos*frameSizeInBytes), framesToRead*frameSizeInBytes);
         audioBuffer->frameCursorPos = (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames;
         framesRead += framesToRead;
@@ -2434,49 +3072,238 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
 }
 
 // Reads audio data from an AudioBuffer object in device format, returned data will be in a format appropriate for mixing
+// NOTE: Data is converted to device format and channels, and resampled to device sample rate considering pitch and doppler
 static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount)
 {
-    // What's going on here is that we're continuously converting data from the AudioBuffer's internal format to the mixing format, which
-    // should be defined by the output format of the data converter. We do this until frameCount frames have been output. The important
-    // detail to remember here is that we never, ever attempt to read more input data than is required for the specified number of output
-    // frames. This can be achieved with ma_data_converter_get_required_input_frame_count()
-    ma_uint8 inputBuffer[4096] = { 0 };
-    ma_uint32 inputBufferFrameCap = sizeof(inputBuffer)/ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
+    const ma_uint32 channels = AUDIO_DEVICE_CHANNELS;
+    float framesIn[(AUDIO_RESAMPLER_BLOCK_FRAMES + AUDIO_RESAMPLER_TAPS)*AUDIO_DEVICE_CHANNELS];   // Kept and read input frames block
+
+    double ratio = GetAudioBufferResamplerRatio(audioBuffer);
+    ma_uint64 step = (ma_uint64)(ratio*4294967296.0);
+    if (step == 0) step = 1;
+
+    // Filter cutoff band is selected to avoid aliasing when input is decimated (ratio > 1)
+    int band = (ratio > 1.0)? (int)ceil(AUDIO_RESAMPLER_BANDS*(1.0 - 1.0/ratio)) : 0;
+    if (band > (AUDIO_RESAMPLER_BANDS - 1)) band = AUDIO_RESAMPLER_BANDS - 1;
+    const float *filter = AUDIO.Resampler.filter + band*(AUDIO_RESAMPLER_PHASES + 1)*AUDIO_RESAMPLER_TAPS*channels;
 
     ma_uint32 totalOutputFramesProcessed = 0;
     while (totalOutputFramesProcessed < frameCount)
     {
-        ma_uint64 outputFramesToProcessThisIteration = frameCount - totalOutputFramesProcessed;
-        ma_uint64 inputFramesToProcessThisIteration = 0;
+        // Input frames kept from previous processing are still required by next output frames filter
+        ma_uint32 framesAvailable = audioBuffer->resamplerFrameCount;
+        ma_uint64 position = audioBuffer->resamplerPosition;
+        memcpy(framesIn, audioBuffer->resamplerFrames, framesAvailable*channels*sizeof(float));
+
+        // Output frames are limited by the input frames fitting in the block
+        ma_uint64 outputFrames = frameCount - totalOutputFramesProcessed;
+        // NOTE: Position never exceeds the block, it keeps at most one step of frames (AUDIO_RESAMPLER_MAX_RATIO)
+        ma_uint64 maxOutputFrames = (((ma_uint64)AUDIO_RESAMPLER_BLOCK_FRAMES << 32) - position)/step + 1;
+        if (outputFrames > maxOutputFrames) outputFrames = maxOutputFrames;
+
+        // Read input frames required by last output frame filter
+        ma_uint32 framesRequired = (ma_uint32)((position + step*(outputFrames - 1)) >> 32) + AUDIO_RESAMPLER_TAPS;
+
+        if (framesRequired > framesAvailable)
+        {
+            ma_uint32 framesRead = ReadAudioBufferFramesConverted(audioBuffer, framesIn + framesAvailable*channels, framesRequired - framesAvailable);
+
+            // Missing frames (end of data) are silence, it flushes filter tail
+            memset(framesIn + (framesAvailable + framesRead)*channels, 0, (framesRequired - framesAvailable - framesRead)*channels*sizeof(float));
+            framesAvailable = framesRequired;
+        }
+
+        position = ResampleFrames(framesIn, framesOut + totalOutputFramesProcessed*channels, (ma_uint32)outputFrames, position, step, filter);
+        totalOutputFramesProcessed += (ma_uint32)outputFrames;
+
+        // Keep input frames required by next output frame filter
+        ma_uint32 framesConsumed = (ma_uint32)(position >> 32);
+        if (framesConsumed > framesAvailable) framesConsumed = framesAvailable;
+
+        audioBuffer->resamplerFrameCount = framesAvailable - framesConsumed;
+        audioBuffer->resamplerPosition = position - ((ma_uint64)framesConsumed << 32);
+        memcpy(audioBuffer->resamplerFrames, framesIn + framesConsumed*channels, audioBuffer->resamplerFrameCount*channels*sizeof(float));
+
+        if (!audioBuffer->playing) break;   // End of data reached
+    }
+
+    return totalOutputFramesProcessed;
+}
+
+// Reads audio data from an AudioBuffer object converted to device format and channels, at buffer sample rate
+static ma_uint32 ReadAudioBufferFramesConverted(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount)
+{
+    // Buffers already in device format and channels are read directly
+    if ((audioBuffer->converter.formatIn == audioBuffer->converter.formatOut) &&
+        (audioBuffer->converter.channelsIn == audioBuffer->converter.channelsOut)) return ReadAudioBufferFramesInInternalFormat(audioBuffer, framesOut, frameCount);
+
+    ma_uint8 inputBuffer[4096] = { 0 };
+    ma_uint32 inputBufferFrameCap = sizeof(inputBuffer)/ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
+
+    ma_uint32 totalFramesRead = 0;
+    while (totalFramesRead < frameCount)
+    {
+        ma_uint32 framesToRead = frameCount - totalFramesRead;
+        if (framesToRead > inputBufferFrameCap) framesToRead = inputBufferFrameCap;
+
+        // NOTE: Converter does not resample, input and output frames match
+        ma_uint64 inputFramesProcessed = ReadAudioBufferFramesInInternalFormat(audioBuffer, inputBuffer, framesToRead);
+        ma_uint64 outputFramesProcessed = inputFramesProcessed;
+        ma_data_converter_process_pcm_frames(&audioBuffer->converter, inputBuffer, &inputFramesProcessed, framesOut + totalFramesRead*AUDIO_DEVICE_CHANNELS, &outputFramesProcessed);
+
+        totalFramesRead += (ma_uint32)outputFramesProcessed;
+
+        if ((outputFramesProcessed < framesToRead) || (outputFramesProcessed == 0)) break;  // Ran out of input data
+    }
+
+    return totalFramesRead;
+}
+
+// Init mixer resampler polyphase filter, shared by all audio buffers
+// NOTE: Kaiser-windowed sinc filters, each cutoff band is used for a range of resampling ratios
+static void InitAudioResampler(void)
+{
+    if (AUDIO.Resampler.isReady) return;
+
+    const int taps = AUDIO_RESAMPLER_TAPS;
+    const double beta = 2.0 + taps/4.0;     // Kaiser window shape: stopband attenuation increases with taps
+
+    // Kaiser window normalization: I0(beta), modified Bessel function of the first kind (power series)
+    double i0Beta = 1.0;
+    for (double k = 1.0, term = 1.0; term > 1e-12*i0Beta; k += 1.0) { term *= (beta*beta/4.0)/(k*k); i0Beta += term; }
+
+    for (int band = 0; band < AUDIO_RESAMPLER_BANDS; band++)
+    {
+        double cutoff = 0.95*(1.0 - (double)band/AUDIO_RESAMPLER_BANDS);
 
-        (void)ma_data_converter_get_required_input_frame_count(&audioBuffer->converter, outputFramesToProcessThisIteration, &inputFramesToProcessThisIteration);
-        if (inputFramesToProcessThisIteration > inputBufferFrameCap)
+        for (int phase = 0; phase <= AUDIO_RESAMPLER_PHASES; phase++)
         {
-            inputFramesToProcessThisIteration = inputBufferFrameCap;
+            float *coefs = AUDIO.Resampler.filter + (band*(AUDIO_RESAMPLER_PHASES + 1) + phase)*taps*AUDIO_DEVICE_CHANNELS;
+            double fraction = (double)phase/AUDIO_RESAMPLER_PHASES;
+            double values[AUDIO_RESAMPLER_TAPS] = { 0 };
+            double sum = 0.0;
+
+            for (int k = 0; k < taps; k++)
+            {
+                // Output frame is placed between taps (taps/2 - 1) and (taps/2)
+                double x = (double)(k - (taps/2 - 1)) - fraction;
+
+                if (taps == 2) values[k] = 1.0 - fabs(x);
+                else
+                {
+                    double t = x/(taps/2.0);
+                    double window = 0.0;
+
+                    if (fabs(t) < 1.0)
+                    {
+                        double arg = beta*sqrt(1.0 - t*t);
+                        window = 1.0;
+                        for (double n = 1.0, term = 1.0; term > 1e-12*window; n += 1.0) { term *= (arg*arg/4.0)/(n*n); window += term; }
+                        window /= i0Beta;
+                    }
+
+                    double sinc = (fabs(x) < 1e-9)? 1.0 : sin(3.14159265358979323846*cutoff*x)/(3.14159265358979323846*cutoff*x);
+                    values[k] = cutoff*sinc*window;
+                }
+
+                sum += values[k];
+            }
+
+            // Coefficients are normalized for unity gain, repeated per channel
+            for (int k = 0; k < taps; k++)
+            {
+                for (int c = 0; c < AUDIO_DEVICE_CHANNELS; c++) coefs[k*AUDIO_DEVICE_CHANNELS + c] = (float)(values[k]/sum);
+            }
         }
+    }
+
+    AUDIO.Resampler.isReady = true;
+}
 
-        float *runningFramesOut = framesOut + (totalOutputFramesProcessed*audioBuffer->converter.channelsOut);
+// Reset audio buffer resampler input frames and position
+// NOTE: Input frames previous to first output frame are silence, playback starts without delay
+static void ResetAudioBufferResampler(AudioBuffer *buffer)
+{
+    memset(buffer->resamplerFrames, 0, sizeof(buffer->resamplerFrames));
+    buffer->resamplerFrameCount = AUDIO_RESAMPLER_TAPS/2 - 1;
+    buffer->resamplerPosition = 0;
+}
+
+// Get audio buffer resampling ratio: input frames consumed per output frame
+// NOTE: Ratio considers buffer sample rate, pitch and doppler
+static double GetAudioBufferResamplerRatio(AudioBuffer *buffer)
+{
+    double ratio = (double)buffer->converter.sampleRateIn/AUDIO.System.device.sampleRate*buffer->pitch*buffer->doppler;
+    if (ratio > AUDIO_RESAMPLER_MAX_RATIO) ratio = AUDIO_RESAMPLER_MAX_RATIO;
+
+    return ratio;
+}
+
+// Resample frames with polyphase filter, returns position after last output frame
+// NOTE: Input frames must cover the filter taps of every output frame, position and step are 32.32 fixed point
+static ma_uint64 ResampleFrames(const float *framesIn, float *framesOut, ma_uint32 frameCount, ma_uint64 position, ma_uint64 step, const float *filter)
+{
+    const ma_uint32 channels = AUDIO_DEVICE_CHANNELS;
+    const int coefCount = AUDIO_RESAMPLER_TAPS*AUDIO_DEVICE_CHANNELS;
 
-        /* At this point we can convert the data to our mixing format. */
-        ma_uint64 inputFramesProcessedThisIteration = ReadAudioBufferFramesInInternalFormat(audioBuffer, inputBuffer, (ma_uint32)inputFramesToProcessThisIteration);    /* Safe cast. */
-        ma_uint64 outputFramesProcessedThisIteration = outputFramesToProcessThisIteration;
-        ma_data_converter_process_pcm_frames(&audioBuffer->converter, inputBuffer, &inputFramesProcessedThisIteration, runningFramesOut, &outputFramesProcessedThisIteration);
+    // Unpitched frames with no fractional position are just copied
+    if ((step == ((ma_uint64)1 << 32)) && ((position & 0xffffffff) == 0))
+    {
+        memcpy(framesOut, framesIn + ((position >> 32) + AUDIO_RESAMPLER_TAPS/2 - 1)*channels, frameCount*channels*sizeof(float));
+        return position + ((ma_uint64)frameCount << 32);
+    }
+
+    for (ma_uint32 i = 0; i < frameCount; i++, position += step)
+    {
+        // Coefficients are interpolated between the two closest filter phases
+        const float *frames = framesIn + (position >> 32)*channels;
+        ma_uint64 phasePosition = (position & 0xffffffff)*AUDIO_RESAMPLER_PHASES;
+        ma_uint32 phase = (ma_uint32)(phasePosition >> 32);
+        float t = (float)(phasePosition & 0xffffffff)/4294967296.0f;
+        const float *coefsA = filter + phase*coefCount;
+        const float *coefsB = coefsA + coefCount;
 
-        totalOutputFramesProcessed += (ma_uint32)outputFramesProcessedThisIteration; /* Safe cast. */
+#if defined(AUDIO_RESAMPLER_SSE) && (AUDIO_DEVICE_CHANNELS == 2)
+        // Two stereo frames per vector: (L0, R0, L1, R1)
+        __m128 sum = _mm_setzero_ps();
+        __m128 t4 = _mm_set1_ps(t);
 
-        if (inputFramesProcessedThisIteration < inputFramesToProcessThisIteration)
+        for (int k = 0; k < coefCount; k += 4)
         {
-            break;  /* Ran out of input data. */
+            __m128 a = _mm_loadu_ps(coefsA + k);
+            __m128 coefs = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(coefsB + k), a), t4));
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(frames + k), coefs));
         }
 
-        /* This should never be hit, but will add it here for safety. Ensures we get out of the loop when no input nor output frames are processed. */
-        if (inputFramesProcessedThisIteration == 0 && outputFramesProcessedThisIteration == 0)
+        float result[4] = { 0 };
+        _mm_storeu_ps(result, sum);
+        framesOut[i*2] = result[0] + result[2];
+        framesOut[i*2 + 1] = result[1] + result[3];
+#elif defined(AUDIO_RESAMPLER_NEON) && (AUDIO_DEVICE_CHANNELS == 2)
+        // Two stereo frames per vector: (L0, R0, L1, R1)
+        float32x4_t sum = vdupq_n_f32(0.0f);
+
+        for (int k = 0; k < coefCount; k += 4)
         {
-            break;
+            float32x4_t a = vld1q_f32(coefsA + k);
+            float32x4_t coefs = vmlaq_n_f32(a, vsubq_f32(vld1q_f32(coefsB + k), a), t);
+            sum = vmlaq_f32(sum, vld1q_f32(frames + k), coefs);
+        }
+
+        framesOut[i*2] = vgetq_lane_f32(sum, 0) + vgetq_lane_f32(sum, 2);
+        framesOut[i*2 + 1] = vgetq_lane_f32(sum, 1) + vgetq_lane_f32(sum, 3);
+#else
+        for (ma_uint32 c = 0; c < channels; c++) framesOut[i*channels + c] = 0.0f;
+
+        for (int k = 0; k < coefCount; k++)
+        {
+            float coef = coefsA[k] + (coefsB[k] - coefsA[k])*t;
+            framesOut[i*channels + k%channels] += frames[k]*coef;
         }
+#endif
     }
 
-    return totalOutputFramesProcessed;
+    return position;
 }
 
 // Sending audio data to device callback function
@@ -2498,6 +3325,29 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
             // Ignore stopped or paused sounds
             if (!audioBuffer->playing || audioBuffer->paused) continue;
 
+            // Sounds on muted buses only advance their play position
+            if ((audioBuffer->usage == AUDIO_BUFFER_USAGE_STATIC) && AUDIO.Bus[audioBuffer->bus].muted)
+            {
+                SkipAudioBufferFramesInLockedState(audioBuffer, frameCount);
+                continue;
+            }
+
+            if (audioBuffer->spatial)
+            {
+                UpdateAudioBufferSpatialInLockedState(audioBuffer);
+
+                // Virtualized sounds only advance their play position
+                if ((audioBuffer->usage == AUDIO_BUFFER_USAGE_STATIC) && (audioBuffer->volume*audioBuffer->spatialVolume < AUDIO_SPATIAL_VIRTUAL_VOLUME))
+                {
+                    SkipAudioBufferFramesInLockedState(audioBuffer, frameCount);
+                    continue;
+                }
+            }
+
+            // Buffers routed to submix buses are mixed into the bus frames
+            float *mixFramesOut = (audioBuffer->bus > 0)? GetAudioBusFramesInLockedState(audioBuffer->bus, frameCount) : (float *)pFramesOut;
+            if (mixFramesOut == NULL) mixFramesOut = (float *)pFramesOut;
+
             ma_uint32 framesRead = 0;
 
             while (1)
@@ -2520,7 +3370,7 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
                     ma_uint32 framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, tempBuffer, framesToReadRightNow);
                     if (framesJustRead > 0)
                     {
-                        float *framesOut = (float *)pFramesOut + (framesRead*AUDIO.System.device.playback.channels);
+                        float *framesOut = mixFramesOut + (framesRead*AUDIO.System.device.playback.channels);
                         float *framesIn = tempBuffer;
 
                         // Apply processors chain if defined
@@ -2568,7 +3418,45 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
         }
     }
 
-    rAudioProcessor *processor = AUDIO.mixedProcessor;
+    // Submix buses: processors run once over bus frames, result is added to main mix
+    // NOTE: Buses with processors are processed even without playing buffers, to keep effect tails
+    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+
+    for (int bus = 1; bus < MAX_AUDIO_BUSES; bus++)
+    {
+        if (!AUDIO.Bus[bus].active && ((AUDIO.Bus[bus].processor == NULL) || AUDIO.Bus[bus].muted)) continue;
+
+        float *busFrames = GetAudioBusFramesInLockedState(bus, frameCount);
+        AUDIO.Bus[bus].active = false;
+
+        if ((busFrames == NULL) || AUDIO.Bus[bus].muted) continue;
+
+        rAudioProcessor *processor = AUDIO.Bus[bus].processor;
+        while (processor)
+        {
+            processor->process(busFrames, frameCount);
+            processor = processor->next;
+        }
+
+        const float volume = AUDIO.Bus[bus].volume;
+        for (ma_uint32 i = 0; i < frameCount*channels; i++) ((float *)pFramesOut)[i] += busFrames[i]*volume;
+    }
+
+    // Main mix bus
+    rAudioProcessor *processor = AUDIO.Bus[0].processor;
+    while (processor)
+    {
+        processor->process(pFramesOut, frameCount);
+        processor = processor->next;
+    }
+
+    if (AUDIO.Bus[0].muted) memset(pFramesOut, 0, frameCount*channels*sizeof(float));
+    else if (AUDIO.Bus[0].volume != 1.0f)
+    {
+        for (ma_uint32 i = 0; i < frameCount*channels; i++) ((float *)pFramesOut)[i] *= AUDIO.Bus[0].volume;
+    }
+
+    processor = AUDIO.mixedProcessor;
     while (processor)
     {
         processor->process(pFramesOut, frameCount);
@@ -2582,12 +3470,12 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
 // NOTE: framesOut is both an input and an output, it is initially filled with zeros outside of this function
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer)
 {
-    const float localVolume = buffer->volume;
+    const float localVolume = buffer->volume*buffer->spatialVolume;
     const ma_uint32 channels = AUDIO.System.device.playback.channels;
 
     if (channels == 2)  // We consider panning
     {
-        const float left = buffer->pan;
+        const float left = buffer->spatial? buffer->spatialPan : buffer->pan;
         const float right = 1.0f - left;
 
         // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
@@ -2621,6 +3509,220 @@ static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 fr
     }
 }
 
+#if defined(SUPPORT_FILEFORMAT_QOA)
+// Load sound from compressed data, sound takes ownership of provided data
+// NOTE: Frames at sound start are decoded once, so starting a sound does not require decoding
+static rl_Sound LoadSoundFromCompressedData(AudioCompressedData *compressed)
+{
+    rl_Sound sound = { 0 };
+
+    // Compressed data is decoded to s16 and converted to device format by the buffer converter on mixing
+    AudioBuffer *audioBuffer = LoadAudioBuffer(ma_format_s16, compressed->desc.channels, compressed->desc.samplerate, 0, AUDIO_BUFFER_USAGE_STATIC);
+
+    if (audioBuffer == NULL)
+    {
+        TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
+        RL_FREE(compressed->data);
+        RL_FREE(compressed);
+        return sound;
+    }
+
+    compressed->prefixFrames = AUDIO_SOUND_PREFIX_FRAMES;
+    if (compressed->prefixFrames > QOA_FRAME_LEN) compressed->prefixFrames = QOA_FRAME_LEN;
+    if (compressed->prefixFrames > compressed->desc.samples) compressed->prefixFrames = compressed->desc.samples;
+
+    if (compressed->prefixFrames > 0)
+    {
+        short *firstFrame = (short *)RL_MALLOC(QOA_FRAME_LEN*compressed->desc.channels*sizeof(short));
+        qoa_desc desc = compressed->desc;
+        unsigned int frameLen = 0;
+
+        // NOTE: Without decoded prefix, first frames are decoded on mixing as any other frame
+        if (firstFrame != NULL) qoa_decode_frame(compressed->data + 8, compressed->dataSize - 8, &desc, firstFrame, &frameLen);
+        else TRACELOG(LOG_WARNING, "SOUND: Failed to allocate compressed sound prefix frames");
+
+        if (frameLen < compressed->prefixFrames) compressed->prefixFrames = frameLen;
+
+        if (compressed->prefixFrames > 0)
+        {
+            short *prefix = (short *)RL_REALLOC(firstFrame, compressed->prefixFrames*compressed->desc.channels*sizeof(short));
+            compressed->prefix = (prefix != NULL)? prefix : firstFrame;
+        }
+        else RL_FREE(firstFrame);
+    }
+
+    audioBuffer->sizeInFrames = compressed->desc.samples;
+    audioBuffer->decodedFrameIndex = -1;
+
+    // NOTE: Buffer is already tracked by the mixer, assign compressed data in locked state
+    ma_mutex_lock(&AUDIO.System.lock);
+    audioBuffer->compressed = compressed;
+    ma_mutex_unlock(&AUDIO.System.lock);
+
+    sound.frameCount = compressed->desc.samples;
+    sound.stream.sampleRate = compressed->desc.samplerate;
+    sound.stream.sampleSize = 16;
+    sound.stream.channels = compressed->desc.channels;
+    sound.stream.buffer = audioBuffer;
+
+    TRACELOG(LOG_INFO, "SOUND: Compressed data loaded successfully (%i Hz, %i channels, %i frames, %i bytes)", sound.stream.sampleRate, sound.stream.channels, sound.frameCount, compressed->dataSize);
+
+    return sound;
+}
+
+// Read frames from compressed audio buffer in internal format (s16), decoding QOA frames as required
+// NOTE: Every QOA frame can be decoded independently, frames are located by index (all frames but last have max size)
+static void ReadAudioBufferCompressedFrames(AudioBuffer *audioBuffer, short *framesOut, ma_uint32 framePos, ma_uint32 frameCount)
+{
+    AudioCompressedData *compressed = audioBuffer->compressed;
+    const unsigned int channels = compressed->desc.channels;
+
+    while (frameCount > 0)
+    {
+        const short *framesIn = NULL;
+        ma_uint32 framesAvailable = 0;
+
+        if (framePos < compressed->prefixFrames)
+        {
+            framesIn = compressed->prefix + framePos*channels;
+            framesAvailable = compressed->prefixFrames - framePos;
+        }
+        else if (audioBuffer->decodedFrames != NULL)
+        {
+            int frameIndex = framePos/QOA_FRAME_LEN;
+
+            if (frameIndex != audioBuffer->decodedFrameIndex)
+            {
+                qoa_desc desc = compressed->desc;
+                unsigned int offset = 8 + frameIndex*qoa_max_frame_size(&desc);
+                unsigned int frameLen = 0;
+
+                if (offset < compressed->dataSize) qoa_decode_frame(compressed->data + offset, compressed->dataSize - offset, &desc, audioBuffer->decodedFrames, &frameLen);
+
+                // Zero-fill in case of corrupted frames
+                if (frameLen < QOA_FRAME_LEN) memset(audioBuffer->decodedFrames + frameLen*channels, 0, (QOA_FRAME_LEN - frameLen)*channels*sizeof(short));
+
+                audioBuffer->decodedFrameIndex = frameIndex;
+            }
+
+            framesIn = audioBuffer->decodedFrames + (framePos - frameIndex*QOA_FRAME_LEN)*channels;
+            framesAvailable = (frameIndex + 1)*QOA_FRAME_LEN - framePos;
+        }
+        else
+        {
+            // No scratch buffer available (buffer not started with PlayAudioBuffer()), output silence
+            memset(framesOut, 0, frameCount*channels*sizeof(short));
+            break;
+        }
+
+        if (framesAvailable > frameCount) framesAvailable = frameCount;
+
+        memcpy(framesOut, framesIn, framesAvailable*channels*sizeof(short));
+
+        framesOut += framesAvailable*channels;
+        framePos += framesAvailable;
+        frameCount -= framesAvailable;
+    }
+}
+#endif
+
+// Update audio buffer spatial volume, pan and doppler from listener, assuming the audio system mutex has been locked
+// NOTE: Computed once per mixing callback, attenuation follows inverse distance faded to silence at maxDistance
+static void UpdateAudioBufferSpatialInLockedState(AudioBuffer *buffer)
+{
+    rl_Vector3 direction = { buffer->position.x - AUDIO.Listener.position.x, buffer->position.y - AUDIO.Listener.position.y, buffer->position.z - AUDIO.Listener.position.z };
+    float distance = sqrtf(direction.x*direction.x + direction.y*direction.y + direction.z*direction.z);
+
+    float volume = 1.0f;
+    float pan = 0.5f;
+    float doppler = 1.0f;
+
+    if (distance >= buffer->maxDistance) volume = 0.0f;
+    else if (distance > buffer->minDistance) volume = (buffer->minDistance/distance)*(buffer->maxDistance - distance)/(buffer->maxDistance - buffer->minDistance);
+
+    if (distance > 0.0001f)
+    {
+        direction.x /= distance;
+        direction.y /= distance;
+        direction.z /= distance;
+
+        // NOTE: Mixer pan 1.0f is full left channel
+        pan = 0.5f - 0.5f*(direction.x*AUDIO.Listener.right.x + direction.y*AUDIO.Listener.right.y + direction.z*AUDIO.Listener.right.z);
+
+        // Doppler: relative velocities along listener to sound direction, limited to avoid extreme pitches
+        const float speed = AUDIO_SPATIAL_SPEED_OF_SOUND;
+        float listenerSpeed = direction.x*AUDIO.Listener.velocity.x + direction.y*AUDIO.Listener.velocity.y + direction.z*AUDIO.Listener.velocity.z;
+        float soundSpeed = direction.x*buffer->velocity.x + direction.y*buffer->velocity.y + direction.z*buffer->velocity.z;
+
+        if (listenerSpeed < -0.5f*speed) listenerSpeed = -0.5f*speed;
+        else if (listenerSpeed > 0.5f*speed) listenerSpeed = 0.5f*speed;
+        if (soundSpeed < -0.5f*speed) soundSpeed = -0.5f*speed;
+        else if (soundSpeed > 0.5f*speed) soundSpeed = 0.5f*speed;
+
+        doppler = (speed + listenerSpeed)/(speed + soundSpeed);
+    }
+
+    buffer->spatialVolume = volume;
+    buffer->spatialPan = pan;
+
+    buffer->doppler = doppler;      // Mixer resampler ratio is computed from doppler on mixing
+}
+
+// Advance audio buffer play position as if frames were mixed, assuming the audio system mutex has been locked
+// NOTE: Only valid for static buffers, position advance considers sample rate conversion, pitch and doppler,
+// fractional frames are kept on resampler position, so repeated skips do not drift
+static void SkipAudioBufferFramesInLockedState(AudioBuffer *buffer, ma_uint32 frameCount)
+{
+    if (buffer->sizeInFrames == 0) return;
+
+    ma_uint64 step = (ma_uint64)(GetAudioBufferResamplerRatio(buffer)*4294967296.0);
+    ma_uint64 position = buffer->resamplerPosition + (ma_uint64)frameCount*step;
+
+    // Play position (next output frame) is behind read cursor by the resampler kept input frames
+    long long frameCursorPos = (long long)buffer->frameCursorPos - buffer->resamplerFrameCount + (AUDIO_RESAMPLER_TAPS/2 - 1) + (long long)(position >> 32);
+
+    if (frameCursorPos < 0) frameCursorPos = buffer->looping? (frameCursorPos%buffer->sizeInFrames + buffer->sizeInFrames)%buffer->sizeInFrames : 0;
+    else if (frameCursorPos >= buffer->sizeInFrames)
+    {
+        if (buffer->looping) frameCursorPos %= buffer->sizeInFrames;
+        else
+        {
+            StopAudioBufferInLockedState(buffer);
+            return;
+        }
+    }
+
+    buffer->frameCursorPos = (unsigned int)frameCursorPos;
+
+    // Kept input frames are not contiguous to new position, fractional position is kept
+    ResetAudioBufferResampler(buffer);
+    buffer->resamplerPosition = position & 0xffffffff;
+}
+
+// Get bus mixing frames, assuming the audio system mutex has been locked
+// NOTE: Frames are cleared on first request on every mixing, bus frames storage only grows
+static float *GetAudioBusFramesInLockedState(int bus, ma_uint32 frameCount)
+{
+    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+
+    if (!AUDIO.Bus[bus].active)
+    {
+        if (frameCount > AUDIO.Bus[bus].framesCapacity)
+        {
+            float *frames = (float *)RL_REALLOC(AUDIO.Bus[bus].frames, frameCount*channels*sizeof(float));
+            if (frames == NULL) return NULL;
+
+            AUDIO.Bus[bus].frames = frames;
+            AUDIO.Bus[bus].framesCapacity = frameCount;
+        }
+
+        memset(AUDIO.Bus[bus].frames, 0, frameCount*channels*sizeof(float));
+        AUDIO.Bus[bus].active = true;
+    }
+
+    return AUDIO.Bus[bus].frames;
+}
+
 // Check if an audio buffer is playing, assuming the audio system mutex has been locked
 static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer)
 {
@@ -262,6 +262,15 @@ typedef struct rl_Image {
     int format;             // Data format (PixelFormat type)
 } rl_Image;
 
+// rl_ImageAnimation, animated image frames decoded on demand (streaming)
+typedef struct rl_ImageAnimation {
+    rl_Image image;            // Current frame image data (RGBA, full canvas size)
+    int frameCount;         // Total number of frames
+    int currentFrame;       // Current decoded frame index
+    int *frameDelays;       // Frames delay (milliseconds)
+    void *ctxData;          // Decoder context data (internal)
+} rl_ImageAnimation;
+
 // rl_Texture, tex data stored in GPU memory (VRAM)
 typedef struct rl_Texture {
     unsigned int id;        // OpenGL texture id
@@ -277,6 +286,27 @@ typedef rl_Texture rl_Texture2D;
 // rl_TextureCubemap, same as rl_Texture
 typedef rl_Texture rl_TextureCubemap;
 
+// rl_ImageTexture, image data in CPU memory (RAM) kept in sync with a texture in GPU memory (VRAM)
+// NOTE: Image regions modified by rl_ImageDraw*() functions are tracked and uploaded on update
+// WARNING: Regions tracking is not thread-safe, image textures must be loaded, modified and updated on the same thread
+typedef struct rl_ImageTexture {
+    rl_Image image;         // rl_Image data, modified with rl_ImageDraw*() functions
+    rl_Texture texture;     // rl_Texture updated from image modified regions
+} rl_ImageTexture;
+
+// rl_VirtualTexture, huge texture streamed by tiles on demand, only tiles in use are kept in GPU memory (VRAM)
+// NOTE: Tiles are stored in cache texture with a 1 pixel border, indirection texture pixel for every level 0 tile:
+// r, g: cache tile position (in tiles), b: tile level resident (coarser level if tile is not resident), a: 255
+typedef struct rl_VirtualTexture {
+    int width;              // Virtual texture base width
+    int height;             // Virtual texture base height
+    int tileSize;           // Tile size, in pixels (without border)
+    int levels;             // Mipmap levels tiled
+    rl_Texture cache;       // Resident tiles cache texture (R8G8B8A8)
+    rl_Texture indirection; // Indirection texture, one pixel per level 0 tile (R8G8B8A8)
+    void *ctxData;          // Tiles streaming context data
+} rl_VirtualTexture;
+
 // rl_RenderTexture, fbo for texture rendering
 typedef struct rl_RenderTexture {
     unsigned int id;        // OpenGL framebuffer object id
@@ -409,13 +439,30 @@ typedef struct rl_Model {
     rl_Transform *bindPose;    // Bones base transformation (pose)
 } rl_Model;
 
+// rl_BoneTrack, sparse bone animation keyframes (parent-relative space)
+typedef struct rl_BoneTrack {
+    int translationCount;       // Number of translation keyframes
+    int rotationCount;          // Number of rotation keyframes
+    int scaleCount;             // Number of scale keyframes
+    float *translationTimes;    // Translation keyframes time (seconds)
+    float *rotationTimes;       // Rotation keyframes time (seconds)
+    float *scaleTimes;          // Scale keyframes time (seconds)
+    rl_Vector3 *translations;   // Translation keyframes values
+    Quaternion *rotations;      // Rotation keyframes values
+    rl_Vector3 *scales;         // Scale keyframes values
+} rl_BoneTrack;
+
 // rl_ModelAnimation
+// NOTE: Animations loaded from files (IQM, M3D, glTF) are sampled from keyframe tracks, framePoses is NULL,
+// use rl_GetModelAnimationPose() to get a frame pose instead of reading framePoses[frame]
 typedef struct rl_ModelAnimation {
     int boneCount;          // Number of bones
     int frameCount;         // Number of animation frames
     rl_BoneInfo *bones;        // Bones information (skeleton)
-    rl_Transform **framePoses; // Poses array by frame
+    rl_Transform **framePoses; // Poses array by frame (NULL if animation is sampled from tracks)
     char name[32];          // Animation name
+    float duration;         // Animation duration (seconds)
+    rl_BoneTrack *tracks;      // Bones keyframe tracks (one per bone)
 } rl_ModelAnimation;
 
 // rl_Ray, ray for raycasting
@@ -478,6 +525,16 @@ typedef struct rl_Music {
     void *ctxData;              // Audio context data, depends on type
 } rl_Music;
 
+// rl_Video, video frames decoded on loader threads and streamed to a texture
+typedef struct rl_Video {
+    rl_Texture texture;         // Current frame texture (R8G8B8A8)
+    rl_Music music;             // Audio track music stream, used as playback clock (not ready if video has no audio)
+    int frameCount;             // Total number of frames
+    float frameRate;            // Frames per second
+    bool looping;               // Video looping enable
+    void *ctxData;              // Video decoding context data (internal)
+} rl_Video;
+
 // rl_VrDeviceInfo, Head-Mounted-Display device parameters
 typedef struct rl_VrDeviceInfo {
     int hResolution;                // Horizontal resolution in pixels
@@ -524,6 +581,16 @@ typedef struct rl_AutomationEventList {
     rl_AutomationEvent *events;        // Events entries
 } rl_AutomationEventList;
 
+// Spline, control points and cached flattened points
+typedef struct rl_Spline {
+    int type;                   // Spline type (SplineType)
+    int pointCount;             // Number of control points
+    rl_Vector2 *points;         // Control points (copied on load/update)
+    int flatCount;              // Number of flattened points (0: requires flattening)
+    rl_Vector2 *flatPoints;     // Flattened points, reused while control points and scale do not change
+    float flatTolerance;        // Flattening tolerance used (spline units)
+} rl_Spline;
+
 //----------------------------------------------------------------------------------
 // Enumerators Definition
 //----------------------------------------------------------------------------------
@@ -876,6 +943,13 @@ typedef enum {
     CUBEMAP_LAYOUT_PANORAMA                 // Layout is defined by a panorama image (equirrectangular map)
 } CubemapLayout;
 
+// Noise types, used by rl_GenImageNoise()
+typedef enum {
+    NOISE_PERLIN = 0,                       // Perlin gradient noise
+    NOISE_SIMPLEX,                          // Simplex gradient noise
+    NOISE_CELLULAR                          // Cellular noise (Worley), distance to nearest feature point
+} NoiseType;
+
 // rl_Font type, defines generation method
 typedef enum {
     FONT_DEFAULT = 0,               // Default font generation, anti-aliased
@@ -895,6 +969,29 @@ typedef enum {
     BLEND_CUSTOM_SEPARATE           // Blend textures using custom rgb/alpha separate src/dst factors (use rlSetBlendFactorsSeparate())
 } BlendMode;
 
+// Line joins, used by rl_DrawLineStripEx()
+typedef enum {
+    LINE_JOIN_MITER = 0,            // Line join: sharp corner (bevel over miter limit)
+    LINE_JOIN_BEVEL,                // Line join: corner cut flat
+    LINE_JOIN_ROUND                 // Line join: rounded corner
+} LineJoin;
+
+// Line caps, used by rl_DrawLineStripEx()
+typedef enum {
+    LINE_CAP_BUTT = 0,              // Line cap: flat, at the end point
+    LINE_CAP_SQUARE,                // Line cap: flat, extended by half thickness
+    LINE_CAP_ROUND                  // Line cap: rounded
+} LineCap;
+
+// Spline types, used by rl_LoadSpline()
+typedef enum {
+    SPLINE_LINEAR = 0,              // Spline linear, minimum 2 points: [p1, p2, p3...]
+    SPLINE_BASIS,                   // Spline B-Spline, minimum 4 points
+    SPLINE_CATMULLROM,              // Spline Catmull-Rom, minimum 4 points
+    SPLINE_BEZIER_QUADRATIC,        // Spline quadratic Bezier, minimum 3 points: [p1, c2, p3, c4, p5...]
+    SPLINE_BEZIER_CUBIC             // Spline cubic Bezier, minimum 4 points: [p1, c2, c3, p4, c5, c6, p7...]
+} SplineType;
+
 // Gesture
 // NOTE: Provided as bit-wise flags to enable only desired gestures
 typedef enum {
@@ -1093,7 +1190,8 @@ RLAPI void *rl_MemRealloc(void *ptr, unsigned int size);             // Internal
 RLAPI void rl_MemFree(void *ptr);                                    // Internal memory free
 
 // Set custom callbacks
-// WARNING: Callbacks setup is intended for advanced users
+// WARNING: Callbacks setup is intended for advanced users, callbacks can be called from loader threads
+// (i.e. files loaded by rl_LoadImageAsync() and glTF images) so they must be thread-safe
 RLAPI void rl_SetTraceLogCallback(TraceLogCallback callback);         // Set custom trace log
 RLAPI void rl_SetLoadFileDataCallback(LoadFileDataCallback callback); // Set custom file binary data loader
 RLAPI void rl_SetSaveFileDataCallback(SaveFileDataCallback callback); // Set custom file binary data saver
@@ -1103,6 +1201,11 @@ RLAPI void rl_SetSaveFileTextCallback(SaveFileTextCallback callback); // Set cus
 // Files management functions
 RLAPI unsigned char *rl_LoadFileData(const char *fileName, int *dataSize); // Load file data as byte array (read)
 RLAPI void rl_UnloadFileData(unsigned char *data);                   // Unload file data allocated by rl_LoadFileData()
+RLAPI unsigned char *rl_LoadFileDataMapped(const char *fileName, int *dataSize); // Load file data as memory mapped byte array (read), no heap copy when supported
+RLAPI void rl_UnloadFileDataMapped(unsigned char *data, int dataSize); // Unload file data mapped by rl_LoadFileDataMapped()
+RLAPI bool rl_MountPack(const char *fileName, const char *mountPath);  // Mount pack file, its files are loaded by file functions as if located at mountPath
+RLAPI void rl_UnmountPack(const char *fileName);                     // Unmount pack file
+RLAPI bool rl_ExportPack(const char *fileName, const char *dirPath, bool compress); // Export directory files (recursive) to a pack file (2GB max), returns true on success
 RLAPI bool rl_SaveFileData(const char *fileName, void *data, int dataSize); // Save data to file from byte array (write), returns true on success
 RLAPI bool rl_ExportDataAsCode(const unsigned char *data, int dataSize, const char *fileName); // Export data to code (.h), returns true on success
 RLAPI char *rl_LoadFileText(const char *fileName);                   // Load text data from file (read), returns a '\0' terminated string
@@ -1226,6 +1329,8 @@ RLAPI void rl_UpdateCameraPro(Camera *camera, rl_Vector3 movement, rl_Vector3 ro
 RLAPI void rl_SetShapesTexture(rl_Texture2D texture, rl_Rectangle source);       // Set texture and rectangle to be used on shapes drawing
 RLAPI rl_Texture2D GetShapesTexture(void);                                 // Get texture that is used for shapes drawing
 RLAPI rl_Rectangle GetShapesTextureRectangle(void);                        // Get texture source rectangle that is used for shapes drawing
+RLAPI void rl_BeginShapesSDFMode(void);                                    // Begin SDF shapes mode (circles, rings, rounded rectangles and thick lines drawn as anti-aliased quads)
+RLAPI void rl_EndShapesSDFMode(void);                                      // End SDF shapes mode (returns to shader active before mode)
 
 // Basic shapes drawing functions
 RLAPI void rl_DrawPixel(int posX, int posY, rl_Color color);                                                   // Draw a pixel
@@ -1234,6 +1339,7 @@ RLAPI void rl_DrawLine(int startPosX, int startPosY, int endPosX, int endPosY, r
 RLAPI void rl_DrawLineV(rl_Vector2 startPos, rl_Vector2 endPos, rl_Color color);                                     // Draw a line (using gl lines)
 RLAPI void rl_DrawLineEx(rl_Vector2 startPos, rl_Vector2 endPos, float thick, rl_Color color);                       // Draw a line (using triangles/quads)
 RLAPI void rl_DrawLineStrip(const rl_Vector2 *points, int pointCount, rl_Color color);                            // Draw lines sequence (using gl lines)
+RLAPI void rl_DrawLineStripEx(const rl_Vector2 *points, int pointCount, float thick, int join, int cap, rl_Color color); // Draw lines sequence with thickness, joins and caps (long strips expanded on GPU)
 RLAPI void rl_DrawLineBezier(rl_Vector2 startPos, rl_Vector2 endPos, float thick, rl_Color color);                   // Draw line segment cubic-bezier in-out interpolation
 RLAPI void rl_DrawCircle(int centerX, int centerY, float radius, rl_Color color);                              // Draw a color-filled circle
 RLAPI void rl_DrawCircleSector(rl_Vector2 center, float radius, float startAngle, float endAngle, int segments, rl_Color color);      // Draw a piece of a circle
@@ -1277,6 +1383,13 @@ RLAPI void rl_DrawSplineSegmentBasis(rl_Vector2 p1, rl_Vector2 p2, rl_Vector2 p3
 RLAPI void rl_DrawSplineSegmentCatmullRom(rl_Vector2 p1, rl_Vector2 p2, rl_Vector2 p3, rl_Vector2 p4, float thick, rl_Color color); // Draw spline segment: Catmull-Rom, 4 points
 RLAPI void rl_DrawSplineSegmentBezierQuadratic(rl_Vector2 p1, rl_Vector2 c2, rl_Vector2 p3, float thick, rl_Color color); // Draw spline segment: Quadratic Bezier, 2 points, 1 control point
 RLAPI void rl_DrawSplineSegmentBezierCubic(rl_Vector2 p1, rl_Vector2 c2, rl_Vector2 c3, rl_Vector2 p4, float thick, rl_Color color); // Draw spline segment: Cubic Bezier, 2 points, 2 control points
+RLAPI void rl_SetSplineTolerance(float tolerance);                                                            // Set splines flattening tolerance in pixels (0.0f: fixed segment divisions)
+
+// Spline retained functions, flattened geometry cached until control points or scale change
+RLAPI rl_Spline rl_LoadSpline(int type, const rl_Vector2 *points, int pointCount);                                // Load spline from control points (copied)
+RLAPI void rl_UpdateSpline(rl_Spline *spline, const rl_Vector2 *points, int pointCount);                          // Update spline control points, cache is invalidated only if they changed
+RLAPI void rl_UnloadSpline(rl_Spline spline);                                                                  // Unload spline control and flattened points
+RLAPI void rl_DrawSpline(rl_Spline *spline, float thick, rl_Color color);                                         // Draw spline, flattening it only if required
 
 // Spline segment point evaluation functions, for a given t [0.0f .. 1.0f]
 RLAPI rl_Vector2 GetSplinePointLinear(rl_Vector2 startPos, rl_Vector2 endPos, float t);                           // Get (evaluate) spline point: Linear
@@ -1309,14 +1422,26 @@ RLAPI rl_Image rl_LoadImageRaw(const char *fileName, int width, int height, int
 RLAPI rl_Image rl_LoadImageSvg(const char *fileNameOrString, int width, int height);                           // Load image from SVG file data or string with specified size
 RLAPI rl_Image rl_LoadImageAnim(const char *fileName, int *frames);                                            // Load image sequence from file (frames appended to image.data)
 RLAPI rl_Image LoadImageAnimFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int *frames); // Load image sequence from memory buffer
+RLAPI rl_ImageAnimation rl_LoadImageAnimation(const char *fileName);                                         // Load animated image for streaming frames decoding (frames decoded on demand)
+RLAPI rl_ImageAnimation rl_LoadImageAnimationFromMemory(const char *fileType, const unsigned char *fileData, int dataSize); // Load animated image for streaming from memory buffer
+RLAPI bool rl_IsImageAnimationReady(rl_ImageAnimation anim);                                                 // Check if an animated image is ready
+RLAPI void rl_UnloadImageAnimation(rl_ImageAnimation anim);                                                  // Unload animated image and decoder data
+RLAPI void rl_UpdateImageAnimation(rl_ImageAnimation *anim, int frame);                                      // Decode animated image frame into anim.image (next frame is decoded ahead on loader threads)
+RLAPI int rl_GetImageAnimationFrame(rl_ImageAnimation anim, float time);                                     // Get animated image frame index at time (seconds), using frames delay
 RLAPI rl_Image rl_LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize);      // Load image from memory buffer, fileType refers to extension: i.e. '.png'
 RLAPI rl_Image rl_LoadImageFromTexture(rl_Texture2D texture);                                                     // Load image from GPU texture data
 RLAPI rl_Image rl_LoadImageFromScreen(void);                                                                   // Load image from screen buffer and (screenshot)
+RLAPI int rl_LoadImageAsync(const char *fileName);                                                             // Load image from file on loader threads, returns async load id (-1 if loader queue is full)
+RLAPI bool rl_IsImageAsyncLoaded(int id);                                                                      // Check if async image loading has finished
+RLAPI rl_Image rl_WaitImageAsync(int id);                                                                      // Wait async image loading to finish and get image, async load id is released
+RLAPI float rl_GetLoadAsyncProgress(void);                                                                     // Get async images loading progress since async loading was idle (0.0f..1.0f)
 RLAPI bool rl_IsImageReady(rl_Image image);                                                                    // Check if an image is ready
 RLAPI void rl_UnloadImage(rl_Image image);                                                                     // Unload image from CPU memory (RAM)
 RLAPI bool rl_ExportImage(rl_Image image, const char *fileName);                                               // Export image data to file, returns true on success
 RLAPI unsigned char *rl_ExportImageToMemory(rl_Image image, const char *fileType, int *fileSize);              // Export image to memory buffer
+RLAPI void rl_SetImageExportCompression(int level);                                                            // Set PNG export compression level: 0 (none), 1-3 (fast, multithreaded), 4-9 (smaller files, default: 8)
 RLAPI bool rl_ExportImageAsCode(rl_Image image, const char *fileName);                                         // Export image as code file defining an array of bytes, returns true on success
+RLAPI bool rl_ExportImageTiles(rl_Image image, int tileSize, const char *fileName);                            // Export image as mipmapped tiles file for virtual texture streaming (tileSize power of two), returns true on success
 
 // rl_Image generation functions
 RLAPI rl_Image rl_GenImageColor(int width, int height, rl_Color color);                                           // Generate image: plain color
@@ -1327,6 +1452,7 @@ RLAPI rl_Image rl_GenImageChecked(int width, int height, int checksX, int checks
 RLAPI rl_Image rl_GenImageWhiteNoise(int width, int height, float factor);                                     // Generate image: white noise
 RLAPI rl_Image rl_GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale);           // Generate image: perlin noise
 RLAPI rl_Image rl_GenImageCellular(int width, int height, int tileSize);                                       // Generate image: cellular algorithm, bigger tileSize means bigger cells
+RLAPI rl_Image rl_GenImageNoise(int width, int height, int type, float scale, int octaves, int seed, bool tileable, int format); // Generate image: fractal noise (NoiseType), scale is cells along width
 RLAPI rl_Image rl_GenImageText(int width, int height, const char *text);                                       // Generate image: grayscale image from text data
 
 // rl_Image manipulation functions
@@ -1351,6 +1477,7 @@ RLAPI void rl_ImageDither(rl_Image *image, int rBpp, int gBpp, int bBpp, int aBp
 RLAPI void rl_ImageFlipVertical(rl_Image *image);                                                              // Flip image vertically
 RLAPI void rl_ImageFlipHorizontal(rl_Image *image);                                                            // Flip image horizontally
 RLAPI void rl_ImageRotate(rl_Image *image, int degrees);                                                       // Rotate image by input angle in degrees (-359 to 359)
+RLAPI void rl_ImageTransform(rl_Image *image, int newWidth, int newHeight, rl_Matrix transform);                // Apply affine transform to image (2d part of matrix), bilinear filtered
 RLAPI void rl_ImageRotateCW(rl_Image *image);                                                                  // Rotate image clockwise 90deg
 RLAPI void rl_ImageRotateCCW(rl_Image *image);                                                                 // Rotate image counter-clockwise 90deg
 RLAPI void ImageColorTint(rl_Image *image, rl_Color color);                                                    // Modify image color: tint
@@ -1363,7 +1490,13 @@ RLAPI rl_Color *rl_LoadImageColors(rl_Image image);
 RLAPI rl_Color *rl_LoadImagePalette(rl_Image image, int maxPaletteSize, int *colorCount);                         // Load colors palette from image as a rl_Color array (RGBA - 32bit)
 RLAPI void rl_UnloadImageColors(rl_Color *colors);                                                             // Unload color data loaded with rl_LoadImageColors()
 RLAPI void rl_UnloadImagePalette(rl_Color *colors);                                                            // Unload colors palette loaded with rl_LoadImagePalette()
+RLAPI rl_Color *rl_LoadImageColorsView(rl_Image image);                                                           // Load color data view from image (RGBA - 32bit), no copy for RGBA 32bit images
+RLAPI void rl_UnloadImageColorsView(rl_Image image, rl_Color *colors);                                            // Unload color data view loaded with rl_LoadImageColorsView()
+RLAPI const rl_Color *rl_GetImageColorsRow(rl_Image image, int y, rl_Color *buffer);                              // Get image row colors (RGBA - 32bit), no copy for RGBA 32bit images, other formats converted into buffer
 RLAPI rl_Rectangle rl_GetImageAlphaBorder(rl_Image image, float threshold);                                       // Get image alpha border rectangle
+RLAPI void rl_GetImageAlphaCoverage(rl_Image image, float threshold, int *rowCoverage, int *columnCoverage);   // Get image opaque pixels count per row and per column (arrays of image height and width, optional)
+RLAPI rl_Rectangle *rl_LoadImageAlphaRegions(rl_Image image, float threshold, int *regionCount);                 // Load image alpha regions, bounds of disjoint groups of opaque pixels (sprite-sheet slicing)
+RLAPI void rl_UnloadImageAlphaRegions(rl_Rectangle *regions);                                                  // Unload alpha regions loaded with rl_LoadImageAlphaRegions()
 RLAPI rl_Color rl_GetImageColor(rl_Image image, int x, int y);                                                    // Get image pixel color at (x, y) position
 
 // rl_Image drawing functions
@@ -1381,6 +1514,10 @@ RLAPI void rl_ImageDrawRectangle(rl_Image *dst, int posX, int posY, int width, i
 RLAPI void rl_ImageDrawRectangleV(rl_Image *dst, rl_Vector2 position, rl_Vector2 size, rl_Color color);                 // Draw rectangle within an image (Vector version)
 RLAPI void rl_ImageDrawRectangleRec(rl_Image *dst, rl_Rectangle rec, rl_Color color);                                // Draw rectangle within an image
 RLAPI void rl_ImageDrawRectangleLines(rl_Image *dst, rl_Rectangle rec, int thick, rl_Color color);                   // Draw rectangle lines within an image
+RLAPI void rl_ImageDrawLineEx(rl_Image *dst, rl_Vector2 start, rl_Vector2 end, float thick, rl_Color color);          // Draw line within an image with thickness, anti-aliased
+RLAPI void rl_ImageDrawCircleEx(rl_Image *dst, rl_Vector2 center, float radius, rl_Color color);                      // Draw a filled circle within an image, anti-aliased
+RLAPI void rl_ImageDrawTriangle(rl_Image *dst, rl_Vector2 v1, rl_Vector2 v2, rl_Vector2 v3, rl_Color color);           // Draw triangle within an image, anti-aliased
+RLAPI void rl_ImageDrawPolygon(rl_Image *dst, const rl_Vector2 *points, int pointCount, rl_Color color);              // Draw polygon (convex or concave) within an image, anti-aliased
 RLAPI void rl_ImageDraw(rl_Image *dst, rl_Image src, rl_Rectangle srcRec, rl_Rectangle dstRec, rl_Color tint);             // Draw a source image within a destination image (tint applied to source)
 RLAPI void rl_ImageDrawText(rl_Image *dst, const char *text, int posX, int posY, int fontSize, rl_Color color);   // Draw text (using default font) within an image (destination)
 RLAPI void rl_ImageDrawTextEx(rl_Image *dst, rl_Font font, const char *text, rl_Vector2 position, float fontSize, float spacing, rl_Color tint); // Draw text (custom sprite font) within an image (destination)
@@ -1397,6 +1534,14 @@ RLAPI bool rl_IsRenderTextureReady(rl_RenderTexture2D target);
 RLAPI void rl_UnloadRenderTexture(rl_RenderTexture2D target);                                                  // Unload render texture from GPU memory (VRAM)
 RLAPI void rl_UpdateTexture(rl_Texture2D texture, const void *pixels);                                         // Update GPU texture with new data
 RLAPI void rl_UpdateTextureRec(rl_Texture2D texture, rl_Rectangle rec, const void *pixels);                       // Update GPU texture rectangle with new data
+RLAPI rl_ImageTexture rl_LoadImageTexture(rl_Image image);                                                      // Load image texture from image data (image data ownership is taken), modified regions are tracked
+RLAPI void rl_UnloadImageTexture(rl_ImageTexture imageTexture);                                                // Unload image texture data from CPU and GPU memory
+RLAPI void rl_UpdateImageTexture(rl_ImageTexture *imageTexture);                                               // Update image texture, only image modified regions are uploaded to GPU
+RLAPI void rl_SetImageDirty(rl_Image image, rl_Rectangle rec);                                                 // Set image region as modified, required when image pixels are modified directly
+RLAPI rl_VirtualTexture rl_LoadVirtualTexture(const char *fileName, int cacheTiles);                           // Load virtual texture from tiles file, cache texture holds cacheTiles resident tiles
+RLAPI void rl_UnloadVirtualTexture(rl_VirtualTexture texture);                                                 // Unload virtual texture, pending tiles loads are finished
+RLAPI void rl_RequestVirtualTextureRec(rl_VirtualTexture *texture, rl_Rectangle source, float scale);          // Request virtual texture region tiles, level selected from scale (screen pixels per texel)
+RLAPI void rl_UpdateVirtualTexture(rl_VirtualTexture *texture);                                                // Update virtual texture: upload loaded tiles, load requested tiles and update indirection texture
 
 // rl_Texture configuration functions
 RLAPI void rl_GenTextureMipmaps(rl_Texture2D *texture);                                                        // Generate GPU mipmaps for a texture
@@ -1410,6 +1555,22 @@ RLAPI void rl_DrawTextureEx(rl_Texture2D texture, rl_Vector2 position, float rot
 RLAPI void rl_DrawTextureRec(rl_Texture2D texture, rl_Rectangle source, rl_Vector2 position, rl_Color tint);            // Draw a part of a texture defined by a rectangle
 RLAPI void rl_DrawTexturePro(rl_Texture2D texture, rl_Rectangle source, rl_Rectangle dest, rl_Vector2 origin, float rotation, rl_Color tint); // Draw a part of a texture defined by a rectangle with 'pro' parameters
 RLAPI void rl_DrawTextureNPatch(rl_Texture2D texture, rl_NPatchInfo nPatchInfo, rl_Rectangle dest, rl_Vector2 origin, float rotation, rl_Color tint); // Draws a texture (or part of it) that stretches or shrinks nicely
+RLAPI void rl_DrawVirtualTexture(rl_VirtualTexture texture, rl_Rectangle source, rl_Rectangle dest, rl_Color tint); // Draw a part of a virtual texture with resident tiles, missing tiles are requested
+
+// rl_Video loading and playback functions
+RLAPI bool rl_ExportVideo(const char *fileName, const rl_Image *frames, int frameCount, float frameRate, const char *audioFileName); // Export images as video file (.rvid), audio file embedded as audio track (optional), returns true on success
+RLAPI rl_Video rl_LoadVideo(const char *fileName);                                                             // Load video from file (.rvid), frames are streamed from file
+RLAPI bool rl_IsVideoReady(rl_Video video);                                                                    // Check if a video is ready
+RLAPI void rl_UnloadVideo(rl_Video video);                                                                     // Unload video, pending frames decoding is finished
+RLAPI void rl_PlayVideo(rl_Video video);                                                                       // Start video playing
+RLAPI bool rl_IsVideoPlaying(rl_Video video);                                                                  // Check if video is playing
+RLAPI void rl_UpdateVideo(rl_Video video);                                                                     // Update video texture with current frame and request next frames decoding, never waits decoding
+RLAPI void rl_StopVideo(rl_Video video);                                                                       // Stop video playing, video is rewound
+RLAPI void rl_PauseVideo(rl_Video video);                                                                      // Pause video playing
+RLAPI void rl_ResumeVideo(rl_Video video);                                                                     // Resume paused video playing
+RLAPI void rl_SeekVideo(rl_Video video, float position);                                                       // Seek video to a position (in seconds)
+RLAPI float rl_GetVideoTimeLength(rl_Video video);                                                             // Get video time length (in seconds)
+RLAPI float rl_GetVideoTimePlayed(rl_Video video);                                                             // Get current video time played (in seconds)
 
 // rl_Color/pixel related functions
 RLAPI bool ColorIsEqual(rl_Color col1, rl_Color col2);                            // Check if two colors are equal
@@ -1578,6 +1739,9 @@ RLAPI void rl_SetModelMeshMaterial(rl_Model *model, int meshId, int materialId);
 // rl_Model animations loading/unloading functions
 RLAPI rl_ModelAnimation *rl_LoadModelAnimations(const char *fileName, int *animCount);            // Load model animations from file
 RLAPI void rl_UpdateModelAnimation(rl_Model model, rl_ModelAnimation anim, int frame);               // Update model animation pose
+RLAPI void rl_UpdateModelAnimationTime(rl_Model model, rl_ModelAnimation anim, float time);         // Update model animation pose sampled at time (seconds)
+RLAPI void rl_UpdateModelAnimationBlend(rl_Model model, rl_ModelAnimation animA, float timeA, rl_ModelAnimation animB, float timeB, float blend); // Update model animation pose blending two animations
+RLAPI void rl_GetModelAnimationPose(rl_ModelAnimation anim, float time, rl_Transform *pose);        // Get animation bones pose (model space) sampled at time (seconds)
 RLAPI void rl_UnloadModelAnimation(rl_ModelAnimation anim);                                       // Unload animation data
 RLAPI void rl_UnloadModelAnimations(rl_ModelAnimation *animations, int animCount);                // Unload animation array data
 RLAPI bool rl_IsModelAnimationValid(rl_Model model, rl_ModelAnimation anim);                         // Check model animation skeleton match
@@ -1599,10 +1763,14 @@ typedef void (*AudioCallback)(void *bufferData, unsigned int frames);
 
 // Audio device management functions
 RLAPI void rl_InitAudioDevice(void);                                     // Initialize audio device and context
+RLAPI void rl_InitAudioDeviceOffline(int sampleRate);                    // Initialize audio context without device, mixing driven by rl_RenderAudio()
 RLAPI void rl_CloseAudioDevice(void);                                    // Close the audio device and context
 RLAPI bool rl_IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
 RLAPI void rl_SetMasterVolume(float volume);                             // Set master volume (listener)
 RLAPI float rl_GetMasterVolume(void);                                    // Get master volume (listener)
+RLAPI void rl_SetAudioListener(rl_Vector3 position, rl_Vector3 target, rl_Vector3 up, rl_Vector3 velocity); // Set listener position, orientation and velocity (spatial sounds)
+RLAPI int rl_RenderAudio(float *buffer, int frameCount);                 // Render mixed audio frames (32bit float, device channels) into buffer, offline mode only
+RLAPI rl_Wave rl_RenderAudioWave(int frameCount);                         // Render mixed audio frames into a new wave (16bit), offline mode only
 
 // rl_Wave/rl_Sound loading/unloading functions
 RLAPI rl_Wave rl_LoadWave(const char *fileName);                            // Load wave data from file
@@ -1610,6 +1778,8 @@ RLAPI rl_Wave rl_LoadWaveFromMemory(const char *fileType, const unsigned char *f
 RLAPI bool rl_IsWaveReady(rl_Wave wave);                                    // Checks if wave data is ready
 RLAPI rl_Sound rl_LoadSound(const char *fileName);                          // Load sound from file
 RLAPI rl_Sound rl_LoadSoundFromWave(rl_Wave wave);                             // Load sound from wave data
+RLAPI rl_Sound rl_LoadSoundCompressed(const char *fileName);                   // Load sound from file keeping data compressed in memory (QOA), decoded while playing
+RLAPI rl_Sound rl_LoadSoundFromWaveCompressed(rl_Wave wave);                   // Load sound from wave data, compressed in memory (QOA), decoded while playing
 RLAPI rl_Sound rl_LoadSoundAlias(rl_Sound source);                             // Create a new sound that shares the same sample data as the source sound, does not own the sound data
 RLAPI bool rl_IsSoundReady(rl_Sound sound);                                 // Checks if a sound is ready
 RLAPI void rl_UpdateSound(rl_Sound sound, const void *data, int sampleCount); // Update sound buffer with new data
@@ -1628,6 +1798,9 @@ RLAPI bool rl_IsSoundPlaying(rl_Sound sound);                               // C
 RLAPI void rl_SetSoundVolume(rl_Sound sound, float volume);                 // Set volume for a sound (1.0 is max level)
 RLAPI void rl_SetSoundPitch(rl_Sound sound, float pitch);                   // Set pitch for a sound (1.0 is base level)
 RLAPI void rl_SetSoundPan(rl_Sound sound, float pan);                       // Set pan for a sound (0.5 is center)
+RLAPI void rl_SetSoundPosition(rl_Sound sound, rl_Vector3 position, rl_Vector3 velocity); // Set sound position and velocity, sound becomes spatial (volume, pan and pitch computed from listener)
+RLAPI void rl_SetSoundSpatial(rl_Sound sound, bool spatial);               // Set sound spatialization (enabled by rl_SetSoundPosition())
+RLAPI void rl_SetSoundSpatialRange(rl_Sound sound, float minDistance, float maxDistance); // Set spatial sound attenuation range (full volume until min, silent from max)
 RLAPI rl_Wave rl_WaveCopy(rl_Wave wave);                                       // Copy a wave to a new wave
 RLAPI void rl_WaveCrop(rl_Wave *wave, int initFrame, int finalFrame);       // Crop a wave to defined frames range
 RLAPI void rl_WaveFormat(rl_Wave *wave, int sampleRate, int sampleSize, int channels); // Convert wave data to desired format
@@ -1675,6 +1848,13 @@ RLAPI void rl_DetachAudioStreamProcessor(rl_AudioStream stream, AudioCallback pr
 RLAPI void rl_AttachAudioMixedProcessor(AudioCallback processor); // Attach audio stream processor to the entire audio pipeline, receives the samples as 'float'
 RLAPI void rl_DetachAudioMixedProcessor(AudioCallback processor); // Detach audio stream processor from the entire audio pipeline
 
+RLAPI void rl_SetSoundBus(rl_Sound sound, int bus);                       // Set sound output bus (0 is main mix, submix buses from 1)
+RLAPI void rl_SetAudioStreamBus(rl_AudioStream stream, int bus);          // Set audio stream output bus (0 is main mix, submix buses from 1)
+RLAPI void rl_SetAudioBusVolume(int bus, float volume);                  // Set volume for a submix bus (1.0 is max level)
+RLAPI void rl_SetAudioBusMute(int bus, bool mute);                       // Set mute state for a submix bus
+RLAPI void rl_AttachAudioBusProcessor(int bus, AudioCallback processor); // Attach audio processor to a submix bus, receives the bus mixed samples as 'float'
+RLAPI void rl_DetachAudioBusProcessor(int bus, AudioCallback processor); // Detach audio processor from a submix bus
+
 #if defined(__cplusplus)
 }
 #endif
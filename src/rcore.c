@@ -247,6 +247,14 @@ unsigned int __stdcall timeEndPeriod(unsigned int uPeriod);
     #define MAX_AUTOMATION_EVENTS      16384        // Maximum number of automation events to record
 #endif
 
+#ifndef MAX_SCREENSHOT_JOBS
+    #define MAX_SCREENSHOT_JOBS            4        // Maximum number of screenshots saved at the same time (on loader threads)
+#endif
+
+#ifndef SCREENSHOT_FILE_EXTENSION
+    #define SCREENSHOT_FILE_EXTENSION   ".png"      // Automatic screenshots file extension, ".qoi" encodes much faster than PNG
+#endif
+
 // Flags operation macros
 #define FLAG_SET(n, f) ((n) |= (f))
 #define FLAG_CLEAR(n, f) ((n) &= ~(f))
@@ -355,6 +363,14 @@ typedef struct CoreData {
     } Time;
 } CoreData;
 
+#if defined(SUPPORT_MODULE_RTEXTURES)
+// Screenshot saving job, image is encoded and saved on a loader thread
+typedef struct ScreenshotJob {
+    rl_Image image;                  // Screen pixels read
+    char path[512];                  // Screenshot file path
+} ScreenshotJob;
+#endif
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -366,6 +382,11 @@ CoreData CORE = { 0 };               // Global CORE state context
 static int screenshotCounter = 0;    // Screenshots counter
 #endif
 
+#if defined(SUPPORT_MODULE_RTEXTURES)
+static int screenshotJobs[MAX_SCREENSHOT_JOBS] = { 0 };    // Screenshots saving jobs ids, oldest first
+static int screenshotJobCount = 0;   // Screenshots saving jobs count
+#endif
+
 #if defined(SUPPORT_GIF_RECORDING)
 unsigned int gifFrameCounter = 0;    // GIF frames counter
 bool gifRecording = false;           // GIF recording state
@@ -470,6 +491,14 @@ extern void LoadFontDefault(void);      // [Module: text] Loads default font on
 extern void UnloadFontDefault(void);    // [Module: text] Unloads default font from GPU memory
 #endif
 
+#if defined(SUPPORT_MODULE_RSHAPES)
+extern void UnloadShapesCache(void);    // [Module: shapes] Unloads unit circle tables cache
+#endif
+
+#if defined(SUPPORT_MODULE_RMODELS)
+extern void UnloadShapeMeshesCache(void);   // [Module: models] Unloads basic 3d shapes retained meshes
+#endif
+
 extern int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 extern void ClosePlatform(void);        // Close platform
 
@@ -477,6 +506,10 @@ static void InitTimer(void);                                // Initialize timer,
 static void SetupFramebuffer(int width, int height);        // Setup main framebuffer (required by InitPlatform())
 static void SetupViewport(int width, int height);           // Set viewport for a provided width and height
 
+#if defined(SUPPORT_MODULE_RTEXTURES)
+static void ExportScreenshotJob(void *userData);            // Export screenshot image and free it, run on loader threads
+#endif
+
 static void ScanDirectoryFiles(const char *basePath, rl_FilePathList *list, const char *filter);   // Scan all files and directories in a base path
 static void ScanDirectoryFilesRecursively(const char *basePath, rl_FilePathList *list, const char *filter);  // Scan all files and directories recursively from a base path
 
@@ -695,6 +728,22 @@ void rl_CloseWindow(void)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
 
+#if defined(SUPPORT_MODULE_RSHAPES)
+    UnloadShapesCache();        // WARNING: Module required: rshapes
+#endif
+
+#if defined(SUPPORT_MODULE_RMODELS)
+    UnloadShapeMeshesCache();   // WARNING: Module required: rmodels
+#endif
+
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    // Wait screenshots being saved
+    for (int i = 0; i < screenshotJobCount; i++) WaitLoaderJob(screenshotJobs[i]);
+    screenshotJobCount = 0;
+#endif
+
+    CloseLoaderThreads();       // Close loader threads, pending jobs are finished
+
     rlglClose();                // De-init rlgl
 
     // De-initialize platform
@@ -951,7 +1000,7 @@ void rl_EndDrawing(void)
         else
 #endif  // SUPPORT_GIF_RECORDING
         {
-            rl_TakeScreenshot(rl_TextFormat("screenshot%03i.png", screenshotCounter));
+            rl_TakeScreenshot(rl_TextFormat("screenshot%03i" SCREENSHOT_FILE_EXTENSION, screenshotCounter));
             screenshotCounter++;
         }
     }
@@ -1806,6 +1855,7 @@ void rl_UnloadRandomSequence(int *sequence)
 
 // Takes a screenshot of current screen
 // NOTE: Provided fileName should not contain paths, saving to working directory
+// NOTE: Screen is read on calling thread, image is encoded and saved on a loader thread
 void rl_TakeScreenshot(const char *fileName)
 {
 #if defined(SUPPORT_MODULE_RTEXTURES)
@@ -1814,16 +1864,40 @@ void rl_TakeScreenshot(const char *fileName)
 
     rl_Vector2 scale = rl_GetWindowScaleDPI();
     unsigned char *imgData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
-    rl_Image image = { imgData, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y), 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
 
-    char path[512] = { 0 };
-    strcpy(path, rl_TextFormat("%s/%s", CORE.Storage.basePath, rl_GetFileName(fileName)));
+    ScreenshotJob *job = (ScreenshotJob *)RL_CALLOC(1, sizeof(ScreenshotJob));
 
-    rl_ExportImage(image, path);           // WARNING: Module required: rtextures
-    RL_FREE(imgData);
+    if ((imgData == NULL) || (job == NULL))
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Failed to allocate screenshot data");
+        RL_FREE(imgData);
+        RL_FREE(job);
+        return;
+    }
+
+    job->image = (rl_Image){ imgData, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y), 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    strncpy(job->path, rl_TextFormat("%s/%s", CORE.Storage.basePath, rl_GetFileName(fileName)), sizeof(job->path) - 1);
+
+    // Release finished jobs, oldest job is waited if all jobs are running (screen pixels memory bounded)
+    int jobCount = 0;
+    for (int i = 0; i < screenshotJobCount; i++)
+    {
+        if (IsLoaderJobDone(screenshotJobs[i])) WaitLoaderJob(screenshotJobs[i]);
+        else screenshotJobs[jobCount++] = screenshotJobs[i];
+    }
+    screenshotJobCount = jobCount;
 
-    if (rl_FileExists(path)) TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", path);
-    else TRACELOG(LOG_WARNING, "SYSTEM: [%s] Screenshot could not be saved", path);
+    if (screenshotJobCount == MAX_SCREENSHOT_JOBS)
+    {
+        WaitLoaderJob(screenshotJobs[0]);
+        for (int i = 1; i < screenshotJobCount; i++) screenshotJobs[i - 1] = screenshotJobs[i];
+        screenshotJobCount--;
+    }
+
+    // NOTE: Screenshot is saved on calling thread if loader queue is full
+    int id = AddLoaderJob(ExportScreenshotJob, job);
+    if (id >= 0) screenshotJobs[screenshotJobCount++] = id;
+    else ExportScreenshotJob(job);
 #else
     TRACELOG(LOG_WARNING,"IMAGE: rl_ExportImage() requires module: rtextures");
 #endif
@@ -1855,6 +1929,9 @@ bool rl_FileExists(const char *fileName)
     if (access(fileName, F_OK) != -1) result = true;
 #endif
 
+    // Files in mounted pack files are also available for loading
+    if (!result) result = IsFileInPacks(fileName);
+
     // NOTE: Alternatively, stat() can be used instead of access()
     //#include <sys/stat.h>
     //struct stat statbuf;
@@ -2738,7 +2815,7 @@ void rl_PlayAutomationEvent(rl_AutomationEvent event)
     #if defined(SUPPORT_SCREEN_CAPTURE)
             case ACTION_TAKE_SCREENSHOT:
             {
-                rl_TakeScreenshot(rl_TextFormat("screenshot%03i.png", screenshotCounter));
+                rl_TakeScreenshot(rl_TextFormat("screenshot%03i" SCREENSHOT_FILE_EXTENSION, screenshotCounter));
                 screenshotCounter++;
             } break;
     #endif
@@ -3274,6 +3351,20 @@ void SetupFramebuffer(int width, int height)
     }
 }
 
+#if defined(SUPPORT_MODULE_RTEXTURES)
+// Export screenshot image and free it, run on loader threads
+static void ExportScreenshotJob(void *userData)
+{
+    ScreenshotJob *job = (ScreenshotJob *)userData;
+
+    if (rl_ExportImage(job->image, job->path)) TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", job->path);
+    else TRACELOG(LOG_WARNING, "SYSTEM: [%s] Screenshot could not be saved", job->path);
+
+    RL_FREE(job->image.data);
+    RL_FREE(job);
+}
+#endif
+
 // Scan all files and directories in a base path
 // WARNING: files.paths[] must be previously allocated and
 // contain enough space to store all required paths
@@ -604,6 +604,7 @@ RLAPI void rlVertex2f(float x, float y);                // Define one vertex (po
 RLAPI void rlVertex3f(float x, float y, float z);       // Define one vertex (position) - 3 float
 RLAPI void rlTexCoord2f(float x, float y);              // Define one vertex (texture coordinate) - 2 float
 RLAPI void rlNormal3f(float x, float y, float z);       // Define one vertex (normal) - 3 float
+RLAPI void rlNormal3fRaw(float x, float y, float z);    // Define one vertex (normal) - 3 float, not normalized or transformed (custom vertex data)
 RLAPI void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a); // Define one vertex (color) - 4 byte
 RLAPI void rlColor3f(float x, float y, float z);        // Define one vertex (color) - 3 float
 RLAPI void rlColor4f(float x, float y, float z, float w); // Define one vertex (color) - 4 float
@@ -654,6 +655,7 @@ RLAPI void rlEnableColorBlend(void);                    // Enable color blending
 RLAPI void rlDisableColorBlend(void);                   // Disable color blending
 RLAPI void rlEnableDepthTest(void);                     // Enable depth test
 RLAPI void rlDisableDepthTest(void);                    // Disable depth test
+RLAPI bool rlIsDepthTestEnabled(void);                  // Check if depth test is enabled (only tracked through rlgl)
 RLAPI void rlEnableDepthMask(void);                     // Enable depth write
 RLAPI void rlDisableDepthMask(void);                    // Disable depth write
 RLAPI void rlEnableBackfaceCulling(void);               // Enable backface culling
@@ -697,6 +699,9 @@ RLAPI int rlGetFramebufferHeight(void);                 // Get default framebuff
 RLAPI unsigned int rlGetTextureIdDefault(void);         // Get default texture id
 RLAPI unsigned int rlGetShaderIdDefault(void);          // Get default shader id
 RLAPI int *rlGetShaderLocsDefault(void);                // Get default shader locations
+RLAPI unsigned int rlGetShaderIdCurrent(void);          // Get current shader id (used by render batch)
+RLAPI int *rlGetShaderLocsCurrent(void);                // Get current shader locations
+RLAPI bool rlIsInstancingSupported(void);               // Check if hardware instancing is supported
 
 // Render batch management
 // NOTE: rlgl provides a default render batch to behave like OpenGL 1.1 immediate mode
@@ -707,6 +712,8 @@ RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);     // Draw render batch dat
 RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch); // Set the active render batch for rlgl (NULL for default internal)
 RLAPI void rlDrawRenderBatchActive(void);               // Update and draw internal render batch
 RLAPI bool rlCheckRenderBatchLimit(int vCount);         // Check internal buffer overflow for a given number of vertex
+RLAPI int rlGetRenderBatchVertexCount(void);           // Get vertices count added to active render batch since last draw
+RLAPI void rlSetRenderBatchDrawCallback(void (*callback)(void)); // Set callback called before render batch draw (external draw queues flush)
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
 
@@ -1033,6 +1040,8 @@ typedef struct rlglData {
         int *defaultShaderLocs;             // Default shader locations pointer to be used on rendering
         unsigned int currentShaderId;       // Current shader id to be used on rendering (by default, defaultShaderId)
         int *currentShaderLocs;             // Current shader locations pointer to be used on rendering (by default, defaultShaderLocs)
+        void (*renderBatchDrawCallback)(void);  // Callback called before render batch draw, flushes external draw queues
+        bool depthTest;                     // Depth test enabled flag (set by rlEnableDepthTest()/rlDisableDepthTest())
 
         bool stereoRender;                  // Stereo rendering flag
         rl_Matrix projectionStereo[2];         // VR stereo rendering eyes projection matrices
@@ -1412,6 +1421,7 @@ void rlVertex2f(float x, float y) { glVertex2f(x, y); }
 void rlVertex3f(float x, float y, float z) { glVertex3f(x, y, z); }
 void rlTexCoord2f(float x, float y) { glTexCoord2f(x, y); }
 void rlNormal3f(float x, float y, float z) { glNormal3f(x, y, z); }
+void rlNormal3fRaw(float x, float y, float z) { glNormal3f(x, y, z); }
 void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a) { glColor4ub(r, g, b, a); }
 void rlColor3f(float x, float y, float z) { glColor3f(x, y, z); }
 void rlColor4f(float x, float y, float z, float w) { glColor4f(x, y, z, w); }
@@ -1570,6 +1580,16 @@ void rlNormal3f(float x, float y, float z)
     RLGL.State.normalz = normalz;
 }
 
+// Define one vertex (normal), raw values
+// NOTE: Values are not normalized or transformed, useful to provide custom
+// per-vertex data to shaders through the normals buffer
+void rlNormal3fRaw(float x, float y, float z)
+{
+    RLGL.State.normalx = x;
+    RLGL.State.normaly = y;
+    RLGL.State.normalz = z;
+}
+
 // Define one vertex (color)
 void rlColor4ub(unsigned char x, unsigned char y, unsigned char z, unsigned char w)
 {
@@ -1899,10 +1919,33 @@ void rlEnableColorBlend(void) { glEnable(GL_BLEND); }
 void rlDisableColorBlend(void) { glDisable(GL_BLEND); }
 
 // Enable depth test
-void rlEnableDepthTest(void) { glEnable(GL_DEPTH_TEST); }
+void rlEnableDepthTest(void)
+{
+    glEnable(GL_DEPTH_TEST);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.depthTest = true;
+#endif
+}
 
 // Disable depth test
-void rlDisableDepthTest(void) { glDisable(GL_DEPTH_TEST); }
+void rlDisableDepthTest(void)
+{
+    glDisable(GL_DEPTH_TEST);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.depthTest = false;
+#endif
+}
+
+// Check if depth test is enabled
+// NOTE: Depth test state is only tracked when set through rlgl functions
+bool rlIsDepthTestEnabled(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return RLGL.State.depthTest;
+#else
+    return false;
+#endif
+}
 
 // Enable depth write
 void rlEnableDepthMask(void) { glDepthMask(GL_TRUE); }
@@ -2257,6 +2300,9 @@ void rlglInit(int width, int height)
     // Init state: Depth test
     glDepthFunc(GL_LEQUAL);                                 // Type of depth testing to apply
     glDisable(GL_DEPTH_TEST);                               // Disable depth testing for 2D (only used for 3D)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.depthTest = false;
+#endif
 
     // Init state: Blending mode
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);      // rl_Color blending function (how colors are mixed)
@@ -2666,6 +2712,36 @@ int *rlGetShaderLocsDefault(void)
     return locs;
 }
 
+// Get current shader id
+unsigned int rlGetShaderIdCurrent(void)
+{
+    unsigned int id = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    id = RLGL.State.currentShaderId;
+#endif
+    return id;
+}
+
+// Get current shader locations
+int *rlGetShaderLocsCurrent(void)
+{
+    int *locs = NULL;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    locs = RLGL.State.currentShaderLocs;
+#endif
+    return locs;
+}
+
+// Check if hardware instancing is supported
+bool rlIsInstancingSupported(void)
+{
+    bool supported = false;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    supported = RLGL.ExtSupported.instancing;
+#endif
+    return supported;
+}
+
 // Render batch management
 //------------------------------------------------------------------------------------------------
 // Load render batch
@@ -2852,6 +2928,10 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 void rlDrawRenderBatch(rlRenderBatch *batch)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Flush external draw queues (i.e. instanced 3d shapes) before batch vertex data,
+    // queued draws are expected to be issued after previous batch draw
+    if (RLGL.State.renderBatchDrawCallback != NULL) RLGL.State.renderBatchDrawCallback();
+
     // Update batch vertex buffers
     //------------------------------------------------------------------------------------------------------------
     // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
@@ -3092,6 +3172,28 @@ void rlDrawRenderBatchActive(void)
 #endif
 }
 
+// Set callback called before render batch draw
+// NOTE: Useful for modules queuing their own draw calls (i.e. instancing) between batch draws,
+// callback must not draw the render batch
+void rlSetRenderBatchDrawCallback(void (*callback)(void))
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.renderBatchDrawCallback = callback;
+#endif
+}
+
+// Get vertices count added to active render batch since last draw
+int rlGetRenderBatchVertexCount(void)
+{
+    int count = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    count = RLGL.State.vertexCounter;
+#endif
+
+    return count;
+}
+
 // Check internal buffer overflow for a given number of vertex
 // and force a rlRenderBatch draw call if required
 bool rlCheckRenderBatchLimit(int vCount)
@@ -3885,7 +3987,7 @@ void rlDrawVertexArrayElements(int offset, int count, const void *buffer)
 void rlDrawVertexArrayInstanced(int offset, int count, int instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+    glDrawArraysInstanced(GL_TRIANGLES, offset, count, instances);
 #endif
 }
 
@@ -18,6 +18,11 @@
 *           Support procedural mesh generation functions, uses external par_shapes.h library
 *           NOTE: Some generated meshes DO NOT include generated texture coordinates
 *
+*       #define SUPPORT_INSTANCED_SHAPES
+*           Basic 3d shapes (cube, sphere, cylinder, capsule) are drawn from retained unit meshes,
+*           instances queued and drawn together (instanced) on next render batch draw
+*           NOTE: Custom shaders or missing instancing support fall back to immediate mode drawing
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -132,16 +137,89 @@
 #ifndef MAX_MESH_VERTEX_BUFFERS
     #define MAX_MESH_VERTEX_BUFFERS  7    // Maximum vertex buffers (VBO) per mesh
 #endif
+#ifndef ANIMATION_KEYFRAME_TOLERANCE
+    #define ANIMATION_KEYFRAME_TOLERANCE  0.0001f   // Maximum error allowed on animation keyframes reduction
+#endif
+#ifndef ANIMATION_DEFAULT_FRAME_TIME
+    #define ANIMATION_DEFAULT_FRAME_TIME  (1.0f/60.0f)  // Baked animations frame time, when no duration is provided
+#endif
+#ifndef ANIMATION_POSES_STACK_BONES
+    #define ANIMATION_POSES_STACK_BONES  128  // Animation poses sampled on stack up to this bones count, bigger skeletons allocate their poses
+#endif
+#ifndef MAX_SHAPE_MESHES_CACHE
+    #define MAX_SHAPE_MESHES_CACHE   32   // Maximum basic 3d shapes tessellations retained as meshes
+#endif
+
+#define SHAPE_MESH_MAX_RINGS        255   // Maximum sphere shapes rings/slices (16 bit indices)
+#define SHAPE_MESH_MAX_SIDES       4096   // Maximum cylinder shapes sides
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+// glTF image loading job, images are decoded on loader threads
+typedef struct ImageLoadGLTF {
+    cgltf_image *cgltfImage;        // glTF image to load
+    const char *texPath;            // Textures base path
+    rl_Image image;                 // Image loaded
+    int jobId;                      // Loader job id (-1 if image already loaded)
+} ImageLoadGLTF;
+#endif
+
+// Basic 3d shape mesh types
+typedef enum {
+    SHAPE_MESH_CUBE = 0,            // Unit cube, centered at origin
+    SHAPE_MESH_SPHERE,              // Unit sphere, centered at origin
+    SHAPE_MESH_HEMISPHERE,          // Unit hemisphere, base centered at origin, pole at +Y
+    SHAPE_MESH_CYLINDER,            // Unit cylinder with caps, base centered at origin, top at +Y
+    SHAPE_MESH_TUBE                 // Unit cylinder without caps
+} ShapeMeshType;
+
+// Basic 3d shape instance, uploaded as per-instance vertex data
+typedef struct ShapeInstance {
+    float transform[12];            // Instance transform, matrix rows 0..2 (last row is 0, 0, 0, 1)
+    float taper;                    // Instance top radius scale (cylinder shapes, 1.0f for others)
+    unsigned char color[4];         // Instance color
+} ShapeInstance;
+
+// Basic 3d shape retained mesh, one per shape type and tessellation
+typedef struct ShapeMesh {
+    int type;                       // Shape mesh type (ShapeMeshType)
+    int rings;                      // Shape rings (sphere shapes)
+    int slices;                     // Shape slices (sphere and cylinder shapes)
+
+    int vertexCount;                // Number of vertices
+    int indexCount;                 // Number of triangle indices
+    float *vertices;                // Vertex position (XYZ - 3 components per vertex)
+    unsigned short *indices;        // Triangle indices
+
+    unsigned int vaoId;             // OpenGL Vertex Array Object id
+    unsigned int vboId[3];          // OpenGL Vertex Buffer Objects id (positions, indices, instances)
+    int vboInstanceCapacity;        // Instances buffer capacity (number of instances)
+
+    ShapeInstance *instances;       // Instances queued, drawn on next render batch draw
+    int instanceCount;              // Instances queued count
+    int instanceCapacity;           // Instances array capacity
+} ShapeMesh;
+
+// Basic 3d shapes instancing shader
+typedef struct ShapeShader {
+    unsigned int id;                // Shader program id (0 if not loaded, default shader id if loading failed)
+    int locPosition;                // Vertex position attribute location
+    int locTransform[3];            // Instance transform rows attributes location
+    int locTaper;                   // Instance taper attribute location
+    int locColor;                   // Instance color attribute location
+    int locMvp;                     // Model-view-projection matrix uniform location
+} ShapeShader;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// ...
+static ShapeMesh shapeMeshes[MAX_SHAPE_MESHES_CACHE] = { 0 };   // Basic 3d shapes retained meshes
+static int shapeMeshesCount = 0;            // Basic 3d shapes meshes in cache
+static int shapeMeshesNext = 0;             // Next shape mesh to be replaced, once cache is full
+static int shapeInstancesQueued = 0;        // Basic 3d shapes instances queued (all meshes)
+static ShapeShader shapeShader = { 0 };     // Basic 3d shapes instancing shader
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
@@ -156,6 +234,8 @@ static rl_ModelAnimation *LoadModelAnimationsIQM(const char *fileName, int *anim
 #if defined(SUPPORT_FILEFORMAT_GLTF)
 static rl_Model LoadGLTF(const char *fileName);    // Load GLTF mesh data
 static rl_ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *animCount);  // Load GLTF animation data
+static void LoadImageGLTFJob(void *userData);      // Load glTF image job, run on loader threads
+static rl_Image GetImageGLTF(ImageLoadGLTF *images, cgltf_data *data, cgltf_image *cgltfImage); // Get glTF image loaded, waiting for its loader job
 #endif
 #if defined(SUPPORT_FILEFORMAT_VOX)
 static rl_Model LoadVOX(const char *filename);     // Load VOX mesh data
@@ -164,8 +244,29 @@ static rl_Model LoadVOX(const char *filename);     // Load VOX mesh data
 static rl_Model LoadM3D(const char *filename);     // Load M3D mesh data
 static rl_ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCount);   // Load M3D animation data
 #endif
+static void BuildPoseFromParentJoints(rl_BoneInfo *bones, int boneCount, rl_Transform *transforms);   // Build pose from parent joints
+static void UpdateModelAnimationVertices(rl_Model model, const rl_Transform *pose);       // Update model animated vertex data for a bones pose
+static void GetModelAnimationLocalPose(rl_ModelAnimation anim, float time, rl_Transform *pose);   // Get animation bones local pose sampled at time
+static rl_Transform SampleBoneTrack(rl_BoneTrack track, float time);   // Sample bone track at time, returns local transform
+static float GetModelAnimationDuration(rl_ModelAnimation anim);   // Get animation duration, baked animations without duration use default frame time
+static rl_Transform *LoadAnimationPoses(int count, rl_Transform *stackPoses);   // Load animation poses buffer, stack buffer is used if count fits
+static void UnloadAnimationPoses(rl_Transform *poses, rl_Transform *stackPoses); // Unload animation poses buffer, if not stack buffer
+#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_M3D)
+static rl_BoneTrack *LoadBoneTracksFromPoses(rl_Transform **poses, int frameCount, int boneCount, float frameTime); // Load bones tracks from sampled poses
+#endif
+static int CompactKeyframes(float **times, float **values, int count, int components);    // Compact keyframes channel, reducing redundant keyframes
+static rl_Matrix GetShapeTransform(rl_Vector3 origin, rl_Vector3 axisX, rl_Vector3 axisY, rl_Vector3 axisZ); // Get shape transform from origin and local axis
+static ShapeMesh *LoadShapeMesh(int type, int rings, int slices);  // Load basic 3d shape mesh (cached)
+static void UnloadShapeMesh(ShapeMesh *mesh);                   // Unload basic 3d shape mesh (RAM and VRAM)
+static bool IsShapeInstancingAvailable(void);                   // Check if basic 3d shapes can be drawn instanced
+static void DrawShapeMesh(int type, int rings, int slices, rl_Matrix transform, float taper, rl_Color color); // Draw basic 3d shape mesh
+#if defined(SUPPORT_INSTANCED_SHAPES) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+static void DrawShapeMeshesInstanced(void);                     // Draw basic 3d shapes instances queued (render batch draw callback)
+static void SetShapeMeshAttributes(ShapeMesh *mesh);            // Set basic 3d shape mesh vertex and instance attributes
+#endif
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
 static void ProcessMaterialsOBJ(rl_Material *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
+static rl_Texture2D LoadTextureAsync(int imageId, const char *fileName);   // Load texture from image loaded async, image is loaded if not queued (imageId = -1)
 #endif
 
 //----------------------------------------------------------------------------------
@@ -255,80 +356,8 @@ void rl_DrawTriangleStrip3D(const rl_Vector3 *points, int pointCount, rl_Color c
 // NOTE: Cube position is the center position
 void rl_DrawCube(rl_Vector3 position, float width, float height, float length, rl_Color color)
 {
-    float x = 0.0f;
-    float y = 0.0f;
-    float z = 0.0f;
-
-    rlPushMatrix();
-        // NOTE: Transformation is applied in inverse order (scale -> rotate -> translate)
-        rlTranslatef(position.x, position.y, position.z);
-        //rlRotatef(45, 0, 1, 0);
-        //rlScalef(1.0f, 1.0f, 1.0f);   // NOTE: Vertices are directly scaled on definition
-
-        rlBegin(RL_TRIANGLES);
-            rlColor4ub(color.r, color.g, color.b, color.a);
-
-            // Front face
-            rlNormal3f(0.0f, 0.0f, 1.0f);
-            rlVertex3f(x - width/2, y - height/2, z + length/2);  // Bottom Left
-            rlVertex3f(x + width/2, y - height/2, z + length/2);  // Bottom Right
-            rlVertex3f(x - width/2, y + height/2, z + length/2);  // Top Left
-
-            rlVertex3f(x + width/2, y + height/2, z + length/2);  // Top Right
-            rlVertex3f(x - width/2, y + height/2, z + length/2);  // Top Left
-            rlVertex3f(x + width/2, y - height/2, z + length/2);  // Bottom Right
-
-            // Back face
-            rlNormal3f(0.0f, 0.0f, -1.0f);
-            rlVertex3f(x - width/2, y - height/2, z - length/2);  // Bottom Left
-            rlVertex3f(x - width/2, y + height/2, z - length/2);  // Top Left
-            rlVertex3f(x + width/2, y - height/2, z - length/2);  // Bottom Right
-
-            rlVertex3f(x + width/2, y + height/2, z - length/2);  // Top Right
-            rlVertex3f(x + width/2, y - height/2, z - length/2);  // Bottom Right
-            rlVertex3f(x - width/2, y + height/2, z - length/2);  // Top Left
-
-            // Top face
-            rlNormal3f(0.0f, 1.0f, 0.0f);
-            rlVertex3f(x - width/2, y + height/2, z - length/2);  // Top Left
-            rlVertex3f(x - width/2, y + height/2, z + length/2);  // Bottom Left
-            rlVertex3f(x + width/2, y + height/2, z + length/2);  // Bottom Right
-
-            rlVertex3f(x + width/2, y + height/2, z - length/2);  // Top Right
-            rlVertex3f(x - width/2, y + height/2, z - length/2);  // Top Left
-            rlVertex3f(x + width/2, y + height/2, z + length/2);  // Bottom Right
-
-            // Bottom face
-            rlNormal3f(0.0f, -1.0f, 0.0f);
-            rlVertex3f(x - width/2, y - height/2, z - length/2);  // Top Left
-            rlVertex3f(x + width/2, y - height/2, z + length/2);  // Bottom Right
-            rlVertex3f(x - width/2, y - height/2, z + length/2);  // Bottom Left
-
-            rlVertex3f(x + width/2, y - height/2, z - length/2);  // Top Right
-            rlVertex3f(x + width/2, y - height/2, z + length/2);  // Bottom Right
-            rlVertex3f(x - width/2, y - height/2, z - length/2);  // Top Left
-
-            // Right face
-            rlNormal3f(1.0f, 0.0f, 0.0f);
-            rlVertex3f(x + width/2, y - height/2, z - length/2);  // Bottom Right
-            rlVertex3f(x + width/2, y + height/2, z - length/2);  // Top Right
-            rlVertex3f(x + width/2, y + height/2, z + length/2);  // Top Left
-
-            rlVertex3f(x + width/2, y - height/2, z + length/2);  // Bottom Left
-            rlVertex3f(x + width/2, y - height/2, z - length/2);  // Bottom Right
-            rlVertex3f(x + width/2, y + height/2, z + length/2);  // Top Left
-
-            // Left face
-            rlNormal3f(-1.0f, 0.0f, 0.0f);
-            rlVertex3f(x - width/2, y - height/2, z - length/2);  // Bottom Right
-            rlVertex3f(x - width/2, y + height/2, z + length/2);  // Top Left
-            rlVertex3f(x - width/2, y + height/2, z - length/2);  // Top Right
-
-            rlVertex3f(x - width/2, y - height/2, z + length/2);  // Bottom Left
-            rlVertex3f(x - width/2, y + height/2, z + length/2);  // Top Left
-            rlVertex3f(x - width/2, y - height/2, z - length/2);  // Bottom Right
-        rlEnd();
-    rlPopMatrix();
+    DrawShapeMesh(SHAPE_MESH_CUBE, 0, 0, GetShapeTransform(position, (rl_Vector3){ width, 0.0f, 0.0f },
+        (rl_Vector3){ 0.0f, height, 0.0f }, (rl_Vector3){ 0.0f, 0.0f, length }), 1.0f, color);
 }
 
 // Draw cube (Vector version)
@@ -424,41 +453,8 @@ void rl_DrawSphere(rl_Vector3 centerPos, float radius, rl_Color color)
 // Draw sphere with extended parameters
 void rl_DrawSphereEx(rl_Vector3 centerPos, float radius, int rings, int slices, rl_Color color)
 {
-    rlPushMatrix();
-        // NOTE: Transformation is applied in inverse order (scale -> translate)
-        rlTranslatef(centerPos.x, centerPos.y, centerPos.z);
-        rlScalef(radius, radius, radius);
-
-        rlBegin(RL_TRIANGLES);
-            rlColor4ub(color.r, color.g, color.b, color.a);
-
-            for (int i = 0; i < (rings + 2); i++)
-            {
-                for (int j = 0; j < slices; j++)
-                {
-                    rlVertex3f(cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*i))*sinf(DEG2RAD*(360.0f*j/slices)),
-                               sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*i)),
-                               cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*i))*cosf(DEG2RAD*(360.0f*j/slices)));
-                    rlVertex3f(cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1)))*sinf(DEG2RAD*(360.0f*(j + 1)/slices)),
-                               sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1))),
-                               cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1)))*cosf(DEG2RAD*(360.0f*(j + 1)/slices)));
-                    rlVertex3f(cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1)))*sinf(DEG2RAD*(360.0f*j/slices)),
-                               sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1))),
-                               cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1)))*cosf(DEG2RAD*(360.0f*j/slices)));
-
-                    rlVertex3f(cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*i))*sinf(DEG2RAD*(360.0f*j/slices)),
-                               sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*i)),
-                               cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*i))*cosf(DEG2RAD*(360.0f*j/slices)));
-                    rlVertex3f(cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i)))*sinf(DEG2RAD*(360.0f*(j + 1)/slices)),
-                               sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i))),
-                               cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i)))*cosf(DEG2RAD*(360.0f*(j + 1)/slices)));
-                    rlVertex3f(cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1)))*sinf(DEG2RAD*(360.0f*(j + 1)/slices)),
-                               sinf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1))),
-                               cosf(DEG2RAD*(270 + (180.0f/(rings + 1))*(i + 1)))*cosf(DEG2RAD*(360.0f*(j + 1)/slices)));
-                }
-            }
-        rlEnd();
-    rlPopMatrix();
+    DrawShapeMesh(SHAPE_MESH_SPHERE, rings, slices, GetShapeTransform(centerPos, (rl_Vector3){ radius, 0.0f, 0.0f },
+        (rl_Vector3){ 0.0f, radius, 0.0f }, (rl_Vector3){ 0.0f, 0.0f, radius }), 1.0f, color);
 }
 
 // Draw sphere wires
@@ -508,57 +504,17 @@ void rl_DrawCylinder(rl_Vector3 position, float radiusTop, float radiusBottom, f
 {
     if (sides < 3) sides = 3;
 
-    const float angleStep = 360.0f/sides;
-
-    rlPushMatrix();
-        rlTranslatef(position.x, position.y, position.z);
-
-        rlBegin(RL_TRIANGLES);
-            rlColor4ub(color.r, color.g, color.b, color.a);
-
-            if (radiusTop > 0)
-            {
-                // Draw Body -------------------------------------------------------------------------------------
-                for (int i = 0; i < sides; i++)
-                {
-                    rlVertex3f(sinf(DEG2RAD*i*angleStep)*radiusBottom, 0, cosf(DEG2RAD*i*angleStep)*radiusBottom); //Bottom Left
-                    rlVertex3f(sinf(DEG2RAD*(i+1)*angleStep)*radiusBottom, 0, cosf(DEG2RAD*(i+1)*angleStep)*radiusBottom); //Bottom Right
-                    rlVertex3f(sinf(DEG2RAD*(i+1)*angleStep)*radiusTop, height, cosf(DEG2RAD*(i+1)*angleStep)*radiusTop); //Top Right
-
-                    rlVertex3f(sinf(DEG2RAD*i*angleStep)*radiusTop, height, cosf(DEG2RAD*i*angleStep)*radiusTop); //Top Left
-                    rlVertex3f(sinf(DEG2RAD*i*angleStep)*radiusBottom, 0, cosf(DEG2RAD*i*angleStep)*radiusBottom); //Bottom Left
-                    rlVertex3f(sinf(DEG2RAD*(i+1)*angleStep)*radiusTop, height, cosf(DEG2RAD*(i+1)*angleStep)*radiusTop); //Top Right
-                }
-
-                // Draw Cap --------------------------------------------------------------------------------------
-                for (int i = 0; i < sides; i++)
-                {
-                    rlVertex3f(0, height, 0);
-                    rlVertex3f(sinf(DEG2RAD*i*angleStep)*radiusTop, height, cosf(DEG2RAD*i*angleStep)*radiusTop);
-                    rlVertex3f(sinf(DEG2RAD*(i+1)*angleStep)*radiusTop, height, cosf(DEG2RAD*(i+1)*angleStep)*radiusTop);
-                }
-            }
-            else
-            {
-                // Draw Cone -------------------------------------------------------------------------------------
-                for (int i = 0; i < sides; i++)
-                {
-                    rlVertex3f(0, height, 0);
-                    rlVertex3f(sinf(DEG2RAD*i*angleStep)*radiusBottom, 0, cosf(DEG2RAD*i*angleStep)*radiusBottom);
-                    rlVertex3f(sinf(DEG2RAD*(i+1)*angleStep)*radiusBottom, 0, cosf(DEG2RAD*(i+1)*angleStep)*radiusBottom);
-                }
-            }
-
-            // Draw Base -----------------------------------------------------------------------------------------
-            for (int i = 0; i < sides; i++)
-            {
-                rlVertex3f(0, 0, 0);
-                rlVertex3f(sinf(DEG2RAD*i*angleStep)*radiusBottom, 0, cosf(DEG2RAD*(i+1)*angleStep)*radiusBottom);
-                rlVertex3f(sinf(DEG2RAD*i*angleStep)*radiusBottom, 0, cosf(DEG2RAD*i*angleStep)*radiusBottom);
-            }
-
-        rlEnd();
-    rlPopMatrix();
+    if (radiusBottom > 0)
+    {
+        DrawShapeMesh(SHAPE_MESH_CYLINDER, 0, sides, GetShapeTransform(position, (rl_Vector3){ radiusBottom, 0.0f, 0.0f },
+            (rl_Vector3){ 0.0f, height, 0.0f }, (rl_Vector3){ 0.0f, 0.0f, radiusBottom }), (radiusTop > 0)? radiusTop/radiusBottom : 0.0f, color);
+    }
+    else if (radiusTop > 0)
+    {
+        // Inverted cone, mesh is drawn from top (X axis also inverted to keep triangles winding)
+        DrawShapeMesh(SHAPE_MESH_CYLINDER, 0, sides, GetShapeTransform((rl_Vector3){ position.x, position.y + height, position.z },
+            (rl_Vector3){ -radiusTop, 0.0f, 0.0f }, (rl_Vector3){ 0.0f, -height, 0.0f }, (rl_Vector3){ 0.0f, 0.0f, radiusTop }), 0.0f, color);
+    }
 }
 
 // Draw a cylinder with base at startPos and top at endPos
@@ -574,50 +530,17 @@ void rl_DrawCylinderEx(rl_Vector3 startPos, rl_Vector3 endPos, float startRadius
     rl_Vector3 b1 = Vector3Normalize(Vector3Perpendicular(direction));
     rl_Vector3 b2 = Vector3Normalize(Vector3CrossProduct(b1, direction));
 
-    float baseAngle = (2.0f*PI)/sides;
-
-    rlBegin(RL_TRIANGLES);
-        rlColor4ub(color.r, color.g, color.b, color.a);
-
-        for (int i = 0; i < sides; i++)
-        {
-            // Compute the four vertices
-            float s1 = sinf(baseAngle*(i + 0))*startRadius;
-            float c1 = cosf(baseAngle*(i + 0))*startRadius;
-            rl_Vector3 w1 = { startPos.x + s1*b1.x + c1*b2.x, startPos.y + s1*b1.y + c1*b2.y, startPos.z + s1*b1.z + c1*b2.z };
-            float s2 = sinf(baseAngle*(i + 1))*startRadius;
-            float c2 = cosf(baseAngle*(i + 1))*startRadius;
-            rl_Vector3 w2 = { startPos.x + s2*b1.x + c2*b2.x, startPos.y + s2*b1.y + c2*b2.y, startPos.z + s2*b1.z + c2*b2.z };
-            float s3 = sinf(baseAngle*(i + 0))*endRadius;
-            float c3 = cosf(baseAngle*(i + 0))*endRadius;
-            rl_Vector3 w3 = { endPos.x + s3*b1.x + c3*b2.x, endPos.y + s3*b1.y + c3*b2.y, endPos.z + s3*b1.z + c3*b2.z };
-            float s4 = sinf(baseAngle*(i + 1))*endRadius;
-            float c4 = cosf(baseAngle*(i + 1))*endRadius;
-            rl_Vector3 w4 = { endPos.x + s4*b1.x + c4*b2.x, endPos.y + s4*b1.y + c4*b2.y, endPos.z + s4*b1.z + c4*b2.z };
-
-            if (startRadius > 0)
-            {
-                rlVertex3f(startPos.x, startPos.y, startPos.z); // |
-                rlVertex3f(w2.x, w2.y, w2.z);                   // T0
-                rlVertex3f(w1.x, w1.y, w1.z);                   // |
-            }
-                                                                //          w2 x.-----------x startPos
-            rlVertex3f(w1.x, w1.y, w1.z);                       // |           |\'.  T0    /
-            rlVertex3f(w2.x, w2.y, w2.z);                       // T1          | \ '.     /
-            rlVertex3f(w3.x, w3.y, w3.z);                       // |           |T \  '.  /
-                                                                //             | 2 \ T 'x w1
-            rlVertex3f(w2.x, w2.y, w2.z);                       // |        w4 x.---\-1-|---x endPos
-            rlVertex3f(w4.x, w4.y, w4.z);                       // T2            '.  \  |T3/
-            rlVertex3f(w3.x, w3.y, w3.z);                       // |               '. \ | /
-                                                                //                   '.\|/
-            if (endRadius > 0)                                  //                     'x w3
-            {
-                rlVertex3f(endPos.x, endPos.y, endPos.z);       // |
-                rlVertex3f(w3.x, w3.y, w3.z);                   // T3
-                rlVertex3f(w4.x, w4.y, w4.z);                   // |
-            }                                                   //
-        }
-    rlEnd();
+    if (startRadius > 0)
+    {
+        DrawShapeMesh(SHAPE_MESH_CYLINDER, 0, sides, GetShapeTransform(startPos, Vector3Scale(b1, startRadius), direction,
+            Vector3Scale(b2, startRadius)), (endRadius > 0)? endRadius/startRadius : 0.0f, color);
+    }
+    else if (endRadius > 0)
+    {
+        // Inverted cone, mesh is drawn from end (X axis also inverted to keep triangles winding)
+        DrawShapeMesh(SHAPE_MESH_CYLINDER, 0, sides, GetShapeTransform(endPos, Vector3Scale(b1, -endRadius), Vector3Negate(direction),
+            Vector3Scale(b2, endRadius)), 0.0f, color);
+    }
 }
 
 // Draw a wired cylinder
@@ -711,135 +634,19 @@ void rl_DrawCapsule(rl_Vector3 startPos, rl_Vector3 endPos, float radius, int sl
     if (sphereCase) direction = (rl_Vector3){0.0f, 1.0f, 0.0f};
 
     // Construct a basis of the base and the caps:
-    rl_Vector3 b0 = Vector3Normalize(direction);
-    rl_Vector3 b1 = Vector3Normalize(Vector3Perpendicular(direction));
-    rl_Vector3 b2 = Vector3Normalize(Vector3CrossProduct(b1, direction));
-    rl_Vector3 capCenter = endPos;
-
-    float baseSliceAngle = (2.0f*PI)/slices;
-    float baseRingAngle  = PI*0.5f/rings;
-
-    rlBegin(RL_TRIANGLES);
-        rlColor4ub(color.r, color.g, color.b, color.a);
-
-        // render both caps
-        for (int c = 0; c < 2; c++)
-        {
-            for (int i = 0; i < rings; i++)
-            {
-                for (int j = 0; j < slices; j++)
-                {
-
-                    // we build up the rings from capCenter in the direction of the 'direction' vector we computed earlier
-
-                    // as we iterate through the rings they must be placed higher above the center, the height we need is sin(angle(i))
-                    // as we iterate through the rings they must get smaller by the cos(angle(i))
-
-                    // compute the four vertices
-                    float ringSin1 = sinf(baseSliceAngle*(j + 0))*cosf(baseRingAngle*( i + 0 ));
-                    float ringCos1 = cosf(baseSliceAngle*(j + 0))*cosf(baseRingAngle*( i + 0 ));
-                    rl_Vector3 w1 = (rl_Vector3){
-                        capCenter.x + (sinf(baseRingAngle*( i + 0 ))*b0.x + ringSin1*b1.x + ringCos1*b2.x)*radius,
-                        capCenter.y + (sinf(baseRingAngle*( i + 0 ))*b0.y + ringSin1*b1.y + ringCos1*b2.y)*radius,
-                        capCenter.z + (sinf(baseRingAngle*( i + 0 ))*b0.z + ringSin1*b1.z + ringCos1*b2.z)*radius
-                    };
-                    float ringSin2 = sinf(baseSliceAngle*(j + 1))*cosf(baseRingAngle*( i + 0 ));
-                    float ringCos2 = cosf(baseSliceAngle*(j + 1))*cosf(baseRingAngle*( i + 0 ));
-                    rl_Vector3 w2 = (rl_Vector3){
-                        capCenter.x + (sinf(baseRingAngle*( i + 0 ))*b0.x + ringSin2*b1.x + ringCos2*b2.x)*radius,
-                        capCenter.y + (sinf(baseRingAngle*( i + 0 ))*b0.y + ringSin2*b1.y + ringCos2*b2.y)*radius,
-                        capCenter.z + (sinf(baseRingAngle*( i + 0 ))*b0.z + ringSin2*b1.z + ringCos2*b2.z)*radius
-                    };
-
-                    float ringSin3 = sinf(baseSliceAngle*(j + 0))*cosf(baseRingAngle*( i + 1 ));
-                    float ringCos3 = cosf(baseSliceAngle*(j + 0))*cosf(baseRingAngle*( i + 1 ));
-                    rl_Vector3 w3 = (rl_Vector3){
-                        capCenter.x + (sinf(baseRingAngle*( i + 1 ))*b0.x + ringSin3*b1.x + ringCos3*b2.x)*radius,
-                        capCenter.y + (sinf(baseRingAngle*( i + 1 ))*b0.y + ringSin3*b1.y + ringCos3*b2.y)*radius,
-                        capCenter.z + (sinf(baseRingAngle*( i + 1 ))*b0.z + ringSin3*b1.z + ringCos3*b2.z)*radius
-                    };
-                    float ringSin4 = sinf(baseSliceAngle*(j + 1))*cosf(baseRingAngle*( i + 1 ));
-                    float ringCos4 = cosf(baseSliceAngle*(j + 1))*cosf(baseRingAngle*( i + 1 ));
-                    rl_Vector3 w4 = (rl_Vector3){
-                        capCenter.x + (sinf(baseRingAngle*( i + 1 ))*b0.x + ringSin4*b1.x + ringCos4*b2.x)*radius,
-                        capCenter.y + (sinf(baseRingAngle*( i + 1 ))*b0.y + ringSin4*b1.y + ringCos4*b2.y)*radius,
-                        capCenter.z + (sinf(baseRingAngle*( i + 1 ))*b0.z + ringSin4*b1.z + ringCos4*b2.z)*radius
-                    };
-
-                    // Make sure cap triangle normals are facing outwards
-                    if (c == 0)
-                    {
-                        rlVertex3f(w1.x, w1.y, w1.z);
-                        rlVertex3f(w2.x, w2.y, w2.z);
-                        rlVertex3f(w3.x, w3.y, w3.z);
-
-                        rlVertex3f(w2.x, w2.y, w2.z);
-                        rlVertex3f(w4.x, w4.y, w4.z);
-                        rlVertex3f(w3.x, w3.y, w3.z);
-                    }
-                    else
-                    {
-                        rlVertex3f(w1.x, w1.y, w1.z);
-                        rlVertex3f(w3.x, w3.y, w3.z);
-                        rlVertex3f(w2.x, w2.y, w2.z);
+    rl_Vector3 b0 = Vector3Scale(Vector3Normalize(direction), radius);
+    rl_Vector3 b1 = Vector3Scale(Vector3Normalize(Vector3Perpendicular(direction)), radius);
+    rl_Vector3 b2 = Vector3Scale(Vector3Normalize(Vector3CrossProduct(b1, direction)), radius);
 
-                        rlVertex3f(w2.x, w2.y, w2.z);
-                        rlVertex3f(w3.x, w3.y, w3.z);
-                        rlVertex3f(w4.x, w4.y, w4.z);
-                    }
-                }
-            }
-            capCenter = startPos;
-            b0 = Vector3Scale(b0, -1.0f);
-        }
-        // render middle
-        if (!sphereCase)
-        {
-            for (int j = 0; j < slices; j++)
-            {
-                // compute the four vertices
-                float ringSin1 = sinf(baseSliceAngle*(j + 0))*radius;
-                float ringCos1 = cosf(baseSliceAngle*(j + 0))*radius;
-                rl_Vector3 w1 = {
-                    startPos.x + ringSin1*b1.x + ringCos1*b2.x,
-                    startPos.y + ringSin1*b1.y + ringCos1*b2.y,
-                    startPos.z + ringSin1*b1.z + ringCos1*b2.z
-                };
-                float ringSin2 = sinf(baseSliceAngle*(j + 1))*radius;
-                float ringCos2 = cosf(baseSliceAngle*(j + 1))*radius;
-                rl_Vector3 w2 = {
-                    startPos.x + ringSin2*b1.x + ringCos2*b2.x,
-                    startPos.y + ringSin2*b1.y + ringCos2*b2.y,
-                    startPos.z + ringSin2*b1.z + ringCos2*b2.z
-                };
+    // Render both caps, start cap mirrored (X axis also inverted to keep triangles winding)
+    if (rings > 0)
+    {
+        DrawShapeMesh(SHAPE_MESH_HEMISPHERE, rings, slices, GetShapeTransform(endPos, b1, b0, b2), 1.0f, color);
+        DrawShapeMesh(SHAPE_MESH_HEMISPHERE, rings, slices, GetShapeTransform(startPos, Vector3Negate(b1), Vector3Negate(b0), b2), 1.0f, color);
+    }
 
-                float ringSin3 = sinf(baseSliceAngle*(j + 0))*radius;
-                float ringCos3 = cosf(baseSliceAngle*(j + 0))*radius;
-                rl_Vector3 w3 = {
-                    endPos.x + ringSin3*b1.x + ringCos3*b2.x,
-                    endPos.y + ringSin3*b1.y + ringCos3*b2.y,
-                    endPos.z + ringSin3*b1.z + ringCos3*b2.z
-                };
-                float ringSin4 = sinf(baseSliceAngle*(j + 1))*radius;
-                float ringCos4 = cosf(baseSliceAngle*(j + 1))*radius;
-                rl_Vector3 w4 = {
-                    endPos.x + ringSin4*b1.x + ringCos4*b2.x,
-                    endPos.y + ringSin4*b1.y + ringCos4*b2.y,
-                    endPos.z + ringSin4*b1.z + ringCos4*b2.z
-                };
-                                                                        //          w2 x.-----------x startPos
-                rlVertex3f(w1.x, w1.y, w1.z);                         // |           |\'.  T0    /
-                rlVertex3f(w2.x, w2.y, w2.z);                         // T1          | \ '.     /
-                rlVertex3f(w3.x, w3.y, w3.z);                         // |           |T \  '.  /
-                                                                        //             | 2 \ T 'x w1
-                rlVertex3f(w2.x, w2.y, w2.z);                         // |        w4 x.---\-1-|---x endPos
-                rlVertex3f(w4.x, w4.y, w4.z);                         // T2            '.  \  |T3/
-                rlVertex3f(w3.x, w3.y, w3.z);                         // |               '. \ | /
-                                                                        //                   '.\|/
-                                                                        //                   'x w3
-            }
-        }
-    rlEnd();
+    // Render middle
+    if (!sphereCase) DrawShapeMesh(SHAPE_MESH_TUBE, 0, slices, GetShapeTransform(startPos, b1, direction, b2), 1.0f, color);
 }
 
 // Draw capsule wires with the center of its sphere caps at startPos and endPos
@@ -1043,6 +850,22 @@ void rl_DrawGrid(int slices, float spacing)
     rlEnd();
 }
 
+// Unload basic 3d shapes retained meshes and instancing shader
+// NOTE: Called by rl_CloseWindow() [rcore]
+void UnloadShapeMeshesCache(void)
+{
+    for (int i = 0; i < shapeMeshesCount; i++) UnloadShapeMesh(&shapeMeshes[i]);
+
+    shapeMeshesCount = 0;
+    shapeMeshesNext = 0;
+    shapeInstancesQueued = 0;
+
+    if ((shapeShader.id > 0) && (shapeShader.id != rlGetShaderIdDefault())) rlUnloadShaderProgram(shapeShader.id);
+    shapeShader.id = 0;
+
+    rlSetRenderBatchDrawCallback(NULL);
+}
+
 // Load model from files (mesh and material)
 rl_Model rl_LoadModel(const char *fileName)
 {
@@ -1965,6 +1788,18 @@ bool ExportMeshAsCode(rl_Mesh mesh, const char *fileName)
 // Process obj materials
 static void ProcessMaterialsOBJ(rl_Material *materials, tinyobj_material_t *mats, int materialCount)
 {
+    // Queue materials images loading on loader threads, textures are uploaded as images get loaded
+    // NOTE: Every material can use 4 textures: diffuse, specular, bump, displacement
+    int *imageIds = (int *)RL_MALLOC(materialCount*4*sizeof(int));
+
+    for (int m = 0; m < materialCount; m++)
+    {
+        imageIds[m*4 + 0] = (mats[m].diffuse_texname != NULL)? rl_LoadImageAsync(mats[m].diffuse_texname) : -1;
+        imageIds[m*4 + 1] = (mats[m].specular_texname != NULL)? rl_LoadImageAsync(mats[m].specular_texname) : -1;
+        imageIds[m*4 + 2] = (mats[m].bump_texname != NULL)? rl_LoadImageAsync(mats[m].bump_texname) : -1;
+        imageIds[m*4 + 3] = (mats[m].displacement_texname != NULL)? rl_LoadImageAsync(mats[m].displacement_texname) : -1;
+    }
+
     // Init model mats
     for (int m = 0; m < materialCount; m++)
     {
@@ -1976,22 +1811,40 @@ static void ProcessMaterialsOBJ(rl_Material *materials, tinyobj_material_t *mats
         // NOTE: rlgl default texture is a 1x1 pixel UNCOMPRESSED_R8G8B8A8
         materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = (rl_Texture2D){ rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
 
-        if (mats[m].diffuse_texname != NULL) materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = rl_LoadTexture(mats[m].diffuse_texname);  //char *diffuse_texname; // map_Kd
+        if (mats[m].diffuse_texname != NULL) materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = LoadTextureAsync(imageIds[m*4 + 0], mats[m].diffuse_texname);  //char *diffuse_texname; // map_Kd
         else materials[m].maps[MATERIAL_MAP_DIFFUSE].color = (rl_Color){ (unsigned char)(mats[m].diffuse[0]*255.0f), (unsigned char)(mats[m].diffuse[1]*255.0f), (unsigned char)(mats[m].diffuse[2]*255.0f), 255 }; //float diffuse[3];
         materials[m].maps[MATERIAL_MAP_DIFFUSE].value = 0.0f;
 
-        if (mats[m].specular_texname != NULL) materials[m].maps[MATERIAL_MAP_SPECULAR].texture = rl_LoadTexture(mats[m].specular_texname);  //char *specular_texname; // map_Ks
+        if (mats[m].specular_texname != NULL) materials[m].maps[MATERIAL_MAP_SPECULAR].texture = LoadTextureAsync(imageIds[m*4 + 1], mats[m].specular_texname);  //char *specular_texname; // map_Ks
         materials[m].maps[MATERIAL_MAP_SPECULAR].color = (rl_Color){ (unsigned char)(mats[m].specular[0]*255.0f), (unsigned char)(mats[m].specular[1]*255.0f), (unsigned char)(mats[m].specular[2]*255.0f), 255 }; //float specular[3];
         materials[m].maps[MATERIAL_MAP_SPECULAR].value = 0.0f;
 
-        if (mats[m].bump_texname != NULL) materials[m].maps[MATERIAL_MAP_NORMAL].texture = rl_LoadTexture(mats[m].bump_texname);  //char *bump_texname; // map_bump, bump
+        if (mats[m].bump_texname != NULL) materials[m].maps[MATERIAL_MAP_NORMAL].texture = LoadTextureAsync(imageIds[m*4 + 2], mats[m].bump_texname);  //char *bump_texname; // map_bump, bump
         materials[m].maps[MATERIAL_MAP_NORMAL].color = rl_WHITE;
         materials[m].maps[MATERIAL_MAP_NORMAL].value = mats[m].shininess;
 
         materials[m].maps[MATERIAL_MAP_EMISSION].color = (rl_Color){ (unsigned char)(mats[m].emission[0]*255.0f), (unsigned char)(mats[m].emission[1]*255.0f), (unsigned char)(mats[m].emission[2]*255.0f), 255 }; //float emission[3];
 
-        if (mats[m].displacement_texname != NULL) materials[m].maps[MATERIAL_MAP_HEIGHT].texture = rl_LoadTexture(mats[m].displacement_texname);  //char *displacement_texname; // disp
+        if (mats[m].displacement_texname != NULL) materials[m].maps[MATERIAL_MAP_HEIGHT].texture = LoadTextureAsync(imageIds[m*4 + 3], mats[m].displacement_texname);  //char *displacement_texname; // disp
+    }
+
+    RL_FREE(imageIds);
+}
+
+// Load texture from image loaded async, image is loaded if not queued (imageId = -1)
+static rl_Texture2D LoadTextureAsync(int imageId, const char *fileName)
+{
+    rl_Texture2D texture = { 0 };
+
+    rl_Image image = (imageId >= 0)? rl_WaitImageAsync(imageId) : rl_LoadImage(fileName);
+
+    if (image.data != NULL)
+    {
+        texture = rl_LoadTextureFromImage(image);
+        rl_UnloadImage(image);
     }
+
+    return texture;
 }
 #endif
 
@@ -2108,103 +1961,138 @@ rl_ModelAnimation *rl_LoadModelAnimations(const char *fileName, int *animCount)
 }
 
 // Update model animated vertex data (positions and normals) for a given frame
-// NOTE: Updated data is uploaded to GPU
+// NOTE: Updated data is uploaded to GPU, animations loaded from files are sampled from keyframe tracks (anim.framePoses is NULL)
 void rl_UpdateModelAnimation(rl_Model model, rl_ModelAnimation anim, int frame)
 {
-    if ((anim.frameCount > 0) && (anim.bones != NULL) && (anim.framePoses != NULL))
+    if ((anim.frameCount > 0) && (anim.bones != NULL))
     {
         if (frame >= anim.frameCount) frame = frame%anim.frameCount;
 
-        for (int m = 0; m < model.meshCount; m++)
+        if (anim.framePoses != NULL) UpdateModelAnimationVertices(model, anim.framePoses[frame]);
+        else if (anim.tracks != NULL)
         {
-            rl_Mesh mesh = model.meshes[m];
-
-            if (mesh.boneIds == NULL || mesh.boneWeights == NULL)
+            // Frames are evenly distributed along the animation duration
+            // NOTE: Tracks are sampled directly, last frame time (duration) must not loop to first frame
+            float frameTime = (anim.frameCount > 1)? anim.duration/(float)(anim.frameCount - 1) : 0.0f;
+            float time = fminf((float)frame*frameTime, anim.duration);
+            rl_Transform stackPoses[ANIMATION_POSES_STACK_BONES];
+            rl_Transform *pose = LoadAnimationPoses(anim.boneCount, stackPoses);
+
+            if (pose != NULL)
             {
-                TRACELOG(LOG_WARNING, "MODEL: rl_UpdateModelAnimation(): rl_Mesh %i has no connection to bones", m);
-                continue;
-            }
-
-            bool updated = false;           // Flag to check when anim vertex information is updated
-            rl_Vector3 animVertex = { 0 };
-            rl_Vector3 animNormal = { 0 };
+                for (int i = 0; i < anim.boneCount; i++) pose[i] = SampleBoneTrack(anim.tracks[i], time);
 
-            rl_Vector3 inTranslation = { 0 };
-            Quaternion inRotation = { 0 };
-            // rl_Vector3 inScale = { 0 };
+                BuildPoseFromParentJoints(anim.bones, anim.boneCount, pose);
+                UpdateModelAnimationVertices(model, pose);
+                UnloadAnimationPoses(pose, stackPoses);
+            }
+        }
+    }
+}
 
-            rl_Vector3 outTranslation = { 0 };
-            Quaternion outRotation = { 0 };
-            rl_Vector3 outScale = { 0 };
+// Update model animated vertex data (positions and normals) sampled at time (seconds)
+// NOTE: Animation loops when time exceeds animation duration
+void rl_UpdateModelAnimationTime(rl_Model model, rl_ModelAnimation anim, float time)
+{
+    if ((anim.bones != NULL) && ((anim.tracks != NULL) || (anim.framePoses != NULL)))
+    {
+        rl_Transform stackPoses[ANIMATION_POSES_STACK_BONES];
+        rl_Transform *pose = LoadAnimationPoses(anim.boneCount, stackPoses);
 
-            int boneId = 0;
-            int boneCounter = 0;
-            float boneWeight = 0.0;
+        if (pose != NULL)
+        {
+            rl_GetModelAnimationPose(anim, time, pose);
+            UpdateModelAnimationVertices(model, pose);
+            UnloadAnimationPoses(pose, stackPoses);
+        }
+    }
+}
 
-            const int vValues = mesh.vertexCount*3;
-            for (int vCounter = 0; vCounter < vValues; vCounter += 3)
-            {
-                mesh.animVertices[vCounter] = 0;
-                mesh.animVertices[vCounter + 1] = 0;
-                mesh.animVertices[vCounter + 2] = 0;
+// Update model animated vertex data (positions and normals) blending two animations
+// NOTE: blend factor goes from 0.0f (animA) to 1.0f (animB), animations must share the same skeleton
+void rl_UpdateModelAnimationBlend(rl_Model model, rl_ModelAnimation animA, float timeA, rl_ModelAnimation animB, float timeB, float blend)
+{
+    if ((animA.bones == NULL) || (animB.bones == NULL)) return;
 
-                if (mesh.animNormals != NULL)
-                {
-                    mesh.animNormals[vCounter] = 0;
-                    mesh.animNormals[vCounter + 1] = 0;
-                    mesh.animNormals[vCounter + 2] = 0;
-                }
+    if (animA.boneCount != animB.boneCount)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: rl_UpdateModelAnimationBlend(): Animations bones count do not match (%i != %i)", animA.boneCount, animB.boneCount);
+        return;
+    }
 
-                // Iterates over 4 bones per vertex
-                for (int j = 0; j < 4; j++, boneCounter++)
-                {
-                    boneWeight = mesh.boneWeights[boneCounter];
-
-                    // Early stop when no transformation will be applied
-                    if (boneWeight == 0.0f) continue;
-
-                    boneId = mesh.boneIds[boneCounter];
-                    //int boneIdParent = model.bones[boneId].parent;
-                    inTranslation = model.bindPose[boneId].translation;
-                    inRotation = model.bindPose[boneId].rotation;
-                    //inScale = model.bindPose[boneId].scale;
-                    outTranslation = anim.framePoses[frame][boneId].translation;
-                    outRotation = anim.framePoses[frame][boneId].rotation;
-                    outScale = anim.framePoses[frame][boneId].scale;
-
-                    // Vertices processing
-                    // NOTE: We use meshes.vertices (default vertex position) to calculate meshes.animVertices (animated vertex position)
-                    animVertex = (rl_Vector3){ mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
-                    animVertex = Vector3Subtract(animVertex, inTranslation);
-                    animVertex = Vector3Multiply(animVertex, outScale);
-                    animVertex = Vector3RotateByQuaternion(animVertex, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-                    animVertex = Vector3Add(animVertex, outTranslation);
-                    //animVertex = Vector3Transform(animVertex, model.transform);
-                    mesh.animVertices[vCounter] += animVertex.x*boneWeight;
-                    mesh.animVertices[vCounter + 1] += animVertex.y*boneWeight;
-                    mesh.animVertices[vCounter + 2] += animVertex.z*boneWeight;
-                    updated = true;
-
-                    // Normals processing
-                    // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
-                    if (mesh.normals != NULL)
-                    {
-                        animNormal = (rl_Vector3){ mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
-                        animNormal = Vector3RotateByQuaternion(animNormal, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-                        mesh.animNormals[vCounter] += animNormal.x*boneWeight;
-                        mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
-                        mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
-                    }
-                }
-            }
+    if (blend < 0.0f) blend = 0.0f;
+    else if (blend > 1.0f) blend = 1.0f;
 
-            // Upload new vertex data to GPU for model drawing
-            // NOTE: Only update data when values changed
-            if (updated)
-            {
-                rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0); // Update vertex position
-                rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);  // Update vertex normals
-            }
+    // NOTE: Both poses share the buffer, stack buffer holds two poses up to half of the bones limit
+    rl_Transform stackPoses[ANIMATION_POSES_STACK_BONES];
+    rl_Transform *poseA = LoadAnimationPoses(2*animA.boneCount, stackPoses);
+    if (poseA == NULL) return;
+    rl_Transform *poseB = poseA + animA.boneCount;
+
+    // NOTE: Blending is done in bone-local space when keyframe tracks are available,
+    // it keeps bones length; baked poses are already in model space and blended as is
+    bool localSpace = (animA.tracks != NULL) && (animB.tracks != NULL);
+
+    if (localSpace)
+    {
+        GetModelAnimationLocalPose(animA, timeA, poseA);
+        GetModelAnimationLocalPose(animB, timeB, poseB);
+    }
+    else
+    {
+        rl_GetModelAnimationPose(animA, timeA, poseA);
+        rl_GetModelAnimationPose(animB, timeB, poseB);
+    }
+
+    for (int i = 0; i < animA.boneCount; i++)
+    {
+        poseA[i].translation = Vector3Lerp(poseA[i].translation, poseB[i].translation, blend);
+        poseA[i].rotation = QuaternionSlerp(poseA[i].rotation, poseB[i].rotation, blend);
+        poseA[i].scale = Vector3Lerp(poseA[i].scale, poseB[i].scale, blend);
+    }
+
+    if (localSpace) BuildPoseFromParentJoints(animA.bones, animA.boneCount, poseA);
+
+    UpdateModelAnimationVertices(model, poseA);
+    UnloadAnimationPoses(poseA, stackPoses);
+}
+
+// Get animation bones pose (model space) sampled at time (seconds)
+// NOTE: pose array must be able to hold anim.boneCount transforms
+void rl_GetModelAnimationPose(rl_ModelAnimation anim, float time, rl_Transform *pose)
+{
+    if ((anim.bones == NULL) || (pose == NULL)) return;
+
+    if (anim.tracks != NULL)
+    {
+        GetModelAnimationLocalPose(anim, time, pose);
+        BuildPoseFromParentJoints(anim.bones, anim.boneCount, pose);
+    }
+    else if ((anim.framePoses != NULL) && (anim.frameCount > 0))
+    {
+        // Baked animation, interpolate between the two closest frames
+        float frame = 0.0f;
+        float duration = GetModelAnimationDuration(anim);
+
+        if ((duration > 0.0f) && (anim.frameCount > 1))
+        {
+            time = fmodf(time, duration);
+            if (time < 0.0f) time += duration;
+            frame = time*(float)(anim.frameCount - 1)/duration;
+        }
+
+        int currentFrame = (int)frame;
+        int nextFrame = (currentFrame + 1)%anim.frameCount;
+        float amount = frame - (float)currentFrame;
+
+        for (int i = 0; i < anim.boneCount; i++)
+        {
+            rl_Transform current = anim.framePoses[currentFrame][i];
+            rl_Transform next = anim.framePoses[nextFrame][i];
+
+            pose[i].translation = Vector3Lerp(current.translation, next.translation, amount);
+            pose[i].rotation = QuaternionSlerp(current.rotation, next.rotation, amount);
+            pose[i].scale = Vector3Lerp(current.scale, next.scale, amount);
         }
     }
 }
@@ -2219,10 +2107,27 @@ void rl_UnloadModelAnimations(rl_ModelAnimation *animations, int animCount)
 // Unload animation data
 void rl_UnloadModelAnimation(rl_ModelAnimation anim)
 {
-    for (int i = 0; i < anim.frameCount; i++) RL_FREE(anim.framePoses[i]);
+    if (anim.framePoses != NULL)
+    {
+        for (int i = 0; i < anim.frameCount; i++) RL_FREE(anim.framePoses[i]);
+    }
+
+    if (anim.tracks != NULL)
+    {
+        for (int i = 0; i < anim.boneCount; i++)
+        {
+            RL_FREE(anim.tracks[i].translationTimes);
+            RL_FREE(anim.tracks[i].rotationTimes);
+            RL_FREE(anim.tracks[i].scaleTimes);
+            RL_FREE(anim.tracks[i].translations);
+            RL_FREE(anim.tracks[i].rotations);
+            RL_FREE(anim.tracks[i].scales);
+        }
+    }
 
     RL_FREE(anim.bones);
     RL_FREE(anim.framePoses);
+    RL_FREE(anim.tracks);
 }
 
 // Check model animation skeleton match
@@ -2917,7 +2822,9 @@ rl_Mesh rl_GenMeshHeightmap(rl_Image heightmap, rl_Vector3 size)
     int mapX = heightmap.width;
     int mapZ = heightmap.height;
 
-    rl_Color *pixels = rl_LoadImageColors(heightmap);
+    // NOTE: Heightmap is read row by row (rows z and z + 1), converted into two rows buffers if not RGBA 32bit
+    rl_Color *rowBuffers = (rl_Color *)RL_MALLOC(2*mapX*sizeof(rl_Color));
+    const rl_Color *row = (rowBuffers != NULL)? rl_GetImageColorsRow(heightmap, 0, rowBuffers) : NULL;
 
     // NOTE: One vertex per pixel
     mesh.triangleCount = (mapX - 1)*(mapZ - 1)*2;    // One quad every four pixels
@@ -2940,8 +2847,11 @@ rl_Mesh rl_GenMeshHeightmap(rl_Image heightmap, rl_Vector3 size)
     rl_Vector3 vC = { 0 };
     rl_Vector3 vN = { 0 };
 
-    for (int z = 0; z < mapZ-1; z++)
+    for (int z = 0; (z < mapZ-1) && (row != NULL); z++)
     {
+        const rl_Color *nextRow = rl_GetImageColorsRow(heightmap, z + 1, rowBuffers + ((z + 1)%2)*mapX);
+        if (nextRow == NULL) break;
+
         for (int x = 0; x < mapX-1; x++)
         {
             // Fill vertices array with data
@@ -2949,15 +2859,15 @@ rl_Mesh rl_GenMeshHeightmap(rl_Image heightmap, rl_Vector3 size)
 
             // one triangle - 3 vertex
             mesh.vertices[vCounter] = (float)x*scaleFactor.x;
-            mesh.vertices[vCounter + 1] = GRAY_VALUE(pixels[x + z*mapX])*scaleFactor.y;
+            mesh.vertices[vCounter + 1] = GRAY_VALUE(row[x])*scaleFactor.y;
             mesh.vertices[vCounter + 2] = (float)z*scaleFactor.z;
 
             mesh.vertices[vCounter + 3] = (float)x*scaleFactor.x;
-            mesh.vertices[vCounter + 4] = GRAY_VALUE(pixels[x + (z + 1)*mapX])*scaleFactor.y;
+            mesh.vertices[vCounter + 4] = GRAY_VALUE(nextRow[x])*scaleFactor.y;
             mesh.vertices[vCounter + 5] = (float)(z + 1)*scaleFactor.z;
 
             mesh.vertices[vCounter + 6] = (float)(x + 1)*scaleFactor.x;
-            mesh.vertices[vCounter + 7] = GRAY_VALUE(pixels[(x + 1) + z*mapX])*scaleFactor.y;
+            mesh.vertices[vCounter + 7] = GRAY_VALUE(row[x + 1])*scaleFactor.y;
             mesh.vertices[vCounter + 8] = (float)z*scaleFactor.z;
 
             // Another triangle - 3 vertex
@@ -2970,7 +2880,7 @@ rl_Mesh rl_GenMeshHeightmap(rl_Image heightmap, rl_Vector3 size)
             mesh.vertices[vCounter + 14] = mesh.vertices[vCounter + 5];
 
             mesh.vertices[vCounter + 15] = (float)(x + 1)*scaleFactor.x;
-            mesh.vertices[vCounter + 16] = GRAY_VALUE(pixels[(x + 1) + (z + 1)*mapX])*scaleFactor.y;
+            mesh.vertices[vCounter + 16] = GRAY_VALUE(nextRow[x + 1])*scaleFactor.y;
             mesh.vertices[vCounter + 17] = (float)(z + 1)*scaleFactor.z;
             vCounter += 18;     // 6 vertex, 18 floats
 
@@ -3028,9 +2938,11 @@ rl_Mesh rl_GenMeshHeightmap(rl_Image heightmap, rl_Vector3 size)
 
             nCounter += 18;     // 6 vertex, 18 floats
         }
+
+        row = nextRow;
     }
 
-    rl_UnloadImageColors(pixels);  // Unload pixels color data
+    RL_FREE(rowBuffers);    // Unload rows color data
 
     // Upload vertex data to GPU (static mesh)
     rl_UploadMesh(&mesh, false);
@@ -3046,7 +2958,10 @@ rl_Mesh rl_GenMeshCubicmap(rl_Image cubicmap, rl_Vector3 cubeSize)
 
     rl_Mesh mesh = { 0 };
 
-    rl_Color *pixels = rl_LoadImageColors(cubicmap);
+    // NOTE: Cubicmap is read row by row (rows z - 1, z and z + 1), converted into three rows buffers if not RGBA 32bit
+    rl_Color *rowBuffers = (rl_Color *)RL_MALLOC(3*cubicmap.width*sizeof(rl_Color));
+    const rl_Color *prevRow = NULL;
+    const rl_Color *row = (rowBuffers != NULL)? rl_GetImageColorsRow(cubicmap, 0, rowBuffers) : NULL;
 
     // NOTE: Max possible number of triangles numCubes*(12 triangles by cube)
     int maxTriangles = cubicmap.width*cubicmap.height*12;
@@ -3086,8 +3001,10 @@ rl_Mesh rl_GenMeshCubicmap(rl_Image cubicmap, rl_Vector3 cubeSize)
     RectangleF topTexUV = { 0.0f, 0.5f, 0.5f, 0.5f };
     RectangleF bottomTexUV = { 0.5f, 0.5f, 0.5f, 0.5f };
 
-    for (int z = 0; z < cubicmap.height; ++z)
+    for (int z = 0; (z < cubicmap.height) && (row != NULL); ++z)
     {
+        const rl_Color *nextRow = (z < cubicmap.height - 1)? rl_GetImageColorsRow(cubicmap, z + 1, rowBuffers + ((z + 1)%3)*cubicmap.width) : NULL;
+
         for (int x = 0; x < cubicmap.width; ++x)
         {
             // Define the 8 vertex of the cube, we will combine them accordingly later...
@@ -3101,7 +3018,7 @@ rl_Mesh rl_GenMeshCubicmap(rl_Image cubicmap, rl_Vector3 cubeSize)
             rl_Vector3 v8 = { w*(x + 0.5f), 0, h*(z + 0.5f) };
 
             // We check pixel color to be rl_WHITE -> draw full cube
-            if (COLOR_EQUAL(pixels[z*cubicmap.width + x], rl_WHITE))
+            if (COLOR_EQUAL(row[x], rl_WHITE))
             {
                 // Define triangles and checking collateral cubes
                 //------------------------------------------------
@@ -3158,7 +3075,7 @@ rl_Mesh rl_GenMeshCubicmap(rl_Image cubicmap, rl_Vector3 cubeSize)
                 tcCounter += 6;
 
                 // Checking cube on bottom of current cube
-                if (((z < cubicmap.height - 1) && COLOR_EQUAL(pixels[(z + 1)*cubicmap.width + x], rl_BLACK)) || (z == cubicmap.height - 1))
+                if (((z < cubicmap.height - 1) && COLOR_EQUAL(nextRow[x], rl_BLACK)) || (z == cubicmap.height - 1))
                 {
                     // Define front triangles (2 tris, 6 vertex) --> v2 v7 v3, v3 v7 v8
                     // NOTE: Collateral occluded faces are not generated
@@ -3188,7 +3105,7 @@ rl_Mesh rl_GenMeshCubicmap(rl_Image cubicmap, rl_Vector3 cubeSize)
                 }
 
                 // Checking cube on top of current cube
-                if (((z > 0) && COLOR_EQUAL(pixels[(z - 1)*cubicmap.width + x], rl_BLACK)) || (z == 0))
+                if (((z > 0) && COLOR_EQUAL(prevRow[x], rl_BLACK)) || (z == 0))
                 {
                     // Define back triangles (2 tris, 6 vertex) --> v1 v5 v6, v1 v4 v5
                     // NOTE: Collateral occluded faces are not generated
@@ -3218,7 +3135,7 @@ rl_Mesh rl_GenMeshCubicmap(rl_Image cubicmap, rl_Vector3 cubeSize)
                 }
 
                 // Checking cube on right of current cube
-                if (((x < cubicmap.width - 1) && COLOR_EQUAL(pixels[z*cubicmap.width + (x + 1)], rl_BLACK)) || (x == cubicmap.width - 1))
+                if (((x < cubicmap.width - 1) && COLOR_EQUAL(row[x + 1], rl_BLACK)) || (x == cubicmap.width - 1))
                 {
                     // Define right triangles (2 tris, 6 vertex) --> v3 v8 v4, v4 v8 v5
                     // NOTE: Collateral occluded faces are not generated
@@ -3248,7 +3165,7 @@ rl_Mesh rl_GenMeshCubicmap(rl_Image cubicmap, rl_Vector3 cubeSize)
                 }
 
                 // Checking cube on left of current cube
-                if (((x > 0) && COLOR_EQUAL(pixels[z*cubicmap.width + (x - 1)], rl_BLACK)) || (x == 0))
+                if (((x > 0) && COLOR_EQUAL(row[x - 1], rl_BLACK)) || (x == 0))
                 {
                     // Define left triangles (2 tris, 6 vertex) --> v1 v7 v2, v1 v6 v7
                     // NOTE: Collateral occluded faces are not generated
@@ -3278,7 +3195,7 @@ rl_Mesh rl_GenMeshCubicmap(rl_Image cubicmap, rl_Vector3 cubeSize)
                 }
             }
             // We check pixel color to be rl_BLACK, we will only draw floor and roof
-            else if (COLOR_EQUAL(pixels[z*cubicmap.width + x], rl_BLACK))
+            else if (COLOR_EQUAL(row[x], rl_BLACK))
             {
                 // Define top triangles (2 tris, 6 vertex --> v1-v2-v3, v1-v3-v4)
                 mapVertices[vCounter] = v1;
@@ -3331,6 +3248,9 @@ rl_Mesh rl_GenMeshCubicmap(rl_Image cubicmap, rl_Vector3 cubeSize)
                 tcCounter += 6;
             }
         }
+
+        prevRow = row;
+        row = nextRow;
     }
 
     // Move data from mapVertices temp arrays to vertices float array
@@ -3378,7 +3298,7 @@ rl_Mesh rl_GenMeshCubicmap(rl_Image cubicmap, rl_Vector3 cubeSize)
     RL_FREE(mapNormals);
     RL_FREE(mapTexcoords);
 
-    rl_UnloadImageColors(pixels);   // Unload pixels color data
+    RL_FREE(rowBuffers);    // Unload rows color data
 
     // Upload vertex data to GPU (static mesh)
     rl_UploadMesh(&mesh, false);
@@ -3852,176 +3772,1020 @@ rl_RayCollision rl_GetRayCollisionBox(rl_Ray ray, rl_BoundingBox box)
     collision.distance = t[6];
     collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
 
-    // Get box center point
-    collision.normal = Vector3Lerp(box.min, box.max, 0.5f);
-    // Get vector center point->hit point
-    collision.normal = Vector3Subtract(collision.point, collision.normal);
-    // Scale vector to unit cube
-    // NOTE: We use an additional .01 to fix numerical errors
-    collision.normal = Vector3Scale(collision.normal, 2.01f);
-    collision.normal = Vector3Divide(collision.normal, Vector3Subtract(box.max, box.min));
-    // The relevant elements of the vector are now slightly larger than 1.0f (or smaller than -1.0f)
-    // and the others are somewhere between -1.0 and 1.0 casting to int is exactly our wanted normal!
-    collision.normal.x = (float)((int)collision.normal.x);
-    collision.normal.y = (float)((int)collision.normal.y);
-    collision.normal.z = (float)((int)collision.normal.z);
+    // Get box center point
+    collision.normal = Vector3Lerp(box.min, box.max, 0.5f);
+    // Get vector center point->hit point
+    collision.normal = Vector3Subtract(collision.point, collision.normal);
+    // Scale vector to unit cube
+    // NOTE: We use an additional .01 to fix numerical errors
+    collision.normal = Vector3Scale(collision.normal, 2.01f);
+    collision.normal = Vector3Divide(collision.normal, Vector3Subtract(box.max, box.min));
+    // The relevant elements of the vector are now slightly larger than 1.0f (or smaller than -1.0f)
+    // and the others are somewhere between -1.0 and 1.0 casting to int is exactly our wanted normal!
+    collision.normal.x = (float)((int)collision.normal.x);
+    collision.normal.y = (float)((int)collision.normal.y);
+    collision.normal.z = (float)((int)collision.normal.z);
+
+    collision.normal = Vector3Normalize(collision.normal);
+
+    if (insideBox)
+    {
+        // Reset ray.direction
+        ray.direction = Vector3Negate(ray.direction);
+        // Fix result
+        collision.distance *= -1.0f;
+        collision.normal = Vector3Negate(collision.normal);
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and mesh
+rl_RayCollision rl_GetRayCollisionMesh(rl_Ray ray, rl_Mesh mesh, rl_Matrix transform)
+{
+    rl_RayCollision collision = { 0 };
+
+    // Check if mesh vertex data on CPU for testing
+    if (mesh.vertices != NULL)
+    {
+        int triangleCount = mesh.triangleCount;
+
+        // Test against all triangles in mesh
+        for (int i = 0; i < triangleCount; i++)
+        {
+            rl_Vector3 a, b, c;
+            rl_Vector3* vertdata = (rl_Vector3*)mesh.vertices;
+
+            if (mesh.indices)
+            {
+                a = vertdata[mesh.indices[i*3 + 0]];
+                b = vertdata[mesh.indices[i*3 + 1]];
+                c = vertdata[mesh.indices[i*3 + 2]];
+            }
+            else
+            {
+                a = vertdata[i*3 + 0];
+                b = vertdata[i*3 + 1];
+                c = vertdata[i*3 + 2];
+            }
+
+            a = Vector3Transform(a, transform);
+            b = Vector3Transform(b, transform);
+            c = Vector3Transform(c, transform);
+
+            rl_RayCollision triHitInfo = rl_GetRayCollisionTriangle(ray, a, b, c);
+
+            if (triHitInfo.hit)
+            {
+                // Save the closest hit triangle
+                if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
+            }
+        }
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and triangle
+// NOTE: The points are expected to be in counter-clockwise winding
+// NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
+rl_RayCollision rl_GetRayCollisionTriangle(rl_Ray ray, rl_Vector3 p1, rl_Vector3 p2, rl_Vector3 p3)
+{
+    #define EPSILON 0.000001f        // A small number
+
+    rl_RayCollision collision = { 0 };
+    rl_Vector3 edge1 = { 0 };
+    rl_Vector3 edge2 = { 0 };
+    rl_Vector3 p, q, tv;
+    float det, invDet, u, v, t;
+
+    // Find vectors for two edges sharing V1
+    edge1 = Vector3Subtract(p2, p1);
+    edge2 = Vector3Subtract(p3, p1);
+
+    // Begin calculating determinant - also used to calculate u parameter
+    p = Vector3CrossProduct(ray.direction, edge2);
+
+    // If determinant is near zero, ray lies in plane of triangle or ray is parallel to plane of triangle
+    det = Vector3DotProduct(edge1, p);
+
+    // Avoid culling!
+    if ((det > -EPSILON) && (det < EPSILON)) return collision;
+
+    invDet = 1.0f/det;
+
+    // Calculate distance from V1 to ray origin
+    tv = Vector3Subtract(ray.position, p1);
+
+    // Calculate u parameter and test bound
+    u = Vector3DotProduct(tv, p)*invDet;
+
+    // The intersection lies outside the triangle
+    if ((u < 0.0f) || (u > 1.0f)) return collision;
+
+    // Prepare to test v parameter
+    q = Vector3CrossProduct(tv, edge1);
+
+    // Calculate V parameter and test bound
+    v = Vector3DotProduct(ray.direction, q)*invDet;
+
+    // The intersection lies outside the triangle
+    if ((v < 0.0f) || ((u + v) > 1.0f)) return collision;
+
+    t = Vector3DotProduct(edge2, q)*invDet;
+
+    if (t > EPSILON)
+    {
+        // rl_Ray hit, get hit point and normal
+        collision.hit = true;
+        collision.distance = t;
+        collision.normal = Vector3Normalize(Vector3CrossProduct(edge1, edge2));
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, t));
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and quad
+// NOTE: The points are expected to be in counter-clockwise winding
+rl_RayCollision rl_GetRayCollisionQuad(rl_Ray ray, rl_Vector3 p1, rl_Vector3 p2, rl_Vector3 p3, rl_Vector3 p4)
+{
+    rl_RayCollision collision = { 0 };
+
+    collision = rl_GetRayCollisionTriangle(ray, p1, p2, p4);
+
+    if (!collision.hit) collision = rl_GetRayCollisionTriangle(ray, p2, p3, p4);
+
+    return collision;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+// Get shape transform from origin and local axis (unit mesh X, Y and Z axis)
+static rl_Matrix GetShapeTransform(rl_Vector3 origin, rl_Vector3 axisX, rl_Vector3 axisY, rl_Vector3 axisZ)
+{
+    rl_Matrix transform = {
+        axisX.x, axisY.x, axisZ.x, origin.x,
+        axisX.y, axisY.y, axisZ.y, origin.y,
+        axisX.z, axisY.z, axisZ.z, origin.z,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+
+    return transform;
+}
+
+// Load basic 3d shape mesh, generated once per type and tessellation and cached, NULL on allocation failure
+// NOTE: Triangles winding and vertex layout follow the immediate mode shapes it replaces
+static ShapeMesh *LoadShapeMesh(int type, int rings, int slices)
+{
+    // Security checks, mesh indices are 16 bit
+    if (rings < 0) rings = 0;
+    if (slices < 3) slices = 3;
+    if ((type == SHAPE_MESH_SPHERE) || (type == SHAPE_MESH_HEMISPHERE))
+    {
+        if (rings > SHAPE_MESH_MAX_RINGS) rings = SHAPE_MESH_MAX_RINGS;
+        if (slices > SHAPE_MESH_MAX_RINGS) slices = SHAPE_MESH_MAX_RINGS;
+        if ((type == SHAPE_MESH_HEMISPHERE) && (rings < 1)) rings = 1;
+    }
+    else if (slices > SHAPE_MESH_MAX_SIDES) slices = SHAPE_MESH_MAX_SIDES;
+
+    if (type == SHAPE_MESH_CUBE) { rings = 0; slices = 0; }
+    else if ((type == SHAPE_MESH_CYLINDER) || (type == SHAPE_MESH_TUBE)) rings = 0;
+
+    for (int i = 0; i < shapeMeshesCount; i++)
+    {
+        if ((shapeMeshes[i].type == type) && (shapeMeshes[i].rings == rings) && (shapeMeshes[i].slices == slices)) return &shapeMeshes[i];
+    }
+
+    ShapeMesh *mesh = NULL;
+
+    if (shapeMeshesCount < MAX_SHAPE_MESHES_CACHE) mesh = &shapeMeshes[shapeMeshesCount++];
+    else
+    {
+        // Cache is full, oldest mesh is replaced (instances queued are drawn first)
+        if (shapeInstancesQueued > 0) rlDrawRenderBatchActive();
+
+        mesh = &shapeMeshes[shapeMeshesNext];
+        shapeMeshesNext = (shapeMeshesNext + 1)%MAX_SHAPE_MESHES_CACHE;
+        UnloadShapeMesh(mesh);
+    }
+
+    mesh->type = type;
+    mesh->rings = rings;
+    mesh->slices = slices;
+
+    switch (type)
+    {
+        case SHAPE_MESH_CUBE:
+        {
+            // Cube corners: index bits set positive X (1), Y (2) and Z (4) coordinates
+            static const unsigned short cubeIndices[36] = {
+                4, 5, 6, 7, 6, 5,       // Front face
+                0, 2, 1, 3, 1, 2,       // Back face
+                2, 6, 7, 3, 2, 7,       // Top face
+                0, 5, 4, 1, 5, 0,       // Bottom face
+                1, 3, 7, 5, 1, 7,       // Right face
+                0, 6, 2, 4, 6, 0        // Left face
+            };
+
+            mesh->vertexCount = 8;
+            mesh->indexCount = 36;
+            mesh->vertices = (float *)RL_MALLOC(mesh->vertexCount*3*sizeof(float));
+            mesh->indices = (unsigned short *)RL_MALLOC(mesh->indexCount*sizeof(unsigned short));
+            if ((mesh->vertices == NULL) || (mesh->indices == NULL)) break;
+
+            for (int i = 0; i < 8; i++)
+            {
+                mesh->vertices[i*3 + 0] = (i & 1)? 0.5f : -0.5f;
+                mesh->vertices[i*3 + 1] = (i & 2)? 0.5f : -0.5f;
+                mesh->vertices[i*3 + 2] = (i & 4)? 0.5f : -0.5f;
+            }
+
+            memcpy(mesh->indices, cubeIndices, sizeof(cubeIndices));
+        } break;
+        case SHAPE_MESH_SPHERE:
+        case SHAPE_MESH_HEMISPHERE:
+        {
+            // Sphere rows go from south to north pole, hemisphere rows from base to pole
+            int rows = (type == SHAPE_MESH_SPHERE)? rings + 2 : rings + 1;
+            float startAngle = (type == SHAPE_MESH_SPHERE)? -PI/2.0f : 0.0f;
+            float rowAngle = (type == SHAPE_MESH_SPHERE)? PI/(rings + 1) : PI/(2.0f*rings);
+
+            mesh->vertexCount = rows*slices;
+            mesh->vertices = (float *)RL_MALLOC(mesh->vertexCount*3*sizeof(float));
+            mesh->indices = (unsigned short *)RL_MALLOC((rows - 1)*slices*6*sizeof(unsigned short));
+            if ((mesh->vertices == NULL) || (mesh->indices == NULL)) break;
+
+            for (int i = 0; i < rows; i++)
+            {
+                float ringCos = cosf(startAngle + rowAngle*i);
+                float ringSin = sinf(startAngle + rowAngle*i);
+
+                for (int j = 0; j < slices; j++)
+                {
+                    float *vertex = &mesh->vertices[(i*slices + j)*3];
+                    vertex[0] = ringCos*sinf(2.0f*PI*j/slices);
+                    vertex[1] = ringSin;
+                    vertex[2] = ringCos*cosf(2.0f*PI*j/slices);
+                }
+            }
+
+            // Triangles collapsed to the poles are skipped
+            int k = 0;
+            for (int i = 0; i < (rows - 1); i++)
+            {
+                for (int j = 0; j < slices; j++)
+                {
+                    unsigned short v1 = (unsigned short)(i*slices + j);
+                    unsigned short v2 = (unsigned short)(i*slices + (j + 1)%slices);
+                    unsigned short v3 = (unsigned short)((i + 1)*slices + j);
+                    unsigned short v4 = (unsigned short)((i + 1)*slices + (j + 1)%slices);
+
+                    if (type == SHAPE_MESH_SPHERE)
+                    {
+                        if (i < (rows - 2)) { mesh->indices[k++] = v1; mesh->indices[k++] = v4; mesh->indices[k++] = v3; }
+                        if (i > 0) { mesh->indices[k++] = v1; mesh->indices[k++] = v2; mesh->indices[k++] = v4; }
+                    }
+                    else
+                    {
+                        mesh->indices[k++] = v1; mesh->indices[k++] = v2; mesh->indices[k++] = v3;
+                        if (i < (rows - 2)) { mesh->indices[k++] = v2; mesh->indices[k++] = v4; mesh->indices[k++] = v3; }
+                    }
+                }
+            }
+
+            mesh->indexCount = k;
+        } break;
+        case SHAPE_MESH_CYLINDER:
+        case SHAPE_MESH_TUBE:
+        {
+            // Vertices: base ring, top ring, base center and top center
+            mesh->vertexCount = slices*2 + 2;
+            mesh->indexCount = (type == SHAPE_MESH_CYLINDER)? slices*12 : slices*6;
+            mesh->vertices = (float *)RL_CALLOC(mesh->vertexCount*3, sizeof(float));
+            mesh->indices = (unsigned short *)RL_MALLOC(mesh->indexCount*sizeof(unsigned short));
+            if ((mesh->vertices == NULL) || (mesh->indices == NULL)) break;
+
+            for (int i = 0; i < slices; i++)
+            {
+                float *base = &mesh->vertices[i*3];
+                float *top = &mesh->vertices[(slices + i)*3];
+                base[0] = top[0] = sinf(2.0f*PI*i/slices);
+                base[2] = top[2] = cosf(2.0f*PI*i/slices);
+                top[1] = 1.0f;
+            }
+
+            mesh->vertices[(slices*2 + 1)*3 + 1] = 1.0f;
+
+            int k = 0;
+            for (int i = 0; i < slices; i++)
+            {
+                unsigned short b1 = (unsigned short)i;
+                unsigned short b2 = (unsigned short)((i + 1)%slices);
+                unsigned short t1 = (unsigned short)(slices + b1);
+                unsigned short t2 = (unsigned short)(slices + b2);
+
+                mesh->indices[k++] = b1; mesh->indices[k++] = b2; mesh->indices[k++] = t2;
+                mesh->indices[k++] = t1; mesh->indices[k++] = b1; mesh->indices[k++] = t2;
+
+                if (type == SHAPE_MESH_CYLINDER)
+                {
+                    mesh->indices[k++] = (unsigned short)(slices*2 + 1); mesh->indices[k++] = t1; mesh->indices[k++] = t2;
+                    mesh->indices[k++] = (unsigned short)(slices*2); mesh->indices[k++] = b2; mesh->indices[k++] = b1;
+                }
+            }
+        } break;
+        default: break;
+    }
+
+    // Mesh failed to allocate is not cached, last cached mesh is moved to its slot
+    if ((mesh->vertices == NULL) || (mesh->indices == NULL))
+    {
+        TRACELOG(LOG_WARNING, "MODEL: Failed to allocate shape mesh data");
+
+        UnloadShapeMesh(mesh);
+        *mesh = shapeMeshes[shapeMeshesCount - 1];
+        shapeMeshes[shapeMeshesCount - 1] = (ShapeMesh){ 0 };
+        shapeMeshesCount--;
+        mesh = NULL;
+    }
+
+    return mesh;
+}
+
+// Unload basic 3d shape mesh (RAM and VRAM)
+static void UnloadShapeMesh(ShapeMesh *mesh)
+{
+    if (mesh->vaoId > 0) rlUnloadVertexArray(mesh->vaoId);
+    for (int i = 0; i < 3; i++) if (mesh->vboId[i] > 0) rlUnloadVertexBuffer(mesh->vboId[i]);
+
+    RL_FREE(mesh->vertices);
+    RL_FREE(mesh->indices);
+    RL_FREE(mesh->instances);
+
+    *mesh = (ShapeMesh){ 0 };
+}
+
+// Check if basic 3d shapes can be drawn instanced
+// NOTE: Custom shaders (i.e. lighting) expect shapes vertex data through the render batch
+static bool IsShapeInstancingAvailable(void)
+{
+    bool available = false;
+
+#if defined(SUPPORT_INSTANCED_SHAPES) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    if (rlIsInstancingSupported() && (rlGetShaderIdCurrent() == rlGetShaderIdDefault()))
+    {
+        if (shapeShader.id == 0)
+        {
+            const char *vsCode =
+    #if defined(GRAPHICS_API_OPENGL_21)
+            "#version 120                       \n"
+            "attribute vec3 vertexPosition;     \n"
+            "attribute vec4 instanceTransform0; \n"
+            "attribute vec4 instanceTransform1; \n"
+            "attribute vec4 instanceTransform2; \n"
+            "attribute float instanceTaper;     \n"
+            "attribute vec4 instanceColor;      \n"
+            "varying vec4 fragColor;            \n"
+    #elif defined(GRAPHICS_API_OPENGL_ES2)
+            "#version 100                       \n"
+            "attribute vec3 vertexPosition;     \n"
+            "attribute vec4 instanceTransform0; \n"
+            "attribute vec4 instanceTransform1; \n"
+            "attribute vec4 instanceTransform2; \n"
+            "attribute float instanceTaper;     \n"
+            "attribute vec4 instanceColor;      \n"
+            "varying vec4 fragColor;            \n"
+    #else
+            "#version 330                       \n"
+            "in vec3 vertexPosition;            \n"
+            "in vec4 instanceTransform0;        \n"
+            "in vec4 instanceTransform1;        \n"
+            "in vec4 instanceTransform2;        \n"
+            "in float instanceTaper;            \n"
+            "in vec4 instanceColor;             \n"
+            "out vec4 fragColor;                \n"
+    #endif
+            "uniform mat4 mvp;                  \n"
+            "void main()                        \n"
+            "{                                  \n"
+            "    float scale = 1.0 + (instanceTaper - 1.0)*vertexPosition.y; \n"
+            "    vec4 position = vec4(vertexPosition.x*scale, vertexPosition.y, vertexPosition.z*scale, 1.0); \n"
+            "    fragColor = instanceColor;     \n"
+            "    gl_Position = mvp*vec4(dot(instanceTransform0, position), dot(instanceTransform1, position), dot(instanceTransform2, position), 1.0); \n"
+            "}                                  \n";
+
+            const char *fsCode =
+    #if defined(GRAPHICS_API_OPENGL_21)
+            "#version 120                       \n"
+            "varying vec4 fragColor;            \n"
+            "void main()                        \n"
+            "{                                  \n"
+            "    gl_FragColor = fragColor;      \n"
+            "}                                  \n";
+    #elif defined(GRAPHICS_API_OPENGL_ES2)
+            "#version 100                       \n"
+            "precision mediump float;           \n"
+            "varying vec4 fragColor;            \n"
+            "void main()                        \n"
+            "{                                  \n"
+            "    gl_FragColor = fragColor;      \n"
+            "}                                  \n";
+    #else
+            "#version 330                       \n"
+            "in vec4 fragColor;                 \n"
+            "out vec4 finalColor;               \n"
+            "void main()                        \n"
+            "{                                  \n"
+            "    finalColor = fragColor;        \n"
+            "}                                  \n";
+    #endif
+
+            shapeShader.id = rlLoadShaderCode(vsCode, fsCode);
+
+            if (shapeShader.id != rlGetShaderIdDefault())
+            {
+                shapeShader.locPosition = rlGetLocationAttrib(shapeShader.id, "vertexPosition");
+                shapeShader.locTransform[0] = rlGetLocationAttrib(shapeShader.id, "instanceTransform0");
+                shapeShader.locTransform[1] = rlGetLocationAttrib(shapeShader.id, "instanceTransform1");
+                shapeShader.locTransform[2] = rlGetLocationAttrib(shapeShader.id, "instanceTransform2");
+                shapeShader.locTaper = rlGetLocationAttrib(shapeShader.id, "instanceTaper");
+                shapeShader.locColor = rlGetLocationAttrib(shapeShader.id, "instanceColor");
+                shapeShader.locMvp = rlGetLocationUniform(shapeShader.id, "mvp");
+
+                // Instances queued are drawn before any render batch draw
+                rlSetRenderBatchDrawCallback(DrawShapeMeshesInstanced);
+            }
+            else TRACELOG(LOG_WARNING, "MODEL: Failed to load shapes instancing shader, shapes are drawn in immediate mode");
+        }
+
+        available = (shapeShader.id != rlGetShaderIdDefault());
+    }
+#endif
+
+    return available;
+}
+
+// Draw basic 3d shape mesh, transform maps the unit mesh into world space
+// NOTE: Instances are queued and drawn on next render batch draw, immediate mode is used otherwise
+static void DrawShapeMesh(int type, int rings, int slices, rl_Matrix transform, float taper, rl_Color color)
+{
+    ShapeMesh *mesh = LoadShapeMesh(type, rings, slices);
+    if (mesh == NULL) return;
+
+    bool instanced = IsShapeInstancingAvailable();
+
+    if (instanced)
+    {
+        // Keep drawing order only when it changes the result: depth test disabled or translucent shape,
+        // vertex data in render batch and other shapes instances queued must be drawn before this instance
+        // NOTE: Opaque shapes with depth test are drawn before batch vertex data added previously, the same final image,
+        // so interleaved shapes and batched drawing (i.e. cubes and cubes wires) are not split in several draws
+        bool ordered = !rlIsDepthTestEnabled() || (color.a < 255);
+
+        if (ordered && ((rlGetRenderBatchVertexCount() > 0) || (shapeInstancesQueued > mesh->instanceCount))) rlDrawRenderBatchActive();
+
+        if (mesh->vboId[0] == 0)
+        {
+            mesh->vaoId = rlLoadVertexArray();
+            rlEnableVertexArray(mesh->vaoId);
+            mesh->vboId[0] = rlLoadVertexBuffer(mesh->vertices, mesh->vertexCount*3*sizeof(float), false);
+            mesh->vboId[1] = rlLoadVertexBufferElement(mesh->indices, mesh->indexCount*sizeof(unsigned short), false);
+            rlDisableVertexArray();
+        }
+
+        // NOTE: Shape is drawn in immediate mode if instances can not grow
+        if (mesh->instanceCount >= mesh->instanceCapacity)
+        {
+            int capacity = (mesh->instanceCapacity > 0)? mesh->instanceCapacity*2 : 64;
+            ShapeInstance *instances = (ShapeInstance *)RL_REALLOC(mesh->instances, capacity*sizeof(ShapeInstance));
+
+            if (instances != NULL)
+            {
+                mesh->instances = instances;
+                mesh->instanceCapacity = capacity;
+            }
+            else
+            {
+                TRACELOG(LOG_WARNING, "MODEL: Failed to allocate shape instances, shape drawn in immediate mode");
+                instanced = false;
+            }
+        }
+    }
+
+    if (instanced)
+    {
+        // Accumulate internal matrix transform (push/pop), view matrix is applied on drawing
+        rl_Matrix matModel = MatrixMultiply(transform, rlGetMatrixTransform());
+
+        ShapeInstance *instance = &mesh->instances[mesh->instanceCount];
+        instance->transform[0] = matModel.m0;
+        instance->transform[1] = matModel.m4;
+        instance->transform[2] = matModel.m8;
+        instance->transform[3] = matModel.m12;
+        instance->transform[4] = matModel.m1;
+        instance->transform[5] = matModel.m5;
+        instance->transform[6] = matModel.m9;
+        instance->transform[7] = matModel.m13;
+        instance->transform[8] = matModel.m2;
+        instance->transform[9] = matModel.m6;
+        instance->transform[10] = matModel.m10;
+        instance->transform[11] = matModel.m14;
+        instance->taper = taper;
+        instance->color[0] = color.r;
+        instance->color[1] = color.g;
+        instance->color[2] = color.b;
+        instance->color[3] = color.a;
+
+        mesh->instanceCount++;
+        shapeInstancesQueued++;
+    }
+    else
+    {
+        // NOTE: Spheres provide smooth normals, other shapes provide triangles normals
+        bool smoothNormals = (type == SHAPE_MESH_SPHERE) || (type == SHAPE_MESH_HEMISPHERE);
+
+        rlPushMatrix();
+            rlMultMatrixf(MatrixToFloat(transform));
+
+            rlBegin(RL_TRIANGLES);
+                rlColor4ub(color.r, color.g, color.b, color.a);
+
+                for (int i = 0; i < mesh->indexCount; i += 3)
+                {
+                    rl_Vector3 vertices[3] = { 0 };
+
+                    for (int k = 0; k < 3; k++)
+                    {
+                        const float *vertex = &mesh->vertices[mesh->indices[i + k]*3];
+                        float scale = 1.0f + (taper - 1.0f)*vertex[1];
+                        vertices[k] = (rl_Vector3){ vertex[0]*scale, vertex[1], vertex[2]*scale };
+                    }
+
+                    if (!smoothNormals)
+                    {
+                        rl_Vector3 normal = Vector3CrossProduct(Vector3Subtract(vertices[1], vertices[0]), Vector3Subtract(vertices[2], vertices[0]));
+                        rlNormal3f(normal.x, normal.y, normal.z);
+                    }
+
+                    for (int k = 0; k < 3; k++)
+                    {
+                        if (smoothNormals) rlNormal3f(vertices[k].x, vertices[k].y, vertices[k].z);
+                        rlVertex3f(vertices[k].x, vertices[k].y, vertices[k].z);
+                    }
+                }
+            rlEnd();
+        rlPopMatrix();
+    }
+}
+
+#if defined(SUPPORT_INSTANCED_SHAPES) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+// Draw basic 3d shapes instances queued, one instanced draw call per shape mesh
+// NOTE: Called by rlgl before any render batch draw, current matrices are the ones used for batch
+static void DrawShapeMeshesInstanced(void)
+{
+    if (shapeInstancesQueued == 0) return;
+
+    rl_Matrix matModelView = rlGetMatrixModelview();
+    rl_Matrix matProjection = rlGetMatrixProjection();
+
+    int eyeCount = 1;
+    if (rlIsStereoRenderEnabled()) eyeCount = 2;
+
+    rlEnableShader(shapeShader.id);
+
+    for (int i = 0; i < shapeMeshesCount; i++)
+    {
+        ShapeMesh *mesh = &shapeMeshes[i];
+
+        if (mesh->instanceCount == 0) continue;
+
+        // Upload instances, buffer is reloaded only when it requires to grow
+        if (mesh->instanceCount > mesh->vboInstanceCapacity)
+        {
+            rlUnloadVertexBuffer(mesh->vboId[2]);
+            mesh->vboInstanceCapacity = mesh->instanceCapacity;
+            mesh->vboId[2] = rlLoadVertexBuffer(NULL, mesh->vboInstanceCapacity*sizeof(ShapeInstance), true);
+
+            if (rlEnableVertexArray(mesh->vaoId)) SetShapeMeshAttributes(mesh);
+        }
+
+        rlUpdateVertexBuffer(mesh->vboId[2], mesh->instances, mesh->instanceCount*sizeof(ShapeInstance), 0);
+
+        // Try binding vertex array objects (VAO) or use VBOs if not possible
+        if (!rlEnableVertexArray(mesh->vaoId)) SetShapeMeshAttributes(mesh);
+
+        for (int eye = 0; eye < eyeCount; eye++)
+        {
+            // Calculate model-view-projection matrix (MVP)
+            rl_Matrix matModelViewProjection = MatrixIdentity();
+            if (eyeCount == 1) matModelViewProjection = MatrixMultiply(matModelView, matProjection);
+            else
+            {
+                // Setup current eye viewport (half screen width)
+                rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
+                matModelViewProjection = MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
+            }
+
+            rlSetUniformMatrix(shapeShader.locMvp, matModelViewProjection);
+
+            rlDrawVertexArrayElementsInstanced(0, mesh->indexCount, 0, mesh->instanceCount);
+        }
+
+        // Without VAO, instance attributes must not be left enabled for render batch drawing
+        if (mesh->vaoId == 0)
+        {
+            int locs[5] = { shapeShader.locTransform[0], shapeShader.locTransform[1], shapeShader.locTransform[2], shapeShader.locTaper, shapeShader.locColor };
+
+            for (int k = 0; k < 5; k++)
+            {
+                rlSetVertexAttributeDivisor(locs[k], 0);
+                rlDisableVertexAttribute(locs[k]);
+            }
+        }
+
+        mesh->instanceCount = 0;
+    }
+
+    if (eyeCount == 2) rlViewport(0, 0, rlGetFramebufferWidth(), rlGetFramebufferHeight());
+
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableVertexBufferElement();
+    rlDisableShader();
+
+    shapeInstancesQueued = 0;
+}
+
+// Set basic 3d shape mesh vertex and instance attributes (current VAO or global state)
+static void SetShapeMeshAttributes(ShapeMesh *mesh)
+{
+    rlEnableVertexBuffer(mesh->vboId[0]);
+    rlSetVertexAttribute(shapeShader.locPosition, 3, RL_FLOAT, false, 0, 0);
+    rlEnableVertexAttribute(shapeShader.locPosition);
+
+    // Instance data: transform rows (3 x vec4), taper (float) and color (4 x unsigned byte)
+    rlEnableVertexBuffer(mesh->vboId[2]);
+    for (int i = 0; i < 3; i++)
+    {
+        rlSetVertexAttribute(shapeShader.locTransform[i], 4, RL_FLOAT, false, sizeof(ShapeInstance), i*4*sizeof(float));
+        rlEnableVertexAttribute(shapeShader.locTransform[i]);
+        rlSetVertexAttributeDivisor(shapeShader.locTransform[i], 1);
+    }
+
+    rlSetVertexAttribute(shapeShader.locTaper, 1, RL_FLOAT, false, sizeof(ShapeInstance), 12*sizeof(float));
+    rlEnableVertexAttribute(shapeShader.locTaper);
+    rlSetVertexAttributeDivisor(shapeShader.locTaper, 1);
+
+    rlSetVertexAttribute(shapeShader.locColor, 4, RL_UNSIGNED_BYTE, true, sizeof(ShapeInstance), 13*sizeof(float));
+    rlEnableVertexAttribute(shapeShader.locColor);
+    rlSetVertexAttributeDivisor(shapeShader.locColor, 1);
+
+    rlEnableVertexBufferElement(mesh->vboId[1]);
+}
+#endif
+
+// Build pose from parent joints
+// NOTE: Required for animations loading and sampling
+static void BuildPoseFromParentJoints(rl_BoneInfo *bones, int boneCount, rl_Transform *transforms)
+{
+    for (int i = 0; i < boneCount; i++)
+    {
+        if (bones[i].parent >= 0)
+        {
+            if (bones[i].parent > i)
+            {
+                TRACELOG(LOG_WARNING, "Assumes bones are toplogically sorted, but bone %d has parent %d. Skipping.", i, bones[i].parent);
+                continue;
+            }
+            transforms[i].rotation = QuaternionMultiply(transforms[bones[i].parent].rotation, transforms[i].rotation);
+            transforms[i].translation = Vector3RotateByQuaternion(transforms[i].translation, transforms[bones[i].parent].rotation);
+            transforms[i].translation = Vector3Add(transforms[i].translation, transforms[bones[i].parent].translation);
+            transforms[i].scale = Vector3Multiply(transforms[i].scale, transforms[bones[i].parent].scale);
+        }
+    }
+}
+// Update model animated vertex data (positions and normals) for a given bones pose (model space)
+// NOTE: Updated data is uploaded to GPU
+static void UpdateModelAnimationVertices(rl_Model model, const rl_Transform *pose)
+{
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        rl_Mesh mesh = model.meshes[m];
+
+        if (mesh.boneIds == NULL || mesh.boneWeights == NULL)
+        {
+            TRACELOG(LOG_WARNING, "MODEL: rl_UpdateModelAnimation(): rl_Mesh %i has no connection to bones", m);
+            continue;
+        }
+
+        bool updated = false;           // Flag to check when anim vertex information is updated
+        rl_Vector3 animVertex = { 0 };
+        rl_Vector3 animNormal = { 0 };
+
+        rl_Vector3 inTranslation = { 0 };
+        Quaternion inRotation = { 0 };
+        // rl_Vector3 inScale = { 0 };
+
+        rl_Vector3 outTranslation = { 0 };
+        Quaternion outRotation = { 0 };
+        rl_Vector3 outScale = { 0 };
+
+        int boneId = 0;
+        int boneCounter = 0;
+        float boneWeight = 0.0;
+
+        const int vValues = mesh.vertexCount*3;
+        for (int vCounter = 0; vCounter < vValues; vCounter += 3)
+        {
+            mesh.animVertices[vCounter] = 0;
+            mesh.animVertices[vCounter + 1] = 0;
+            mesh.animVertices[vCounter + 2] = 0;
+
+            if (mesh.animNormals != NULL)
+            {
+                mesh.animNormals[vCounter] = 0;
+                mesh.animNormals[vCounter + 1] = 0;
+                mesh.animNormals[vCounter + 2] = 0;
+            }
+
+            // Iterates over 4 bones per vertex
+            for (int j = 0; j < 4; j++, boneCounter++)
+            {
+                boneWeight = mesh.boneWeights[boneCounter];
+
+                // Early stop when no transformation will be applied
+                if (boneWeight == 0.0f) continue;
+
+                boneId = mesh.boneIds[boneCounter];
+                //int boneIdParent = model.bones[boneId].parent;
+                inTranslation = model.bindPose[boneId].translation;
+                inRotation = model.bindPose[boneId].rotation;
+                //inScale = model.bindPose[boneId].scale;
+                outTranslation = pose[boneId].translation;
+                outRotation = pose[boneId].rotation;
+                outScale = pose[boneId].scale;
+
+                // Vertices processing
+                // NOTE: We use meshes.vertices (default vertex position) to calculate meshes.animVertices (animated vertex position)
+                animVertex = (rl_Vector3){ mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
+                animVertex = Vector3Subtract(animVertex, inTranslation);
+                animVertex = Vector3Multiply(animVertex, outScale);
+                animVertex = Vector3RotateByQuaternion(animVertex, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
+                animVertex = Vector3Add(animVertex, outTranslation);
+                //animVertex = Vector3Transform(animVertex, model.transform);
+                mesh.animVertices[vCounter] += animVertex.x*boneWeight;
+                mesh.animVertices[vCounter + 1] += animVertex.y*boneWeight;
+                mesh.animVertices[vCounter + 2] += animVertex.z*boneWeight;
+                updated = true;
+
+                // Normals processing
+                // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
+                if (mesh.normals != NULL)
+                {
+                    animNormal = (rl_Vector3){ mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
+                    animNormal = Vector3RotateByQuaternion(animNormal, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
+                    mesh.animNormals[vCounter] += animNormal.x*boneWeight;
+                    mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
+                    mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
+                }
+            }
+        }
+
+        // Upload new vertex data to GPU for model drawing
+        // NOTE: Only update data when values changed
+        if (updated)
+        {
+            rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0); // Update vertex position
+            rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);  // Update vertex normals
+        }
+    }
+}
+
+// Get keyframe index for a given time and interpolation amount to the next keyframe
+// NOTE: Keyframes times are expected in ascending order
+static int GetKeyframeIndex(const float *times, int count, float time, float *amount)
+{
+    *amount = 0.0f;
 
-    collision.normal = Vector3Normalize(collision.normal);
+    if ((count <= 1) || (time <= times[0])) return 0;
+    if (time >= times[count - 1]) return count - 1;
 
-    if (insideBox)
+    // Binary search the keyframes interval containing time
+    int low = 0;
+    int high = count - 1;
+
+    while ((high - low) > 1)
     {
-        // Reset ray.direction
-        ray.direction = Vector3Negate(ray.direction);
-        // Fix result
-        collision.distance *= -1.0f;
-        collision.normal = Vector3Negate(collision.normal);
+        int mid = (low + high)/2;
+
+        if (times[mid] <= time) low = mid;
+        else high = mid;
     }
 
-    return collision;
+    float delta = times[high] - times[low];
+    if (delta > 0.0f) *amount = (time - times[low])/delta;
+
+    return low;
 }
 
-// Get collision info between ray and mesh
-rl_RayCollision rl_GetRayCollisionMesh(rl_Ray ray, rl_Mesh mesh, rl_Matrix transform)
+// Sample bone track at time, returns local transform (parent-relative)
+// NOTE: Channels with no keyframes return the identity transform
+static rl_Transform SampleBoneTrack(rl_BoneTrack track, float time)
 {
-    rl_RayCollision collision = { 0 };
+    rl_Transform transform = { { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 1.0f }, { 1.0f, 1.0f, 1.0f } };
+    float amount = 0.0f;
+    int index = 0;
 
-    // Check if mesh vertex data on CPU for testing
-    if (mesh.vertices != NULL)
+    if (track.translationCount > 0)
     {
-        int triangleCount = mesh.triangleCount;
-
-        // Test against all triangles in mesh
-        for (int i = 0; i < triangleCount; i++)
-        {
-            rl_Vector3 a, b, c;
-            rl_Vector3* vertdata = (rl_Vector3*)mesh.vertices;
+        index = GetKeyframeIndex(track.translationTimes, track.translationCount, time, &amount);
+        if (amount > 0.0f) transform.translation = Vector3Lerp(track.translations[index], track.translations[index + 1], amount);
+        else transform.translation = track.translations[index];
+    }
 
-            if (mesh.indices)
-            {
-                a = vertdata[mesh.indices[i*3 + 0]];
-                b = vertdata[mesh.indices[i*3 + 1]];
-                c = vertdata[mesh.indices[i*3 + 2]];
-            }
-            else
-            {
-                a = vertdata[i*3 + 0];
-                b = vertdata[i*3 + 1];
-                c = vertdata[i*3 + 2];
-            }
+    if (track.rotationCount > 0)
+    {
+        index = GetKeyframeIndex(track.rotationTimes, track.rotationCount, time, &amount);
+        if (amount > 0.0f) transform.rotation = QuaternionSlerp(track.rotations[index], track.rotations[index + 1], amount);
+        else transform.rotation = track.rotations[index];
+    }
 
-            a = Vector3Transform(a, transform);
-            b = Vector3Transform(b, transform);
-            c = Vector3Transform(c, transform);
+    if (track.scaleCount > 0)
+    {
+        index = GetKeyframeIndex(track.scaleTimes, track.scaleCount, time, &amount);
+        if (amount > 0.0f) transform.scale = Vector3Lerp(track.scales[index], track.scales[index + 1], amount);
+        else transform.scale = track.scales[index];
+    }
 
-            rl_RayCollision triHitInfo = rl_GetRayCollisionTriangle(ray, a, b, c);
+    return transform;
+}
 
-            if (triHitInfo.hit)
-            {
-                // Save the closest hit triangle
-                if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
-            }
-        }
+// Get animation bones local pose (parent-relative) sampled at time (seconds)
+// NOTE: Requires animation keyframe tracks, time loops over animation duration
+static void GetModelAnimationLocalPose(rl_ModelAnimation anim, float time, rl_Transform *pose)
+{
+    if (anim.duration > 0.0f)
+    {
+        time = fmodf(time, anim.duration);
+        if (time < 0.0f) time += anim.duration;
     }
+    else time = 0.0f;
 
-    return collision;
+    for (int i = 0; i < anim.boneCount; i++) pose[i] = SampleBoneTrack(anim.tracks[i], time);
 }
 
-// Get collision info between ray and triangle
-// NOTE: The points are expected to be in counter-clockwise winding
-// NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
-rl_RayCollision rl_GetRayCollisionTriangle(rl_Ray ray, rl_Vector3 p1, rl_Vector3 p2, rl_Vector3 p3)
+// Get animation duration (seconds)
+// NOTE: Baked animations built without duration are considered at ANIMATION_DEFAULT_FRAME_TIME per frame
+static float GetModelAnimationDuration(rl_ModelAnimation anim)
 {
-    #define EPSILON 0.000001f        // A small number
+    float duration = anim.duration;
 
-    rl_RayCollision collision = { 0 };
-    rl_Vector3 edge1 = { 0 };
-    rl_Vector3 edge2 = { 0 };
-    rl_Vector3 p, q, tv;
-    float det, invDet, u, v, t;
+    if ((duration <= 0.0f) && (anim.tracks == NULL) && (anim.frameCount > 1)) duration = (float)(anim.frameCount - 1)*ANIMATION_DEFAULT_FRAME_TIME;
 
-    // Find vectors for two edges sharing V1
-    edge1 = Vector3Subtract(p2, p1);
-    edge2 = Vector3Subtract(p3, p1);
+    return duration;
+}
 
-    // Begin calculating determinant - also used to calculate u parameter
-    p = Vector3CrossProduct(ray.direction, edge2);
+// Load animation poses buffer, stack buffer is used if count fits
+// NOTE: Stack buffer must hold ANIMATION_POSES_STACK_BONES transforms, buffer is per call (animation update is reentrant),
+// returns NULL if it could not be allocated
+static rl_Transform *LoadAnimationPoses(int count, rl_Transform *stackPoses)
+{
+    if (count <= ANIMATION_POSES_STACK_BONES) return stackPoses;
 
-    // If determinant is near zero, ray lies in plane of triangle or ray is parallel to plane of triangle
-    det = Vector3DotProduct(edge1, p);
+    rl_Transform *poses = (rl_Transform *)RL_MALLOC(count*sizeof(rl_Transform));
+    if (poses == NULL) TRACELOG(LOG_WARNING, "MODEL: Failed to allocate animation poses");
 
-    // Avoid culling!
-    if ((det > -EPSILON) && (det < EPSILON)) return collision;
+    return poses;
+}
 
-    invDet = 1.0f/det;
+// Unload animation poses buffer, if not stack buffer
+static void UnloadAnimationPoses(rl_Transform *poses, rl_Transform *stackPoses)
+{
+    if (poses != stackPoses) RL_FREE(poses);
+}
 
-    // Calculate distance from V1 to ray origin
-    tv = Vector3Subtract(ray.position, p1);
+// Reduce keyframes that can be linearly interpolated from its neighbours within tolerance
+// NOTE: Keyframes are compacted in-place, first and last keyframes are always kept,
+// returns the resulting number of keyframes
+static int ReduceKeyframes(float *times, float *values, int count, int components, float tolerance)
+{
+    if (count <= 2)
+    {
+        // Constant channel, a single keyframe is enough
+        if (count == 2)
+        {
+            bool constant = true;
+            for (int c = 0; c < components; c++) if (fabsf(values[c] - values[components + c]) > tolerance) constant = false;
+            if (constant) count = 1;
+        }
 
-    // Calculate u parameter and test bound
-    u = Vector3DotProduct(tv, p)*invDet;
+        return count;
+    }
 
-    // The intersection lies outside the triangle
-    if ((u < 0.0f) || (u > 1.0f)) return collision;
+    int anchor = 0;     // Last kept keyframe (original index)
+    int kept = 1;       // Number of keyframes kept (first keyframe is always kept)
 
-    // Prepare to test v parameter
-    q = Vector3CrossProduct(tv, edge1);
+    for (int i = 1; i < (count - 1); i++)
+    {
+        // Check if keyframes in range (anchor, i] can be interpolated from anchor to next keyframe
+        bool required = false;
+        float duration = times[i + 1] - times[anchor];
 
-    // Calculate V parameter and test bound
-    v = Vector3DotProduct(ray.direction, q)*invDet;
+        for (int k = anchor + 1; (k <= i) && !required; k++)
+        {
+            float amount = (duration > 0.0f)? (times[k] - times[anchor])/duration : 0.0f;
 
-    // The intersection lies outside the triangle
-    if ((v < 0.0f) || ((u + v) > 1.0f)) return collision;
+            for (int c = 0; c < components; c++)
+            {
+                float value = values[anchor*components + c] + (values[(i + 1)*components + c] - values[anchor*components + c])*amount;
 
-    t = Vector3DotProduct(edge2, q)*invDet;
+                if (fabsf(value - values[k*components + c]) > tolerance) { required = true; break; }
+            }
+        }
 
-    if (t > EPSILON)
-    {
-        // rl_Ray hit, get hit point and normal
-        collision.hit = true;
-        collision.distance = t;
-        collision.normal = Vector3Normalize(Vector3CrossProduct(edge1, edge2));
-        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, t));
+        if (required)
+        {
+            // NOTE: Writing to kept index never overrides keyframes still required (kept <= i)
+            times[kept] = times[i];
+            for (int c = 0; c < components; c++) values[kept*components + c] = values[i*components + c];
+            anchor = i;
+            kept++;
+        }
     }
 
-    return collision;
+    times[kept] = times[count - 1];
+    for (int c = 0; c < components; c++) values[kept*components + c] = values[(count - 1)*components + c];
+    kept++;
+
+    // Check again for a constant channel
+    if (kept == 2) kept = ReduceKeyframes(times, values, kept, components, tolerance);
+
+    return kept;
 }
 
-// Get collision info between ray and quad
-// NOTE: The points are expected to be in counter-clockwise winding
-rl_RayCollision rl_GetRayCollisionQuad(rl_Ray ray, rl_Vector3 p1, rl_Vector3 p2, rl_Vector3 p3, rl_Vector3 p4)
+// Compact keyframes channel, reducing redundant keyframes and freeing unused memory
+static int CompactKeyframes(float **times, float **values, int count, int components)
 {
-    rl_RayCollision collision = { 0 };
+    if (count == 0)
+    {
+        RL_FREE(*times);
+        RL_FREE(*values);
+        *times = NULL;
+        *values = NULL;
 
-    collision = rl_GetRayCollisionTriangle(ray, p1, p2, p4);
+        return 0;
+    }
 
-    if (!collision.hit) collision = rl_GetRayCollisionTriangle(ray, p2, p3, p4);
+    count = ReduceKeyframes(*times, *values, count, components, ANIMATION_KEYFRAME_TOLERANCE);
 
-    return collision;
+    *times = RL_REALLOC(*times, count*sizeof(float));
+    *values = RL_REALLOC(*values, count*components*sizeof(float));
+
+    return count;
 }
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
-#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
-// Build pose from parent joints
-// NOTE: Required for animations loading (required by IQM and GLTF)
-static void BuildPoseFromParentJoints(rl_BoneInfo *bones, int boneCount, rl_Transform *transforms)
+#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_M3D)
+// Load bones keyframe tracks from local poses (parent-relative) sampled at regular intervals
+// NOTE: Used by formats that provide baked frames (IQM, M3D), redundant keyframes are reduced
+static rl_BoneTrack *LoadBoneTracksFromPoses(rl_Transform **poses, int frameCount, int boneCount, float frameTime)
 {
+    rl_BoneTrack *tracks = RL_CALLOC(boneCount, sizeof(rl_BoneTrack));
+
     for (int i = 0; i < boneCount; i++)
     {
-        if (bones[i].parent >= 0)
+        tracks[i].translationTimes = RL_MALLOC(frameCount*sizeof(float));
+        tracks[i].rotationTimes = RL_MALLOC(frameCount*sizeof(float));
+        tracks[i].scaleTimes = RL_MALLOC(frameCount*sizeof(float));
+        tracks[i].translations = RL_MALLOC(frameCount*sizeof(rl_Vector3));
+        tracks[i].rotations = RL_MALLOC(frameCount*sizeof(Quaternion));
+        tracks[i].scales = RL_MALLOC(frameCount*sizeof(rl_Vector3));
+
+        for (int f = 0; f < frameCount; f++)
         {
-            if (bones[i].parent > i)
+            float time = (float)f*frameTime;
+
+            tracks[i].translationTimes[f] = time;
+            tracks[i].rotationTimes[f] = time;
+            tracks[i].scaleTimes[f] = time;
+            tracks[i].translations[f] = poses[f][i].translation;
+            tracks[i].rotations[f] = poses[f][i].rotation;
+            tracks[i].scales[f] = poses[f][i].scale;
+
+            // Keep quaternions in the same hemisphere for interpolation and keyframes reduction
+            if ((f > 0) && (Vector4DotProduct(tracks[i].rotations[f - 1], tracks[i].rotations[f]) < 0.0f))
             {
-                TRACELOG(LOG_WARNING, "Assumes bones are toplogically sorted, but bone %d has parent %d. Skipping.", i, bones[i].parent);
-                continue;
+                tracks[i].rotations[f] = QuaternionScale(tracks[i].rotations[f], -1.0f);
             }
-            transforms[i].rotation = QuaternionMultiply(transforms[bones[i].parent].rotation, transforms[i].rotation);
-            transforms[i].translation = Vector3RotateByQuaternion(transforms[i].translation, transforms[bones[i].parent].rotation);
-            transforms[i].translation = Vector3Add(transforms[i].translation, transforms[bones[i].parent].translation);
-            transforms[i].scale = Vector3Multiply(transforms[i].scale, transforms[bones[i].parent].scale);
         }
+
+        tracks[i].translationCount = CompactKeyframes(&tracks[i].translationTimes, (float **)&tracks[i].translations, frameCount, 3);
+        tracks[i].rotationCount = CompactKeyframes(&tracks[i].rotationTimes, (float **)&tracks[i].rotations, frameCount, 4);
+        tracks[i].scaleCount = CompactKeyframes(&tracks[i].scaleTimes, (float **)&tracks[i].scales, frameCount, 3);
     }
+
+    return tracks;
 }
 #endif
 
@@ -4170,7 +4934,7 @@ static rl_Model LoadIQM(const char *fileName)
     #define MATERIAL_NAME_LENGTH 32         // rl_Material name string length
 
     int dataSize = 0;
-    unsigned char *fileData = rl_LoadFileData(fileName, &dataSize);
+    unsigned char *fileData = rl_LoadFileDataMapped(fileName, &dataSize);
     unsigned char *fileDataPtr = fileData;
 
     // IQM file structs
@@ -4281,12 +5045,14 @@ static rl_Model LoadIQM(const char *fileName)
     if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
     {
         TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
+        rl_UnloadFileDataMapped(fileData, dataSize);
         return model;
     }
 
     if (iqmHeader->version != IQM_VERSION)
     {
         TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
+        rl_UnloadFileDataMapped(fileData, dataSize);
         return model;
     }
 
@@ -4517,7 +5283,7 @@ static rl_Model LoadIQM(const char *fileName)
 
     BuildPoseFromParentJoints(model.bones, model.boneCount, model.bindPose);
 
-    rl_UnloadFileData(fileData);
+    rl_UnloadFileDataMapped(fileData, dataSize);
 
     RL_FREE(imesh);
     RL_FREE(tri);
@@ -4540,7 +5306,7 @@ static rl_ModelAnimation *LoadModelAnimationsIQM(const char *fileName, int *anim
     #define IQM_VERSION     2                   // only IQM version 2 supported
 
     int dataSize = 0;
-    unsigned char *fileData = rl_LoadFileData(fileName, &dataSize);
+    unsigned char *fileData = rl_LoadFileDataMapped(fileName, &dataSize);
     unsigned char *fileDataPtr = fileData;
 
     typedef struct IQMHeader {
@@ -4589,12 +5355,14 @@ static rl_ModelAnimation *LoadModelAnimationsIQM(const char *fileName, int *anim
     if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
     {
         TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
+        rl_UnloadFileDataMapped(fileData, dataSize);
         return NULL;
     }
 
     if (iqmHeader->version != IQM_VERSION)
     {
         TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
+        rl_UnloadFileDataMapped(fileData, dataSize);
         return NULL;
     }
 
@@ -4631,7 +5399,6 @@ static rl_ModelAnimation *LoadModelAnimationsIQM(const char *fileName, int *anim
         animations[a].framePoses = RL_MALLOC(anim[a].num_frames*sizeof(rl_Transform *));
         memcpy(animations[a].name, fileDataPtr + iqmHeader->ofs_text + anim[a].name, 32);   //  I don't like this 32 here 
         rl_TraceLog(LOG_INFO, "IQM Anim %s", animations[a].name);
-        // animations[a].framerate = anim.framerate;     // TODO: Use animation framerate data?
 
         for (unsigned int j = 0; j < iqmHeader->num_poses; j++)
         {
@@ -4735,23 +5502,19 @@ static rl_ModelAnimation *LoadModelAnimationsIQM(const char *fileName, int *anim
             }
         }
 
-        // Build frameposes
-        for (unsigned int frame = 0; frame < anim[a].num_frames; frame++)
-        {
-            for (int i = 0; i < animations[a].boneCount; i++)
-            {
-                if (animations[a].bones[i].parent >= 0)
-                {
-                    animations[a].framePoses[frame][i].rotation = QuaternionMultiply(animations[a].framePoses[frame][animations[a].bones[i].parent].rotation, animations[a].framePoses[frame][i].rotation);
-                    animations[a].framePoses[frame][i].translation = Vector3RotateByQuaternion(animations[a].framePoses[frame][i].translation, animations[a].framePoses[frame][animations[a].bones[i].parent].rotation);
-                    animations[a].framePoses[frame][i].translation = Vector3Add(animations[a].framePoses[frame][i].translation, animations[a].framePoses[frame][animations[a].bones[i].parent].translation);
-                    animations[a].framePoses[frame][i].scale = Vector3Multiply(animations[a].framePoses[frame][i].scale, animations[a].framePoses[frame][animations[a].bones[i].parent].scale);
-                }
-            }
-        }
+        // Convert local frame poses into keyframe tracks, baked frames are not kept
+        // NOTE: IQM stores frames at a fixed framerate, redundant keyframes are reduced
+        float frameTime = (anim[a].framerate > 0.0f)? 1.0f/anim[a].framerate : 1.0f/60.0f;
+
+        animations[a].tracks = LoadBoneTracksFromPoses(animations[a].framePoses, animations[a].frameCount, animations[a].boneCount, frameTime);
+        animations[a].duration = (animations[a].frameCount > 1)? (float)(animations[a].frameCount - 1)*frameTime : 0.0f;
+
+        for (unsigned int frame = 0; frame < anim[a].num_frames; frame++) RL_FREE(animations[a].framePoses[frame]);
+        RL_FREE(animations[a].framePoses);
+        animations[a].framePoses = NULL;
     }
 
-    rl_UnloadFileData(fileData);
+    rl_UnloadFileDataMapped(fileData, dataSize);
 
     RL_FREE(joints);
     RL_FREE(framedata);
@@ -4825,7 +5588,11 @@ static rl_Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *tex
         }
         else     // Check if image is provided as image path
         {
-            image = rl_LoadImage(rl_TextFormat("%s/%s", texPath, cgltfImage->uri));
+            // NOTE: Path is not composed with rl_TextFormat(), images can be loaded on loader threads
+            char *imagePath = (char *)RL_CALLOC(strlen(texPath) + strlen(cgltfImage->uri) + 2, 1);
+            sprintf(imagePath, "%s/%s", texPath, cgltfImage->uri);
+            image = rl_LoadImage(imagePath);
+            RL_FREE(imagePath);
         }
     }
     else if (cgltfImage->buffer_view->buffer->data != NULL)    // Check if image is provided as data buffer
@@ -4847,7 +5614,7 @@ static rl_Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *tex
             (strcmp(cgltfImage->mime_type, "image/png") == 0)) image = rl_LoadImageFromMemory(".png", data, (int)cgltfImage->buffer_view->size);
         else if ((strcmp(cgltfImage->mime_type, "image\\/jpeg") == 0) ||
                  (strcmp(cgltfImage->mime_type, "image/jpeg") == 0)) image = rl_LoadImageFromMemory(".jpg", data, (int)cgltfImage->buffer_view->size);
-        else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized", rl_TextFormat("%s/%s", texPath, cgltfImage->uri));
+        else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized");
 
         RL_FREE(data);
     }
@@ -4855,6 +5622,28 @@ static rl_Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *tex
     return image;
 }
 
+// Load glTF image job, run on loader threads
+static void LoadImageGLTFJob(void *userData)
+{
+    ImageLoadGLTF *load = (ImageLoadGLTF *)userData;
+
+    load->image = LoadImageFromCgltfImage(load->cgltfImage, load->texPath);
+}
+
+// Get glTF image loaded, waiting for its loader job
+static rl_Image GetImageGLTF(ImageLoadGLTF *images, cgltf_data *data, cgltf_image *cgltfImage)
+{
+    ImageLoadGLTF *load = &images[cgltfImage - data->images];
+
+    if (load->jobId >= 0)
+    {
+        WaitLoaderJob(load->jobId);
+        load->jobId = -1;
+    }
+
+    return load->image;
+}
+
 // Load bone info from GLTF skin data
 static rl_BoneInfo *LoadBoneInfoGLTF(cgltf_skin skin, int *boneCount)
 {
@@ -4931,7 +5720,7 @@ static rl_Model LoadGLTF(const char *fileName)
 
     // glTF file loading
     int dataSize = 0;
-    unsigned char *fileData = rl_LoadFileData(fileName, &dataSize);
+    unsigned char *fileData = rl_LoadFileDataMapped(fileName, &dataSize);
 
     if (fileData == NULL) return model;
 
@@ -4975,12 +5764,29 @@ static rl_Model LoadGLTF(const char *fileName)
         // Load mesh-material indices, by default all meshes are mapped to material index: 0
         model.meshMaterial = RL_CALLOC(model.meshCount, sizeof(int));
 
+        // Queue images loading on loader threads, textures are uploaded on main thread as images get loaded
+        // NOTE: Images shared by several materials textures are only loaded once
+        //----------------------------------------------------------------------------------------------------
+        const char *dirPath = rl_GetDirectoryPath(fileName);
+        char *texPath = (char *)RL_CALLOC(strlen(dirPath) + 1, 1);
+        strcpy(texPath, dirPath);
+
+        ImageLoadGLTF *images = (ImageLoadGLTF *)RL_CALLOC(data->images_count, sizeof(ImageLoadGLTF));
+
+        for (unsigned int i = 0; i < data->images_count; i++)
+        {
+            images[i].cgltfImage = &data->images[i];
+            images[i].texPath = texPath;
+            images[i].jobId = AddLoaderJob(LoadImageGLTFJob, &images[i]);
+
+            if (images[i].jobId < 0) LoadImageGLTFJob(&images[i]);
+        }
+
         // Load materials data
         //----------------------------------------------------------------------------------------------------
         for (unsigned int i = 0, j = 1; i < data->materials_count; i++, j++)
         {
             model.materials[j] = rl_LoadMaterialDefault();
-            const char *texPath = rl_GetDirectoryPath(fileName);
 
             // Check glTF material flow: PBR metallic/roughness flow
             // NOTE: Alternatively, materials can follow PBR specular/glossiness flow
@@ -4989,12 +5795,8 @@ static rl_Model LoadGLTF(const char *fileName)
                 // Load base color texture (albedo)
                 if (data->materials[i].pbr_metallic_roughness.base_color_texture.texture)
                 {
-                    rl_Image imAlbedo = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.base_color_texture.texture->image, texPath);
-                    if (imAlbedo.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_ALBEDO].texture = rl_LoadTextureFromImage(imAlbedo);
-                        rl_UnloadImage(imAlbedo);
-                    }
+                    rl_Image imAlbedo = GetImageGLTF(images, data, data->materials[i].pbr_metallic_roughness.base_color_texture.texture->image);
+                    if (imAlbedo.data != NULL) model.materials[j].maps[MATERIAL_MAP_ALBEDO].texture = rl_LoadTextureFromImage(imAlbedo);
                 }
                 // Load base color factor (tint)
                 model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.r = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[0]*255);
@@ -5005,12 +5807,8 @@ static rl_Model LoadGLTF(const char *fileName)
                 // Load metallic/roughness texture
                 if (data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture)
                 {
-                    rl_Image imMetallicRoughness = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture->image, texPath);
-                    if (imMetallicRoughness.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].texture = rl_LoadTextureFromImage(imMetallicRoughness);
-                        rl_UnloadImage(imMetallicRoughness);
-                    }
+                    rl_Image imMetallicRoughness = GetImageGLTF(images, data, data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture->image);
+                    if (imMetallicRoughness.data != NULL) model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].texture = rl_LoadTextureFromImage(imMetallicRoughness);
 
                     // Load metallic/roughness material properties
                     float roughness = data->materials[i].pbr_metallic_roughness.roughness_factor;
@@ -5023,34 +5821,22 @@ static rl_Model LoadGLTF(const char *fileName)
                 // Load normal texture
                 if (data->materials[i].normal_texture.texture)
                 {
-                    rl_Image imNormal = LoadImageFromCgltfImage(data->materials[i].normal_texture.texture->image, texPath);
-                    if (imNormal.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_NORMAL].texture = rl_LoadTextureFromImage(imNormal);
-                        rl_UnloadImage(imNormal);
-                    }
+                    rl_Image imNormal = GetImageGLTF(images, data, data->materials[i].normal_texture.texture->image);
+                    if (imNormal.data != NULL) model.materials[j].maps[MATERIAL_MAP_NORMAL].texture = rl_LoadTextureFromImage(imNormal);
                 }
 
                 // Load ambient occlusion texture
                 if (data->materials[i].occlusion_texture.texture)
                 {
-                    rl_Image imOcclusion = LoadImageFromCgltfImage(data->materials[i].occlusion_texture.texture->image, texPath);
-                    if (imOcclusion.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_OCCLUSION].texture = rl_LoadTextureFromImage(imOcclusion);
-                        rl_UnloadImage(imOcclusion);
-                    }
+                    rl_Image imOcclusion = GetImageGLTF(images, data, data->materials[i].occlusion_texture.texture->image);
+                    if (imOcclusion.data != NULL) model.materials[j].maps[MATERIAL_MAP_OCCLUSION].texture = rl_LoadTextureFromImage(imOcclusion);
                 }
 
                 // Load emissive texture
                 if (data->materials[i].emissive_texture.texture)
                 {
-                    rl_Image imEmissive = LoadImageFromCgltfImage(data->materials[i].emissive_texture.texture->image, texPath);
-                    if (imEmissive.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_EMISSION].texture = rl_LoadTextureFromImage(imEmissive);
-                        rl_UnloadImage(imEmissive);
-                    }
+                    rl_Image imEmissive = GetImageGLTF(images, data, data->materials[i].emissive_texture.texture->image);
+                    if (imEmissive.data != NULL) model.materials[j].maps[MATERIAL_MAP_EMISSION].texture = rl_LoadTextureFromImage(imEmissive);
 
                     // Load emissive color factor
                     model.materials[j].maps[MATERIAL_MAP_EMISSION].color.r = (unsigned char)(data->materials[i].emissive_factor[0]*255);
@@ -5064,6 +5850,12 @@ static rl_Model LoadGLTF(const char *fileName)
             // has_clearcoat, has_transmission, has_volume, has_ior, has specular, has_sheen
         }
 
+        // Unload images, waiting for images not used by materials
+        for (unsigned int i = 0; i < data->images_count; i++) rl_UnloadImage(GetImageGLTF(images, data, &data->images[i]));
+
+        RL_FREE(images);
+        RL_FREE(texPath);
+
         // Load meshes data
         //----------------------------------------------------------------------------------------------------
         for (unsigned int i = 0, meshIndex = 0; i < data->meshes_count; i++)
@@ -5529,7 +6321,7 @@ static rl_Model LoadGLTF(const char *fileName)
     else TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
 
     // WARNING: cgltf requires the file pointer available while reading data
-    rl_UnloadFileData(fileData);
+    rl_UnloadFileDataMapped(fileData, dataSize);
 
     return model;
 }
@@ -5668,11 +6460,85 @@ static bool GetPoseAtTimeGLTF(cgltf_interpolation_type interpolationType, cgltf_
 
 #define GLTF_ANIMDELAY 17    // Animation frames delay, (~1000 ms/60 FPS = 16.666666* ms)
 
+// Load glTF animation channel keyframes into bone track arrays, returns keyframes count
+// NOTE: Linear channels keyframes are loaded as provided, step and cubic spline channels
+// are resampled at GLTF_ANIMDELAY intervals; redundant keyframes are reduced afterwards
+static int LoadBoneTrackChannelGLTF(cgltf_animation_channel *channel, int components, float **times, float **values)
+{
+    cgltf_accessor *input = channel->sampler->input;
+    cgltf_accessor *output = channel->sampler->output;
+    cgltf_interpolation_type interpolationType = channel->sampler->interpolation;
+    bool success = true;
+    int count = 0;
+
+    if (input->count == 0) return 0;
+
+    if (interpolationType == cgltf_interpolation_type_linear)
+    {
+        count = (int)input->count;
+        *times = RL_MALLOC(count*sizeof(float));
+        *values = RL_MALLOC(count*components*sizeof(float));
+
+        for (int k = 0; (k < count) && success; k++)
+        {
+            success = cgltf_accessor_read_float(input, k, &(*times)[k], 1) &&
+                      cgltf_accessor_read_float(output, k, &(*values)[k*components], components);
+        }
+    }
+    else
+    {
+        float start = 0.0f;
+        float end = 0.0f;
+        cgltf_accessor_read_float(input, 0, &start, 1);
+        cgltf_accessor_read_float(input, input->count - 1, &end, 1);
+
+        count = (int)((end - start)*1000.0f/GLTF_ANIMDELAY) + 2;
+        *times = RL_MALLOC(count*sizeof(float));
+        *values = RL_MALLOC(count*components*sizeof(float));
+
+        for (int k = 0; (k < (count - 1)) && success; k++)
+        {
+            (*times)[k] = start + ((float)k*GLTF_ANIMDELAY)/1000.0f;
+            if ((*times)[k] > end) (*times)[k] = end;
+
+            success = GetPoseAtTimeGLTF(interpolationType, input, output, (*times)[k], &(*values)[k*components]);
+        }
+
+        // Last keyframe value is read directly, cubic spline outputs store (in-tangent, value, out-tangent)
+        int last = (interpolationType == cgltf_interpolation_type_cubic_spline)? 3*((int)input->count - 1) + 1 : (int)input->count - 1;
+        (*times)[count - 1] = end;
+        if (success) success = cgltf_accessor_read_float(output, last, &(*values)[(count - 1)*components], components);
+    }
+
+    if (!success)
+    {
+        RL_FREE(*times);
+        RL_FREE(*values);
+        *times = NULL;
+        *values = NULL;
+
+        return 0;
+    }
+
+    // Keep quaternions in the same hemisphere for interpolation and keyframes reduction
+    if (components == 4)
+    {
+        Quaternion *rotations = (Quaternion *)*values;
+
+        for (int k = 1; k < count; k++)
+        {
+            if (Vector4DotProduct(rotations[k - 1], rotations[k]) < 0.0f) rotations[k] = QuaternionScale(rotations[k], -1.0f);
+        }
+    }
+
+    return CompactKeyframes(times, values, count, components);
+}
+
 static rl_ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *animCount)
 {
     // glTF file loading
     int dataSize = 0;
-    unsigned char *fileData = rl_LoadFileData(fileName, &dataSize);
+    unsigned char *fileData = rl_LoadFileDataMapped(fileName, &dataSize);
 
     rl_ModelAnimation *animations = NULL;
 
@@ -5687,6 +6553,7 @@ static rl_ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *ani
     {
         TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
         *animCount = 0;
+        rl_UnloadFileDataMapped(fileData, dataSize);
         return NULL;
     }
 
@@ -5778,52 +6645,33 @@ static rl_ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *ani
                     animations[i].name[sizeof(animations[i].name) - 1] = '\0';
                 }
 
+                // NOTE: Frames count is kept for frame-indexed animation update, poses are sampled from tracks
                 animations[i].frameCount = (int)(animDuration*1000.0f/GLTF_ANIMDELAY) + 1;
-                animations[i].framePoses = RL_MALLOC(animations[i].frameCount*sizeof(rl_Transform *));
+                animations[i].framePoses = NULL;
+                animations[i].duration = animDuration;
+                animations[i].tracks = RL_CALLOC(animations[i].boneCount, sizeof(rl_BoneTrack));
 
-                for (int j = 0; j < animations[i].frameCount; j++)
+                for (int k = 0; k < animations[i].boneCount; k++)
                 {
-                    animations[i].framePoses[j] = RL_MALLOC(animations[i].boneCount*sizeof(rl_Transform));
-                    float time = ((float) j*GLTF_ANIMDELAY)/1000.0f;
+                    rl_BoneTrack *track = &animations[i].tracks[k];
 
-                    for (int k = 0; k < animations[i].boneCount; k++)
+                    if (boneChannels[k].translate)
                     {
-                        rl_Vector3 translation = {0, 0, 0};
-                        Quaternion rotation = {0, 0, 0, 1};
-                        rl_Vector3 scale = {1, 1, 1};
-
-                        if (boneChannels[k].translate)
-                        {
-                            if (!GetPoseAtTimeGLTF(boneChannels[k].interpolationType, boneChannels[k].translate->sampler->input, boneChannels[k].translate->sampler->output, time, &translation))
-                            {
-                                TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load translate pose data for bone %s", fileName, animations[i].bones[k].name);
-                            }
-                        }
-
-                        if (boneChannels[k].rotate)
-                        {
-                            if (!GetPoseAtTimeGLTF(boneChannels[k].interpolationType, boneChannels[k].rotate->sampler->input, boneChannels[k].rotate->sampler->output, time, &rotation))
-                            {
-                                TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load rotate pose data for bone %s", fileName, animations[i].bones[k].name);
-                            }
-                        }
-
-                        if (boneChannels[k].scale)
-                        {
-                            if (!GetPoseAtTimeGLTF(boneChannels[k].interpolationType, boneChannels[k].scale->sampler->input, boneChannels[k].scale->sampler->output, time, &scale))
-                            {
-                                TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load scale pose data for bone %s", fileName, animations[i].bones[k].name);
-                            }
-                        }
+                        track->translationCount = LoadBoneTrackChannelGLTF(boneChannels[k].translate, 3, &track->translationTimes, (float **)&track->translations);
+                        if (track->translationCount == 0) TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load translate pose data for bone %s", fileName, animations[i].bones[k].name);
+                    }
 
-                        animations[i].framePoses[j][k] = (rl_Transform){
-                            .translation = translation,
-                            .rotation = rotation,
-                            .scale = scale
-                        };
+                    if (boneChannels[k].rotate)
+                    {
+                        track->rotationCount = LoadBoneTrackChannelGLTF(boneChannels[k].rotate, 4, &track->rotationTimes, (float **)&track->rotations);
+                        if (track->rotationCount == 0) TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load rotate pose data for bone %s", fileName, animations[i].bones[k].name);
                     }
 
-                    BuildPoseFromParentJoints(animations[i].bones, animations[i].boneCount, animations[i].framePoses[j]);
+                    if (boneChannels[k].scale)
+                    {
+                        track->scaleCount = LoadBoneTrackChannelGLTF(boneChannels[k].scale, 3, &track->scaleTimes, (float **)&track->scales);
+                        if (track->scaleCount == 0) TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load scale pose data for bone %s", fileName, animations[i].bones[k].name);
+                    }
                 }
 
                 TRACELOG(LOG_INFO, "MODEL: [%s] Loaded animation: %s (%d frames, %fs)", fileName, (animData.name != NULL)? animData.name : "NULL", animations[i].frameCount, animDuration);
@@ -5834,7 +6682,7 @@ static rl_ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *ani
 
         cgltf_free(data);
     }
-    rl_UnloadFileData(fileData);
+    rl_UnloadFileDataMapped(fileData, dataSize);
     return animations;
 }
 #endif
@@ -6355,7 +7203,7 @@ static rl_ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *anim
             // regular intervals, so let the M3D SDK do the heavy lifting and calculate interpolated bones
             for (i = 0; i < animations[a].frameCount; i++)
             {
-                animations[a].framePoses[i] = RL_MALLOC((m3d->numbone + 1)*sizeof(rl_Transform));
+                animations[a].framePoses[i] = RL_CALLOC((m3d->numbone + 1), sizeof(rl_Transform));
 
                 m3db_t *pose = m3d_pose(m3d, a, i*M3D_ANIMDELAY);
 
@@ -6373,14 +7221,8 @@ static rl_ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *anim
                         animations[a].framePoses[i][j].rotation = QuaternionNormalize(animations[a].framePoses[i][j].rotation);
                         animations[a].framePoses[i][j].scale.x = animations[a].framePoses[i][j].scale.y = animations[a].framePoses[i][j].scale.z = 1.0f;
 
-                        // Child bones are stored in parent bone relative space, convert that into model space
-                        if (animations[a].bones[j].parent >= 0)
-                        {
-                            animations[a].framePoses[i][j].rotation = QuaternionMultiply(animations[a].framePoses[i][animations[a].bones[j].parent].rotation, animations[a].framePoses[i][j].rotation);
-                            animations[a].framePoses[i][j].translation = Vector3RotateByQuaternion(animations[a].framePoses[i][j].translation, animations[a].framePoses[i][animations[a].bones[j].parent].rotation);
-                            animations[a].framePoses[i][j].translation = Vector3Add(animations[a].framePoses[i][j].translation, animations[a].framePoses[i][animations[a].bones[j].parent].translation);
-                            animations[a].framePoses[i][j].scale = Vector3Multiply(animations[a].framePoses[i][j].scale, animations[a].framePoses[i][animations[a].bones[j].parent].scale);
-                        }
+                        // NOTE: Child bones are stored in parent bone relative space, converted into
+                        // model space when the animation is sampled
                     }
 
                     // Default transform for the "no bone" bone
@@ -6395,6 +7237,14 @@ static rl_ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *anim
                     RL_FREE(pose);
                 }
             }
+
+            // Convert local frame poses into keyframe tracks, baked frames are not kept
+            animations[a].tracks = LoadBoneTracksFromPoses(animations[a].framePoses, animations[a].frameCount, animations[a].boneCount, M3D_ANIMDELAY/1000.0f);
+            animations[a].duration = (animations[a].frameCount > 1)? (float)(animations[a].frameCount - 1)*M3D_ANIMDELAY/1000.0f : 0.0f;
+
+            for (i = 0; i < animations[a].frameCount; i++) RL_FREE(animations[a].framePoses[i]);
+            RL_FREE(animations[a].framePoses);
+            animations[a].framePoses = NULL;
         }
 
         m3d_free(m3d);
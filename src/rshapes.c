@@ -22,6 +22,27 @@
 *       #define SUPPORT_QUADS_DRAW_MODE
 *           Use QUADS instead of TRIANGLES for drawing when possible. Lines-based shapes still use LINES
 *
+*   SDF SHAPES MODE:
+*       Between rl_BeginShapesSDFMode() and rl_EndShapesSDFMode() circles, rings, rounded rectangles
+*       and thick lines are drawn as one quad each, the shape is evaluated per pixel by a built-in
+*       signed distance field shader with analytic anti-aliasing. Shape parameters are provided as raw
+*       vertex normals, so all shapes (and any other 2d drawing) still go through the render batch
+*       NOTE: Not available on OpenGL 1.1, shapes are tessellated as usual
+*
+*   LINE STRIPS:
+*       rl_DrawLineStripEx() strips with LINES_GPU_MIN_POINTS or more points are uploaded as provided
+*       and expanded on GPU by a built-in instancing shader: segments, joins and caps are generated
+*       per instance in the vertex shader and anti-aliased in the fragment shader (one pixel fringe).
+*       Shorter strips, or when instancing is not available or a custom shader is active, are
+*       triangulated on CPU (no anti-aliasing) through the render batch. Thick splines are
+*       flattened to points and drawn as line strips
+*
+*   SPLINES FLATTENING:
+*       Spline segments are subdivided as required for the curve to stay within SPLINE_FLATTEN_TOLERANCE
+*       pixels of the drawn polyline (Wang's formula on the segment Bezier control points), considering
+*       the current transformation scale. rl_Spline keeps the flattened points, they are only computed
+*       again when control points change (rl_UpdateSpline()) or scale changes over 2x
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -53,11 +74,14 @@
 
 #if defined(SUPPORT_MODULE_RSHAPES)
 
+#include "utils.h"      // Required for: TRACELOG()
 #include "rlgl.h"       // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
+#include "raymath.h"    // Required for: MatrixMultiply()
 
-#include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), sqrtf(), fabsf()
+#include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), sqrtf(), fabsf(), floorf(), fmodf(), sin(), cos()
 #include <float.h>      // Required for: FLT_EPSILON
-#include <stdlib.h>     // Required for: RL_FREE
+#include <stdlib.h>     // Required for: RL_MALLOC, RL_REALLOC, RL_FREE
+#include <string.h>     // Required for: memcmp(), memcpy()
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -68,13 +92,57 @@
     #define SMOOTH_CIRCLE_ERROR_RATE    0.5f      // Circle error rate
 #endif
 #ifndef SPLINE_SEGMENT_DIVISIONS
-    #define SPLINE_SEGMENT_DIVISIONS      24      // Spline segment divisions
+    #define SPLINE_SEGMENT_DIVISIONS      24      // Spline segment divisions (fixed, used with no flattening tolerance)
+#endif
+#ifndef SPLINE_FLATTEN_TOLERANCE
+    #define SPLINE_FLATTEN_TOLERANCE    0.25f     // Spline flattening tolerance in pixels
+#endif
+#ifndef SPLINE_SEGMENT_MAX_DIVISIONS
+    #define SPLINE_SEGMENT_MAX_DIVISIONS 256      // Spline segment maximum adaptive divisions
+#endif
+#ifndef SHAPES_TRIG_CACHE_SIZE
+    #define SHAPES_TRIG_CACHE_SIZE        16      // Unit circle tables cached (by segment count)
+#endif
+#ifndef SHAPES_SDF_MARGIN
+    #define SHAPES_SDF_MARGIN             1.0f    // SDF shapes quad margin for anti-aliasing (in pixels)
+#endif
+#ifndef SHAPES_TRIG_TABLE_MAX_SEGMENTS
+    #define SHAPES_TRIG_TABLE_MAX_SEGMENTS  4096  // Maximum segments for a cached unit circle table
 #endif
+#ifndef LINES_GPU_MIN_POINTS
+    #define LINES_GPU_MIN_POINTS         128      // Minimum line strip points to be expanded on GPU (shorter strips are batched)
+#endif
+#ifndef LINES_MITER_LIMIT
+    #define LINES_MITER_LIMIT            4.0f     // Line miter joins limit (miter length/thickness), bevel join used over it
+#endif
+#ifndef LINES_MAX_FAN_SEGMENTS
+    #define LINES_MAX_FAN_SEGMENTS        32      // Maximum segments for line round joins and caps
+#endif
+
+#define LINE_FAN_SQUARE                    3      // Line fan type for square caps, after LineJoin types
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// Not here...
+// Unit circle table, (cos, sin) for every segment step
+typedef struct TrigTable {
+    int segments;               // Number of segments of the full circle
+    rl_Vector2 *points;         // Unit circle points, two turns: (segments*2 + 1) points
+} TrigTable;
+
+// Line strips GPU expansion data
+typedef struct LinesRenderer {
+    unsigned int shaderId;      // Lines shader program id
+    int locTemplate;            // Template vertex attribute location: segment (t, side) or fan (step, center)
+    int locPoints[3];           // Points attribute locations (per instance): pointA, pointB, pointC
+    int locMvp;                 // Model-view-projection matrix uniform location
+    int locParams;              // Line parameters uniform location: half thickness, anti-aliasing width, fan segments, miter limit
+    int locMode;                // Draw mode uniform location: (0: segments, 1: joins, 2: caps), fan type
+    int locColor;               // Line color uniform location
+    unsigned int vaoId;         // Vertex array id (0 if not supported)
+    unsigned int vboId[2];      // Vertex buffers: template vertices and points
+    int pointsCapacity;         // Points buffer capacity
+} LinesRenderer;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -82,11 +150,51 @@
 rl_Texture2D texShapes = { 1, 1, 1, 1, 7 };                // rl_Texture used on shapes drawing (white pixel loaded by rlgl)
 rl_Rectangle texShapesRec = { 0.0f, 0.0f, 1.0f, 1.0f };    // rl_Texture source rectangle used on shapes drawing
 
+static TrigTable trigTables[SHAPES_TRIG_CACHE_SIZE] = { 0 };  // Unit circle tables cache, shared by all circular shapes
+static int trigTablesNext = 0;              // Next cache slot to be replaced (round-robin)
+static rl_Vector2 *arcPoints = NULL;        // Unit arc points generated for arcs not aligned to a table
+static int arcPointsCapacity = 0;           // Unit arc points capacity
+
+static float circleSegmentsRadius = 0.0f;   // Last radius used to compute smooth circle segments
+static int circleSegments = 0;              // Last smooth circle segments computed
+
+static rl_Shader shaderShapesSDF = { 0 };   // SDF shapes shader, loaded on first rl_BeginShapesSDFMode()
+static bool shapesSDFMode = false;          // SDF shapes mode active
+static rl_Shader shaderSDFPrevious = { 0 }; // Shader active before SDF shapes mode, restored at mode end
+
+static LinesRenderer linesRenderer = { 0 }; // Line strips GPU expansion, loaded on first long line strip
+static rl_Vector2 *splinePoints = NULL;     // Splines flattened points, drawn as line strips
+static int splinePointsCapacity = 0;        // Splines flattened points capacity
+static float splineTolerance = SPLINE_FLATTEN_TOLERANCE;   // Splines flattening tolerance in pixels
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static float EaseCubicInOut(float t, float b, float c, float d);    // Cubic easing
 
+static const rl_Vector2 *GetCircleTable(int segments);             // Get unit circle table for a number of segments (cached)
+static const rl_Vector2 *GetUnitArc(float startAngle, float endAngle, int segments); // Get unit arc points, (segments + 1) points
+static int GetCircleSegments(float radius);                        // Get smooth full circle segments for a radius
+static int GetArcSegments(float radius, float startAngle, float endAngle, int segments); // Get smooth arc segments, if provided ones are not enough
+
+static void LoadShaderShapesSDF(void);                             // Load SDF shapes shader
+static void DrawShapeQuadSDF(rl_Vector2 center, rl_Vector2 axis, rl_Vector2 size, rl_Vector3 shape, rl_Color color); // Draw SDF shape quad
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void LoadLinesRenderer(void);                               // Load line strips GPU expansion shader and template
+#endif
+static bool DrawLineStripInstanced(const rl_Vector2 *points, int pointCount, float thick, int join, int cap, rl_Color color); // Draw line strip expanded on GPU
+static void DrawLineStripTriangles(const rl_Vector2 *points, int pointCount, float thick, int join, int cap, rl_Color color); // Draw line strip triangulated on CPU
+static void DrawLineFan(rl_Vector2 center, rl_Vector2 a, rl_Vector2 b, rl_Vector2 d, float sweep, int type, int segments, float radius); // Draw line join or cap fan
+static rl_Vector2 GetLineDirection(rl_Vector2 start, rl_Vector2 end);   // Get line unit direction, (1, 0) for zero length
+static rl_Vector2 GetLineFanOffset(rl_Vector2 a, rl_Vector2 b, rl_Vector2 d, float sweep, int type, float u); // Get line fan unit offset
+static int GetLineFanSegments(int type, float radius);             // Get line fan segments for a join or cap type
+static rl_Vector2 *GetSplinePoints(int count);                     // Get splines flattened points buffer
+static float GetPixelScale(rl_Matrix matMVP);                      // Get pixels per unit for a model-view-projection matrix
+static float GetSplineTolerance(void);                             // Get splines flattening tolerance in spline units
+static int FlattenSpline(int type, const rl_Vector2 *points, int pointCount, float tolerance, rl_Vector2 *output); // Flatten spline segments into points
+static void DrawSplineFlattened(int type, const rl_Vector2 *points, int pointCount, float thick, int cap, rl_Color color); // Draw spline flattened into a line strip
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -123,6 +231,37 @@ rl_Rectangle GetShapesTextureRectangle(void)
     return texShapesRec;
 }
 
+// Begin SDF shapes mode: circles, rings, rounded rectangles and thick lines are drawn as one anti-aliased quad
+// NOTE: SDF shader is a superset of the default shader, any other 2d drawing can be batched together
+void rl_BeginShapesSDFMode(void)
+{
+    if (rlGetVersion() == RL_OPENGL_11)
+    {
+        TRACELOG(LOG_WARNING, "SHAPES: SDF shapes mode not supported on OpenGL 1.1");
+        return;
+    }
+
+    if (shaderShapesSDF.id == 0) LoadShaderShapesSDF();
+
+    if ((shaderShapesSDF.id != rlGetShaderIdDefault()) && !shapesSDFMode)
+    {
+        shaderSDFPrevious = (rl_Shader){ rlGetShaderIdCurrent(), rlGetShaderLocsCurrent() };
+        rl_BeginShaderMode(shaderShapesSDF);
+        shapesSDFMode = true;
+    }
+}
+
+// End SDF shapes mode (returns to shader active before mode)
+void rl_EndShapesSDFMode(void)
+{
+    if (shapesSDFMode)
+    {
+        rl_BeginShaderMode(shaderSDFPrevious);
+        shaderSDFPrevious = (rl_Shader){ 0 };
+        shapesSDFMode = false;
+    }
+}
+
 // Draw a pixel
 void rl_DrawPixel(int posX, int posY, rl_Color color)
 {
@@ -211,6 +350,20 @@ void rl_DrawLineStrip(const rl_Vector2 *points, int pointCount, rl_Color color)
     rlEnd();
 }
 
+// Draw lines sequence with thickness, joins and caps
+// NOTE: Long strips are expanded on GPU (anti-aliased) from points as provided,
+// shorter strips are triangulated on CPU and batched with other shapes
+void rl_DrawLineStripEx(const rl_Vector2 *points, int pointCount, float thick, int join, int cap, rl_Color color)
+{
+    if ((pointCount < 2) || (thick <= 0.0f)) return; // Security check
+
+    bool drawn = false;
+
+    if (pointCount >= LINES_GPU_MIN_POINTS) drawn = DrawLineStripInstanced(points, pointCount, thick, join, cap, color);
+
+    if (!drawn) DrawLineStripTriangles(points, pointCount, thick, join, cap, color);
+}
+
 // Draw line using cubic-bezier spline, in-out interpolation, no control points
 void rl_DrawLineBezier(rl_Vector2 startPos, rl_Vector2 endPos, float thick, rl_Color color)
 {
@@ -255,7 +408,14 @@ void rl_DrawLineEx(rl_Vector2 startPos, rl_Vector2 endPos, float thick, rl_Color
     rl_Vector2 delta = { endPos.x - startPos.x, endPos.y - startPos.y };
     float length = sqrtf(delta.x*delta.x + delta.y*delta.y);
 
-    if ((length > 0) && (thick > 0))
+    if (shapesSDFMode && (length > 0) && (thick > 0))
+    {
+        rl_Vector2 center = { (startPos.x + endPos.x)/2.0f, (startPos.y + endPos.y)/2.0f };
+        rl_Vector2 axis = { delta.x/length, delta.y/length };
+
+        DrawShapeQuadSDF(center, axis, (rl_Vector2){ length/2.0f, thick/2.0f }, (rl_Vector3){ length/2.0f, thick/2.0f, 0.0f }, color);
+    }
+    else if ((length > 0) && (thick > 0))
     {
         float scale = thick/(2*length);
 
@@ -298,19 +458,17 @@ void rl_DrawCircleSector(rl_Vector2 center, float radius, float startAngle, floa
         endAngle = tmp;
     }
 
-    int minSegments = (int)ceilf((endAngle - startAngle)/90);
-
-    if (segments < minSegments)
+    if (shapesSDFMode && ((endAngle - startAngle) >= 360.0f))
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
-
-        if (segments <= 0) segments = minSegments;
+        DrawShapeQuadSDF(center, (rl_Vector2){ 1.0f, 0.0f }, (rl_Vector2){ radius, radius }, (rl_Vector3){ 0.0f, 0.0f, radius }, color);
+        return;
     }
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    segments = GetArcSegments(radius, startAngle, endAngle, segments);
+
+    // NOTE: Unit arc points are scaled by radius and offset by center
+    const rl_Vector2 *arc = GetUnitArc(startAngle, endAngle, segments);
+    if (arc == NULL) return;
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(GetShapesTexture().id);
@@ -321,36 +479,38 @@ void rl_DrawCircleSector(rl_Vector2 center, float radius, float startAngle, floa
         // NOTE: Every QUAD actually represents two segments
         for (int i = 0; i < segments/2; i++)
         {
+            const rl_Vector2 *p = arc + i*2;
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength*2.0f))*radius, center.y + sinf(DEG2RAD*(angle + stepLength*2.0f))*radius);
+            rlVertex2f(center.x + p[2].x*radius, center.y + p[2].y*radius);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + p[1].x*radius, center.y + p[1].y*radius);
 
             rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-
-            angle += (stepLength*2.0f);
+            rlVertex2f(center.x + p[0].x*radius, center.y + p[0].y*radius);
         }
 
         // NOTE: In case number of segments is odd, we add one last piece to the cake
         if (((unsigned int)segments%2) == 1)
         {
+            const rl_Vector2 *p = arc + segments - 1;
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + p[1].x*radius, center.y + p[1].y*radius);
 
             rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + p[0].x*radius, center.y + p[0].y*radius);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
             rlVertex2f(center.x, center.y);
@@ -366,10 +526,8 @@ void rl_DrawCircleSector(rl_Vector2 center, float radius, float startAngle, floa
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-
-            angle += stepLength;
+            rlVertex2f(center.x + arc[i + 1].x*radius, center.y + arc[i + 1].y*radius);
+            rlVertex2f(center.x + arc[i].x*radius, center.y + arc[i].y*radius);
         }
     rlEnd();
 #endif
@@ -389,19 +547,10 @@ void rl_DrawCircleSectorLines(rl_Vector2 center, float radius, float startAngle,
         endAngle = tmp;
     }
 
-    int minSegments = (int)ceilf((endAngle - startAngle)/90);
-
-    if (segments < minSegments)
-    {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+    segments = GetArcSegments(radius, startAngle, endAngle, segments);
 
-        if (segments <= 0) segments = minSegments;
-    }
-
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    const rl_Vector2 *arc = GetUnitArc(startAngle, endAngle, segments);
+    if (arc == NULL) return;
     bool showCapLines = true;
 
     rlBegin(RL_LINES);
@@ -409,24 +558,22 @@ void rl_DrawCircleSectorLines(rl_Vector2 center, float radius, float startAngle,
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + arc[0].x*radius, center.y + arc[0].y*radius);
         }
 
         for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
-
-            angle += stepLength;
+            rlVertex2f(center.x + arc[i].x*radius, center.y + arc[i].y*radius);
+            rlVertex2f(center.x + arc[i + 1].x*radius, center.y + arc[i + 1].y*radius);
         }
 
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + arc[segments].x*radius, center.y + arc[segments].y*radius);
         }
     rlEnd();
 }
@@ -435,15 +582,18 @@ void rl_DrawCircleSectorLines(rl_Vector2 center, float radius, float startAngle,
 // NOTE: Gradient goes from center (color1) to border (color2)
 void rl_DrawCircleGradient(int centerX, int centerY, float radius, rl_Color color1, rl_Color color2)
 {
+    const rl_Vector2 *arc = GetCircleTable(36);
+    if (arc == NULL) return;
+
     rlBegin(RL_TRIANGLES);
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < 36; i++)
         {
             rlColor4ub(color1.r, color1.g, color1.b, color1.a);
             rlVertex2f((float)centerX, (float)centerY);
             rlColor4ub(color2.r, color2.g, color2.b, color2.a);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*(i + 10))*radius, (float)centerY + sinf(DEG2RAD*(i + 10))*radius);
+            rlVertex2f((float)centerX + arc[i + 1].x*radius, (float)centerY + arc[i + 1].y*radius);
             rlColor4ub(color2.r, color2.g, color2.b, color2.a);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*i)*radius, (float)centerY + sinf(DEG2RAD*i)*radius);
+            rlVertex2f((float)centerX + arc[i].x*radius, (float)centerY + arc[i].y*radius);
         }
     rlEnd();
 }
@@ -457,14 +607,24 @@ void rl_DrawCircleLines(int centerX, int centerY, float radius, rl_Color color)
 // Draw circle outline (Vector version)
 void rl_DrawCircleLinesV(rl_Vector2 center, float radius, rl_Color color)
 {
+    if (shapesSDFMode)
+    {
+        // NOTE: Outline drawn as a 1 unit wide ring
+        DrawShapeQuadSDF(center, (rl_Vector2){ 1.0f, 0.0f }, (rl_Vector2){ radius + 0.5f, radius + 0.5f }, (rl_Vector3){ radius - 0.5f, -1.0f, radius + 0.5f }, color);
+        return;
+    }
+
+    const rl_Vector2 *arc = GetCircleTable(36);
+    if (arc == NULL) return;
+
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
 
-        // NOTE: Circle outline is drawn pixel by pixel every degree (0 to 360)
-        for (int i = 0; i < 360; i += 10)
+        // NOTE: Circle outline is drawn every 10 degrees (0 to 360)
+        for (int i = 0; i < 36; i++)
         {
-            rlVertex2f(center.x + cosf(DEG2RAD*i)*radius, center.y + sinf(DEG2RAD*i)*radius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(i + 10))*radius, center.y + sinf(DEG2RAD*(i + 10))*radius);
+            rlVertex2f(center.x + arc[i].x*radius, center.y + arc[i].y*radius);
+            rlVertex2f(center.x + arc[i + 1].x*radius, center.y + arc[i + 1].y*radius);
         }
     rlEnd();
 }
@@ -472,13 +632,16 @@ void rl_DrawCircleLinesV(rl_Vector2 center, float radius, rl_Color color)
 // Draw ellipse
 void rl_DrawEllipse(int centerX, int centerY, float radiusH, float radiusV, rl_Color color)
 {
+    const rl_Vector2 *arc = GetCircleTable(36);
+    if (arc == NULL) return;
+
     rlBegin(RL_TRIANGLES);
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < 36; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f((float)centerX, (float)centerY);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*(i + 10))*radiusH, (float)centerY + sinf(DEG2RAD*(i + 10))*radiusV);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*i)*radiusH, (float)centerY + sinf(DEG2RAD*i)*radiusV);
+            rlVertex2f((float)centerX + arc[i + 1].x*radiusH, (float)centerY + arc[i + 1].y*radiusV);
+            rlVertex2f((float)centerX + arc[i].x*radiusH, (float)centerY + arc[i].y*radiusV);
         }
     rlEnd();
 }
@@ -486,12 +649,15 @@ void rl_DrawEllipse(int centerX, int centerY, float radiusH, float radiusV, rl_C
 // Draw ellipse outline
 void rl_DrawEllipseLines(int centerX, int centerY, float radiusH, float radiusV, rl_Color color)
 {
+    const rl_Vector2 *arc = GetCircleTable(36);
+    if (arc == NULL) return;
+
     rlBegin(RL_LINES);
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < 36; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(centerX + cosf(DEG2RAD*(i + 10))*radiusH, centerY + sinf(DEG2RAD*(i + 10))*radiusV);
-            rlVertex2f(centerX + cosf(DEG2RAD*i)*radiusH, centerY + sinf(DEG2RAD*i)*radiusV);
+            rlVertex2f(centerX + arc[i + 1].x*radiusH, centerY + arc[i + 1].y*radiusV);
+            rlVertex2f(centerX + arc[i].x*radiusH, centerY + arc[i].y*radiusV);
         }
     rlEnd();
 }
@@ -520,16 +686,7 @@ void rl_DrawRing(rl_Vector2 center, float innerRadius, float outerRadius, float
         endAngle = tmp;
     }
 
-    int minSegments = (int)ceilf((endAngle - startAngle)/90);
-
-    if (segments < minSegments)
-    {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
-
-        if (segments <= 0) segments = minSegments;
-    }
+    segments = GetArcSegments(outerRadius, startAngle, endAngle, segments);
 
     // Not a ring
     if (innerRadius <= 0.0f)
@@ -538,8 +695,14 @@ void rl_DrawRing(rl_Vector2 center, float innerRadius, float outerRadius, float
         return;
     }
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    if (shapesSDFMode && ((endAngle - startAngle) >= 360.0f))
+    {
+        DrawShapeQuadSDF(center, (rl_Vector2){ 1.0f, 0.0f }, (rl_Vector2){ outerRadius, outerRadius }, (rl_Vector3){ innerRadius, -1.0f, outerRadius }, color);
+        return;
+    }
+
+    const rl_Vector2 *arc = GetUnitArc(startAngle, endAngle, segments);
+    if (arc == NULL) return;
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(GetShapesTexture().id);
@@ -551,18 +714,16 @@ void rl_DrawRing(rl_Vector2 center, float innerRadius, float outerRadius, float
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+            rlVertex2f(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius);
 
             rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + arc[i].x*innerRadius, center.y + arc[i].y*innerRadius);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
+            rlVertex2f(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-
-            angle += stepLength;
+            rlVertex2f(center.x + arc[i + 1].x*outerRadius, center.y + arc[i + 1].y*outerRadius);
         }
     rlEnd();
 
@@ -573,15 +734,13 @@ void rl_DrawRing(rl_Vector2 center, float innerRadius, float outerRadius, float
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+            rlVertex2f(center.x + arc[i].x*innerRadius, center.y + arc[i].y*innerRadius);
+            rlVertex2f(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius);
+            rlVertex2f(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-
-            angle += stepLength;
+            rlVertex2f(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius);
+            rlVertex2f(center.x + arc[i + 1].x*outerRadius, center.y + arc[i + 1].y*outerRadius);
+            rlVertex2f(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius);
         }
     rlEnd();
 #endif
@@ -611,16 +770,7 @@ void rl_DrawRingLines(rl_Vector2 center, float innerRadius, float outerRadius, f
         endAngle = tmp;
     }
 
-    int minSegments = (int)ceilf((endAngle - startAngle)/90);
-
-    if (segments < minSegments)
-    {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
-
-        if (segments <= 0) segments = minSegments;
-    }
+    segments = GetArcSegments(outerRadius, startAngle, endAngle, segments);
 
     if (innerRadius <= 0.0f)
     {
@@ -628,36 +778,34 @@ void rl_DrawRingLines(rl_Vector2 center, float innerRadius, float outerRadius, f
         return;
     }
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    const rl_Vector2 *arc = GetUnitArc(startAngle, endAngle, segments);
+    if (arc == NULL) return;
     bool showCapLines = true;
 
     rlBegin(RL_LINES);
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + arc[0].x*outerRadius, center.y + arc[0].y*outerRadius);
+            rlVertex2f(center.x + arc[0].x*innerRadius, center.y + arc[0].y*innerRadius);
         }
 
         for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
+            rlVertex2f(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius);
+            rlVertex2f(center.x + arc[i + 1].x*outerRadius, center.y + arc[i + 1].y*outerRadius);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-
-            angle += stepLength;
+            rlVertex2f(center.x + arc[i].x*innerRadius, center.y + arc[i].y*innerRadius);
+            rlVertex2f(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius);
         }
 
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + arc[segments].x*outerRadius, center.y + arc[segments].y*outerRadius);
+            rlVertex2f(center.x + arc[segments].x*innerRadius, center.y + arc[segments].y*innerRadius);
         }
     rlEnd();
 }
@@ -876,17 +1024,22 @@ void rl_DrawRectangleRounded(rl_Rectangle rec, float roundness, int segments, rl
     float radius = (rec.width > rec.height)? (rec.height*roundness)/2 : (rec.width*roundness)/2;
     if (radius <= 0.0f) return;
 
+    if (shapesSDFMode)
+    {
+        rl_Vector2 size = { rec.width/2.0f, rec.height/2.0f };
+        rl_Vector2 center = { rec.x + size.x, rec.y + size.y };
+
+        DrawShapeQuadSDF(center, (rl_Vector2){ 1.0f, 0.0f }, size, (rl_Vector3){ size.x - radius, size.y - radius, radius }, color);
+        return;
+    }
+
     // Calculate number of segments to use for the corners
     if (segments < 4)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)(ceilf(2*PI/th)/4.0f);
+        segments = (int)(GetCircleSegments(radius)/4.0f);
         if (segments <= 0) segments = 4;
     }
 
-    float stepLength = 90.0f/(float)segments;
-
     /*
     Quick sketch to make sense of all of this,
     there are 9 parts to draw, also mark the 12 points we'll use
@@ -923,40 +1076,43 @@ void rl_DrawRectangleRounded(rl_Rectangle rec, float roundness, int segments, rl
         // Draw all the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
         for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
         {
-            float angle = angles[k];
+            const rl_Vector2 *arc = GetUnitArc(angles[k], angles[k] + 90.0f, segments);
+            if (arc == NULL) continue;
             const rl_Vector2 center = centers[k];
 
             // NOTE: Every QUAD actually represents two segments
             for (int i = 0; i < segments/2; i++)
             {
+                const rl_Vector2 *p = arc + i*2;
+
                 rlColor4ub(color.r, color.g, color.b, color.a);
                 rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
 
                 rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength*2))*radius, center.y + sinf(DEG2RAD*(angle + stepLength*2))*radius);
+                rlVertex2f(center.x + p[2].x*radius, center.y + p[2].y*radius);
 
                 rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+                rlVertex2f(center.x + p[1].x*radius, center.y + p[1].y*radius);
 
                 rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-
-                angle += (stepLength*2);
+                rlVertex2f(center.x + p[0].x*radius, center.y + p[0].y*radius);
             }
 
             // NOTE: In case number of segments is odd, we add one last piece to the cake
             if (segments%2)
             {
+                const rl_Vector2 *p = arc + segments - 1;
+
                 rlColor4ub(color.r, color.g, color.b, color.a);
                 rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
 
                 rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+                rlVertex2f(center.x + p[1].x*radius, center.y + p[1].y*radius);
 
                 rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+                rlVertex2f(center.x + p[0].x*radius, center.y + p[0].y*radius);
 
                 rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
@@ -1026,15 +1182,15 @@ void rl_DrawRectangleRounded(rl_Rectangle rec, float roundness, int segments, rl
         // Draw all of the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
         for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
         {
-            float angle = angles[k];
+            const rl_Vector2 *arc = GetUnitArc(angles[k], angles[k] + 90.0f, segments);
+            if (arc == NULL) continue;
             const rl_Vector2 center = centers[k];
             for (int i = 0; i < segments; i++)
             {
                 rlColor4ub(color.r, color.g, color.b, color.a);
                 rlVertex2f(center.x, center.y);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
-                rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-                angle += stepLength;
+                rlVertex2f(center.x + arc[i + 1].x*radius, center.y + arc[i + 1].y*radius);
+                rlVertex2f(center.x + arc[i].x*radius, center.y + arc[i].y*radius);
             }
         }
 
@@ -1114,13 +1270,9 @@ void DrawRectangleRoundedLinesEx(rl_Rectangle rec, float roundness, int segments
     // Calculate number of segments to use for the corners
     if (segments < 4)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)(ceilf(2*PI/th)/2.0f);
+        segments = (int)(GetCircleSegments(radius)/2.0f);
         if (segments <= 0) segments = 4;
     }
-
-    float stepLength = 90.0f/(float)segments;
     const float outerRadius = radius + lineThick, innerRadius = radius;
 
     /*
@@ -1167,25 +1319,24 @@ void DrawRectangleRoundedLinesEx(rl_Rectangle rec, float roundness, int segments
             // Draw all the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                const rl_Vector2 *arc = GetUnitArc(angles[k], angles[k] + 90.0f, segments);
+                if (arc == NULL) continue;
                 const rl_Vector2 center = centers[k];
                 for (int i = 0; i < segments; i++)
                 {
                     rlColor4ub(color.r, color.g, color.b, color.a);
 
                     rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+                    rlVertex2f(center.x + arc[i].x*innerRadius, center.y + arc[i].y*innerRadius);
 
                     rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
+                    rlVertex2f(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius);
 
                     rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
+                    rlVertex2f(center.x + arc[i + 1].x*outerRadius, center.y + arc[i + 1].y*outerRadius);
 
                     rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-
-                    angle += stepLength;
+                    rlVertex2f(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius);
                 }
             }
 
@@ -1241,22 +1392,21 @@ void DrawRectangleRoundedLinesEx(rl_Rectangle rec, float roundness, int segments
             // Draw all of the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                const rl_Vector2 *arc = GetUnitArc(angles[k], angles[k] + 90.0f, segments);
+                if (arc == NULL) continue;
                 const rl_Vector2 center = centers[k];
 
                 for (int i = 0; i < segments; i++)
                 {
                     rlColor4ub(color.r, color.g, color.b, color.a);
 
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+                    rlVertex2f(center.x + arc[i].x*innerRadius, center.y + arc[i].y*innerRadius);
+                    rlVertex2f(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius);
+                    rlVertex2f(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius);
 
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-
-                    angle += stepLength;
+                    rlVertex2f(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius);
+                    rlVertex2f(center.x + arc[i + 1].x*outerRadius, center.y + arc[i + 1].y*outerRadius);
+                    rlVertex2f(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius);
                 }
             }
 
@@ -1306,15 +1456,15 @@ void DrawRectangleRoundedLinesEx(rl_Rectangle rec, float roundness, int segments
             // Draw all the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                const rl_Vector2 *arc = GetUnitArc(angles[k], angles[k] + 90.0f, segments);
+                if (arc == NULL) continue;
                 const rl_Vector2 center = centers[k];
 
                 for (int i = 0; i < segments; i++)
                 {
                     rlColor4ub(color.r, color.g, color.b, color.a);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-                    angle += stepLength;
+                    rlVertex2f(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius);
+                    rlVertex2f(center.x + arc[i + 1].x*outerRadius, center.y + arc[i + 1].y*outerRadius);
                 }
             }
 
@@ -1446,8 +1596,8 @@ void rl_DrawTriangleStrip(const rl_Vector2 *points, int pointCount, rl_Color col
 void rl_DrawPoly(rl_Vector2 center, int sides, float radius, float rotation, rl_Color color)
 {
     if (sides < 3) sides = 3;
-    float centralAngle = rotation*DEG2RAD;
-    float angleStep = 360.0f/(float)sides*DEG2RAD;
+    const rl_Vector2 *arc = GetUnitArc(rotation, rotation + 360.0f, sides);
+    if (arc == NULL) return;
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(GetShapesTexture().id);
@@ -1457,21 +1607,18 @@ void rl_DrawPoly(rl_Vector2 center, int sides, float radius, float rotation, rl_
         for (int i = 0; i < sides; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            float nextAngle = centralAngle + angleStep;
 
             rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
+            rlVertex2f(center.x + arc[i].x*radius, center.y + arc[i].y*radius);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x + cosf(nextAngle)*radius, center.y + sinf(nextAngle)*radius);
+            rlVertex2f(center.x + arc[i + 1].x*radius, center.y + arc[i + 1].y*radius);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
-
-            centralAngle = nextAngle;
+            rlVertex2f(center.x + arc[i].x*radius, center.y + arc[i].y*radius);
         }
     rlEnd();
     rlSetTexture(0);
@@ -1482,10 +1629,8 @@ void rl_DrawPoly(rl_Vector2 center, int sides, float radius, float rotation, rl_
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(centralAngle + angleStep)*radius, center.y + sinf(centralAngle + angleStep)*radius);
-            rlVertex2f(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
-
-            centralAngle += angleStep;
+            rlVertex2f(center.x + arc[i + 1].x*radius, center.y + arc[i + 1].y*radius);
+            rlVertex2f(center.x + arc[i].x*radius, center.y + arc[i].y*radius);
         }
     rlEnd();
 #endif
@@ -1495,18 +1640,16 @@ void rl_DrawPoly(rl_Vector2 center, int sides, float radius, float rotation, rl_
 void rl_DrawPolyLines(rl_Vector2 center, int sides, float radius, float rotation, rl_Color color)
 {
     if (sides < 3) sides = 3;
-    float centralAngle = rotation*DEG2RAD;
-    float angleStep = 360.0f/(float)sides*DEG2RAD;
+    const rl_Vector2 *arc = GetUnitArc(rotation, rotation + 360.0f, sides);
+    if (arc == NULL) return;
 
     rlBegin(RL_LINES);
         for (int i = 0; i < sides; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
-            rlVertex2f(center.x + cosf(centralAngle + angleStep)*radius, center.y + sinf(centralAngle + angleStep)*radius);
-
-            centralAngle += angleStep;
+            rlVertex2f(center.x + arc[i].x*radius, center.y + arc[i].y*radius);
+            rlVertex2f(center.x + arc[i + 1].x*radius, center.y + arc[i + 1].y*radius);
         }
     rlEnd();
 }
@@ -1514,9 +1657,10 @@ void rl_DrawPolyLines(rl_Vector2 center, int sides, float radius, float rotation
 void rl_DrawPolyLinesEx(rl_Vector2 center, int sides, float radius, float rotation, float lineThick, rl_Color color)
 {
     if (sides < 3) sides = 3;
-    float centralAngle = rotation*DEG2RAD;
     float exteriorAngle = 360.0f/(float)sides*DEG2RAD;
     float innerRadius = radius - (lineThick*cosf(DEG2RAD*exteriorAngle/2.0f));
+    const rl_Vector2 *arc = GetUnitArc(rotation, rotation + 360.0f, sides);
+    if (arc == NULL) return;
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(GetShapesTexture().id);
@@ -1526,21 +1670,18 @@ void rl_DrawPolyLinesEx(rl_Vector2 center, int sides, float radius, float rotati
         for (int i = 0; i < sides; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            float nextAngle = centralAngle + exteriorAngle;
 
             rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
+            rlVertex2f(center.x + arc[i].x*radius, center.y + arc[i].y*radius);
 
             rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x + cosf(centralAngle)*innerRadius, center.y + sinf(centralAngle)*innerRadius);
+            rlVertex2f(center.x + arc[i].x*innerRadius, center.y + arc[i].y*innerRadius);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(nextAngle)*innerRadius, center.y + sinf(nextAngle)*innerRadius);
+            rlVertex2f(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x + cosf(nextAngle)*radius, center.y + sinf(nextAngle)*radius);
-
-            centralAngle = nextAngle;
+            rlVertex2f(center.x + arc[i + 1].x*radius, center.y + arc[i + 1].y*radius);
         }
     rlEnd();
     rlSetTexture(0);
@@ -1549,17 +1690,14 @@ void rl_DrawPolyLinesEx(rl_Vector2 center, int sides, float radius, float rotati
         for (int i = 0; i < sides; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            float nextAngle = centralAngle + exteriorAngle;
-
-            rlVertex2f(center.x + cosf(nextAngle)*radius, center.y + sinf(nextAngle)*radius);
-            rlVertex2f(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
-            rlVertex2f(center.x + cosf(centralAngle)*innerRadius, center.y + sinf(centralAngle)*innerRadius);
 
-            rlVertex2f(center.x + cosf(centralAngle)*innerRadius, center.y + sinf(centralAngle)*innerRadius);
-            rlVertex2f(center.x + cosf(nextAngle)*innerRadius, center.y + sinf(nextAngle)*innerRadius);
-            rlVertex2f(center.x + cosf(nextAngle)*radius, center.y + sinf(nextAngle)*radius);
+            rlVertex2f(center.x + arc[i + 1].x*radius, center.y + arc[i + 1].y*radius);
+            rlVertex2f(center.x + arc[i].x*radius, center.y + arc[i].y*radius);
+            rlVertex2f(center.x + arc[i].x*innerRadius, center.y + arc[i].y*innerRadius);
 
-            centralAngle = nextAngle;
+            rlVertex2f(center.x + arc[i].x*innerRadius, center.y + arc[i].y*innerRadius);
+            rlVertex2f(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius);
+            rlVertex2f(center.x + arc[i + 1].x*radius, center.y + arc[i + 1].y*radius);
         }
     rlEnd();
 #endif
@@ -1572,282 +1710,41 @@ void rl_DrawPolyLinesEx(rl_Vector2 center, int sides, float radius, float rotati
 // Draw spline: linear, minimum 2 points
 void rl_DrawSplineLinear(const rl_Vector2 *points, int pointCount, float thick, rl_Color color)
 {
-    if (pointCount < 2) return;
+    int join = LINE_JOIN_BEVEL;
+    int cap = LINE_CAP_BUTT;
 
 #if defined(SUPPORT_SPLINE_MITERS)
-    rl_Vector2 prevNormal = (rl_Vector2){-(points[1].y - points[0].y), (points[1].x - points[0].x)};
-    float prevLength = sqrtf(prevNormal.x*prevNormal.x + prevNormal.y*prevNormal.y);
-
-    if (prevLength > 0.0f)
-    {
-        prevNormal.x /= prevLength;
-        prevNormal.y /= prevLength;
-    }
-    else
-    {
-        prevNormal.x = 0.0f;
-        prevNormal.y = 0.0f;
-    }
-
-    rl_Vector2 prevRadius = { 0.5f*thick*prevNormal.x, 0.5f*thick*prevNormal.y };
-
-    for (int i = 0; i < pointCount - 1; i++)
-    {
-        rl_Vector2 normal = { 0 };
-
-        if (i < pointCount - 2)
-        {
-            normal = (rl_Vector2){-(points[i + 2].y - points[i + 1].y), (points[i + 2].x - points[i + 1].x)};
-            float normalLength = sqrtf(normal.x*normal.x + normal.y*normal.y);
-
-            if (normalLength > 0.0f)
-            {
-                normal.x /= normalLength;
-                normal.y /= normalLength;
-            }
-            else
-            {
-                normal.x = 0.0f;
-                normal.y = 0.0f;
-            }
-        }
-        else
-        {
-            normal = prevNormal;
-        }
-
-        rl_Vector2 radius = { prevNormal.x + normal.x, prevNormal.y + normal.y };
-        float radiusLength = sqrtf(radius.x*radius.x + radius.y*radius.y);
-
-        if (radiusLength > 0.0f)
-        {
-            radius.x /= radiusLength;
-            radius.y /= radiusLength;
-        }
-        else
-        {
-            radius.x = 0.0f;
-            radius.y = 0.0f;
-        }
-
-        float cosTheta = radius.x*normal.x + radius.y*normal.y;
-
-        if (cosTheta != 0.0f)
-        {
-            radius.x *= (thick*0.5f/cosTheta);
-            radius.y *= (thick*0.5f/cosTheta);
-        }
-        else
-        {
-            radius.x = 0.0f;
-            radius.y = 0.0f;
-        }
-
-        rl_Vector2 strip[4] = {
-            { points[i].x - prevRadius.x, points[i].y - prevRadius.y },
-            { points[i].x + prevRadius.x, points[i].y + prevRadius.y },
-            { points[i + 1].x - radius.x, points[i + 1].y - radius.y },
-            { points[i + 1].x + radius.x, points[i + 1].y + radius.y }
-        };
-
-        rl_DrawTriangleStrip(strip, 4, color);
-
-        prevRadius = radius;
-        prevNormal = normal;
-    }
-
-#else   // !SUPPORT_SPLINE_MITTERS
-
-    rl_Vector2 delta = { 0 };
-    float length = 0.0f;
-    float scale = 0.0f;
-
-    for (int i = 0; i < pointCount - 1; i++)
-    {
-        delta = (rl_Vector2){ points[i + 1].x - points[i].x, points[i + 1].y - points[i].y };
-        length = sqrtf(delta.x*delta.x + delta.y*delta.y);
-
-        if (length > 0) scale = thick/(2*length);
-
-        rl_Vector2 radius = { -scale*delta.y, scale*delta.x };
-        rl_Vector2 strip[4] = {
-            { points[i].x - radius.x, points[i].y - radius.y },
-            { points[i].x + radius.x, points[i].y + radius.y },
-            { points[i + 1].x - radius.x, points[i + 1].y - radius.y },
-            { points[i + 1].x + radius.x, points[i + 1].y + radius.y }
-        };
-
-        rl_DrawTriangleStrip(strip, 4, color);
-    }
+    join = LINE_JOIN_MITER;
 #endif
-
 #if defined(SUPPORT_SPLINE_SEGMENT_CAPS)
-    // TODO: Add spline segment rounded caps at the begin/end of the spline
+    cap = LINE_CAP_ROUND;
 #endif
+
+    rl_DrawLineStripEx(points, pointCount, thick, join, cap, color);
 }
 
 // Draw spline: B-Spline, minimum 4 points
 void rl_DrawSplineBasis(const rl_Vector2 *points, int pointCount, float thick, rl_Color color)
 {
-    if (pointCount < 4) return;
-
-    float a[4] = { 0 };
-    float b[4] = { 0 };
-    float dy = 0.0f;
-    float dx = 0.0f;
-    float size = 0.0f;
-
-    rl_Vector2 currentPoint = { 0 };
-    rl_Vector2 nextPoint = { 0 };
-    rl_Vector2 vertices[2*SPLINE_SEGMENT_DIVISIONS + 2] = { 0 };
-
-    for (int i = 0; i < (pointCount - 3); i++)
-    {
-        float t = 0.0f;
-        rl_Vector2 p1 = points[i], p2 = points[i + 1], p3 = points[i + 2], p4 = points[i + 3];
-
-        a[0] = (-p1.x + 3.0f*p2.x - 3.0f*p3.x + p4.x)/6.0f;
-        a[1] = (3.0f*p1.x - 6.0f*p2.x + 3.0f*p3.x)/6.0f;
-        a[2] = (-3.0f*p1.x + 3.0f*p3.x)/6.0f;
-        a[3] = (p1.x + 4.0f*p2.x + p3.x)/6.0f;
-
-        b[0] = (-p1.y + 3.0f*p2.y - 3.0f*p3.y + p4.y)/6.0f;
-        b[1] = (3.0f*p1.y - 6.0f*p2.y + 3.0f*p3.y)/6.0f;
-        b[2] = (-3.0f*p1.y + 3.0f*p3.y)/6.0f;
-        b[3] = (p1.y + 4.0f*p2.y + p3.y)/6.0f;
-
-        currentPoint.x = a[3];
-        currentPoint.y = b[3];
-
-        if (i == 0) rl_DrawCircleV(currentPoint, thick/2.0f, color);   // Draw init line circle-cap
-
-        if (i > 0)
-        {
-            vertices[0].x = currentPoint.x + dy*size;
-            vertices[0].y = currentPoint.y - dx*size;
-            vertices[1].x = currentPoint.x - dy*size;
-            vertices[1].y = currentPoint.y + dx*size;
-        }
-
-        for (int j = 1; j <= SPLINE_SEGMENT_DIVISIONS; j++)
-        {
-            t = ((float)j)/((float)SPLINE_SEGMENT_DIVISIONS);
-
-            nextPoint.x = a[3] + t*(a[2] + t*(a[1] + t*a[0]));
-            nextPoint.y = b[3] + t*(b[2] + t*(b[1] + t*b[0]));
-
-            dy = nextPoint.y - currentPoint.y;
-            dx = nextPoint.x - currentPoint.x;
-            size = 0.5f*thick/sqrtf(dx*dx+dy*dy);
-
-            if ((i == 0) && (j == 1))
-            {
-                vertices[0].x = currentPoint.x + dy*size;
-                vertices[0].y = currentPoint.y - dx*size;
-                vertices[1].x = currentPoint.x - dy*size;
-                vertices[1].y = currentPoint.y + dx*size;
-            }
-
-            vertices[2*j + 1].x = nextPoint.x - dy*size;
-            vertices[2*j + 1].y = nextPoint.y + dx*size;
-            vertices[2*j].x = nextPoint.x + dy*size;
-            vertices[2*j].y = nextPoint.y - dx*size;
-
-            currentPoint = nextPoint;
-        }
-
-        rl_DrawTriangleStrip(vertices, 2*SPLINE_SEGMENT_DIVISIONS + 2, color);
-    }
-
-    rl_DrawCircleV(currentPoint, thick/2.0f, color);   // Draw end line circle-cap
+    DrawSplineFlattened(SPLINE_BASIS, points, pointCount, thick, LINE_CAP_ROUND, color);
 }
 
 // Draw spline: Catmull-Rom, minimum 4 points
 void rl_DrawSplineCatmullRom(const rl_Vector2 *points, int pointCount, float thick, rl_Color color)
 {
-    if (pointCount < 4) return;
-
-    float dy = 0.0f;
-    float dx = 0.0f;
-    float size = 0.0f;
-
-    rl_Vector2 currentPoint = points[1];
-    rl_Vector2 nextPoint = { 0 };
-    rl_Vector2 vertices[2*SPLINE_SEGMENT_DIVISIONS + 2] = { 0 };
-
-    rl_DrawCircleV(currentPoint, thick/2.0f, color);   // Draw init line circle-cap
-
-    for (int i = 0; i < (pointCount - 3); i++)
-    {
-        float t = 0.0f;
-        rl_Vector2 p1 = points[i], p2 = points[i + 1], p3 = points[i + 2], p4 = points[i + 3];
-
-        if (i > 0)
-        {
-            vertices[0].x = currentPoint.x + dy*size;
-            vertices[0].y = currentPoint.y - dx*size;
-            vertices[1].x = currentPoint.x - dy*size;
-            vertices[1].y = currentPoint.y + dx*size;
-        }
-
-        for (int j = 1; j <= SPLINE_SEGMENT_DIVISIONS; j++)
-        {
-            t = ((float)j)/((float)SPLINE_SEGMENT_DIVISIONS);
-
-            float q0 = (-1.0f*t*t*t) + (2.0f*t*t) + (-1.0f*t);
-            float q1 = (3.0f*t*t*t) + (-5.0f*t*t) + 2.0f;
-            float q2 = (-3.0f*t*t*t) + (4.0f*t*t) + t;
-            float q3 = t*t*t - t*t;
-
-            nextPoint.x = 0.5f*((p1.x*q0) + (p2.x*q1) + (p3.x*q2) + (p4.x*q3));
-            nextPoint.y = 0.5f*((p1.y*q0) + (p2.y*q1) + (p3.y*q2) + (p4.y*q3));
-
-            dy = nextPoint.y - currentPoint.y;
-            dx = nextPoint.x - currentPoint.x;
-            size = (0.5f*thick)/sqrtf(dx*dx + dy*dy);
-
-            if ((i == 0) && (j == 1))
-            {
-                vertices[0].x = currentPoint.x + dy*size;
-                vertices[0].y = currentPoint.y - dx*size;
-                vertices[1].x = currentPoint.x - dy*size;
-                vertices[1].y = currentPoint.y + dx*size;
-            }
-
-            vertices[2*j + 1].x = nextPoint.x - dy*size;
-            vertices[2*j + 1].y = nextPoint.y + dx*size;
-            vertices[2*j].x = nextPoint.x + dy*size;
-            vertices[2*j].y = nextPoint.y - dx*size;
-
-            currentPoint = nextPoint;
-        }
-
-        rl_DrawTriangleStrip(vertices, 2*SPLINE_SEGMENT_DIVISIONS + 2, color);
-    }
-
-    rl_DrawCircleV(currentPoint, thick/2.0f, color);   // Draw end line circle-cap
+    DrawSplineFlattened(SPLINE_CATMULLROM, points, pointCount, thick, LINE_CAP_ROUND, color);
 }
 
 // Draw spline: Quadratic Bezier, minimum 3 points (1 control point): [p1, c2, p3, c4...]
 void rl_DrawSplineBezierQuadratic(const rl_Vector2 *points, int pointCount, float thick, rl_Color color)
 {
-    if (pointCount < 3) return;
-
-    for (int i = 0; i < pointCount - 2; i++)
-    {
-        rl_DrawSplineSegmentBezierQuadratic(points[i], points[i + 1], points[i + 2], thick, color);
-    }
+    DrawSplineFlattened(SPLINE_BEZIER_QUADRATIC, points, pointCount, thick, LINE_CAP_BUTT, color);
 }
 
 // Draw spline: Cubic Bezier, minimum 4 points (2 control points): [p1, c2, c3, p4, c5, c6...]
 void rl_DrawSplineBezierCubic(const rl_Vector2 *points, int pointCount, float thick, rl_Color color)
 {
-    if (pointCount < 4) return;
-
-    for (int i = 0; i < pointCount - 3; i++)
-    {
-        rl_DrawSplineSegmentBezierCubic(points[i], points[i + 1], points[i + 2], points[i + 3], thick, color);
-    }
+    DrawSplineFlattened(SPLINE_BEZIER_CUBIC, points, pointCount, thick, LINE_CAP_BUTT, color);
 }
 
 // Draw spline segment: Linear, 2 points
@@ -1877,196 +1774,103 @@ void rl_DrawSplineSegmentLinear(rl_Vector2 p1, rl_Vector2 p2, float thick, rl_Co
 // Draw spline segment: B-Spline, 4 points
 void rl_DrawSplineSegmentBasis(rl_Vector2 p1, rl_Vector2 p2, rl_Vector2 p3, rl_Vector2 p4, float thick, rl_Color color)
 {
-    const float step = 1.0f/SPLINE_SEGMENT_DIVISIONS;
+    rl_Vector2 points[4] = { p1, p2, p3, p4 };
 
-    rl_Vector2 currentPoint = { 0 };
-    rl_Vector2 nextPoint = { 0 };
-    float t = 0.0f;
+    DrawSplineFlattened(SPLINE_BASIS, points, 4, thick, LINE_CAP_BUTT, color);
+}
 
-    rl_Vector2 points[2*SPLINE_SEGMENT_DIVISIONS + 2] = { 0 };
+// Draw spline segment: Catmull-Rom, 4 points
+void rl_DrawSplineSegmentCatmullRom(rl_Vector2 p1, rl_Vector2 p2, rl_Vector2 p3, rl_Vector2 p4, float thick, rl_Color color)
+{
+    rl_Vector2 points[4] = { p1, p2, p3, p4 };
 
-    float a[4] = { 0 };
-    float b[4] = { 0 };
+    DrawSplineFlattened(SPLINE_CATMULLROM, points, 4, thick, LINE_CAP_BUTT, color);
+}
 
-    a[0] = (-p1.x + 3*p2.x - 3*p3.x + p4.x)/6.0f;
-    a[1] = (3*p1.x - 6*p2.x + 3*p3.x)/6.0f;
-    a[2] = (-3*p1.x + 3*p3.x)/6.0f;
-    a[3] = (p1.x + 4*p2.x + p3.x)/6.0f;
+// Draw spline segment: Quadratic Bezier, 2 points, 1 control point
+void rl_DrawSplineSegmentBezierQuadratic(rl_Vector2 p1, rl_Vector2 c2, rl_Vector2 p3, float thick, rl_Color color)
+{
+    rl_Vector2 points[3] = { p1, c2, p3 };
 
-    b[0] = (-p1.y + 3*p2.y - 3*p3.y + p4.y)/6.0f;
-    b[1] = (3*p1.y - 6*p2.y + 3*p3.y)/6.0f;
-    b[2] = (-3*p1.y + 3*p3.y)/6.0f;
-    b[3] = (p1.y + 4*p2.y + p3.y)/6.0f;
+    DrawSplineFlattened(SPLINE_BEZIER_QUADRATIC, points, 3, thick, LINE_CAP_BUTT, color);
+}
 
-    currentPoint.x = a[3];
-    currentPoint.y = b[3];
+// Draw spline segment: Cubic Bezier, 2 points, 2 control points
+void rl_DrawSplineSegmentBezierCubic(rl_Vector2 p1, rl_Vector2 c2, rl_Vector2 c3, rl_Vector2 p4, float thick, rl_Color color)
+{
+    rl_Vector2 points[4] = { p1, c2, c3, p4 };
 
-    for (int i = 0; i <= SPLINE_SEGMENT_DIVISIONS; i++)
-    {
-        t = step*(float)i;
+    DrawSplineFlattened(SPLINE_BEZIER_CUBIC, points, 4, thick, LINE_CAP_BUTT, color);
+}
+
+// Set splines flattening tolerance in pixels
+// NOTE: Tolerance 0.0f uses SPLINE_SEGMENT_DIVISIONS fixed divisions for every segment
+void rl_SetSplineTolerance(float tolerance)
+{
+    splineTolerance = (tolerance > 0.0f)? tolerance : 0.0f;
+}
 
-        nextPoint.x = a[3] + t*(a[2] + t*(a[1] + t*a[0]));
-        nextPoint.y = b[3] + t*(b[2] + t*(b[1] + t*b[0]));
+// Load spline from control points (copied)
+rl_Spline rl_LoadSpline(int type, const rl_Vector2 *points, int pointCount)
+{
+    rl_Spline spline = { 0 };
 
-        float dy = nextPoint.y - currentPoint.y;
-        float dx = nextPoint.x - currentPoint.x;
-        float size = (0.5f*thick)/sqrtf(dx*dx + dy*dy);
+    spline.type = type;
+    rl_UpdateSpline(&spline, points, pointCount);
 
-        if (i == 1)
+    return spline;
+}
+
+// Update spline control points
+// NOTE: Flattened points are kept if control points did not change
+void rl_UpdateSpline(rl_Spline *spline, const rl_Vector2 *points, int pointCount)
+{
+    if ((points == NULL) || (pointCount <= 0)) pointCount = 0;
+
+    if ((pointCount != spline->pointCount) || ((pointCount > 0) && (memcmp(points, spline->points, pointCount*sizeof(rl_Vector2)) != 0)))
+    {
+        if (pointCount != spline->pointCount)
         {
-            points[0].x = currentPoint.x + dy*size;
-            points[0].y = currentPoint.y - dx*size;
-            points[1].x = currentPoint.x - dy*size;
-            points[1].y = currentPoint.y + dx*size;
+            RL_FREE(spline->points);
+            spline->points = (pointCount > 0)? (rl_Vector2 *)RL_MALLOC(pointCount*sizeof(rl_Vector2)) : NULL;
+            spline->pointCount = (spline->points != NULL)? pointCount : 0;
         }
 
-        points[2*i + 1].x = nextPoint.x - dy*size;
-        points[2*i + 1].y = nextPoint.y + dx*size;
-        points[2*i].x = nextPoint.x + dy*size;
-        points[2*i].y = nextPoint.y - dx*size;
+        if (spline->pointCount > 0) memcpy(spline->points, points, spline->pointCount*sizeof(rl_Vector2));
 
-        currentPoint = nextPoint;
+        spline->flatCount = 0;
     }
-
-    rl_DrawTriangleStrip(points, 2*SPLINE_SEGMENT_DIVISIONS+2, color);
 }
 
-// Draw spline segment: Catmull-Rom, 4 points
-void rl_DrawSplineSegmentCatmullRom(rl_Vector2 p1, rl_Vector2 p2, rl_Vector2 p3, rl_Vector2 p4, float thick, rl_Color color)
+// Unload spline control and flattened points
+void rl_UnloadSpline(rl_Spline spline)
 {
-    const float step = 1.0f/SPLINE_SEGMENT_DIVISIONS;
-
-    rl_Vector2 currentPoint = p1;
-    rl_Vector2 nextPoint = { 0 };
-    float t = 0.0f;
+    RL_FREE(spline.points);
+    RL_FREE(spline.flatPoints);
+}
 
-    rl_Vector2 points[2*SPLINE_SEGMENT_DIVISIONS + 2] = { 0 };
-
-    for (int i = 0; i <= SPLINE_SEGMENT_DIVISIONS; i++)
-    {
-        t = step*(float)i;
-
-        float q0 = (-1*t*t*t) + (2*t*t) + (-1*t);
-        float q1 = (3*t*t*t) + (-5*t*t) + 2;
-        float q2 = (-3*t*t*t) + (4*t*t) + t;
-        float q3 = t*t*t - t*t;
-
-        nextPoint.x = 0.5f*((p1.x*q0) + (p2.x*q1) + (p3.x*q2) + (p4.x*q3));
-        nextPoint.y = 0.5f*((p1.y*q0) + (p2.y*q1) + (p3.y*q2) + (p4.y*q3));
-
-        float dy = nextPoint.y - currentPoint.y;
-        float dx = nextPoint.x - currentPoint.x;
-        float size = (0.5f*thick)/sqrtf(dx*dx + dy*dy);
-
-        if (i == 1)
-        {
-            points[0].x = currentPoint.x + dy*size;
-            points[0].y = currentPoint.y - dx*size;
-            points[1].x = currentPoint.x - dy*size;
-            points[1].y = currentPoint.y + dx*size;
-        }
-
-        points[2*i + 1].x = nextPoint.x - dy*size;
-        points[2*i + 1].y = nextPoint.y + dx*size;
-        points[2*i].x = nextPoint.x + dy*size;
-        points[2*i].y = nextPoint.y - dx*size;
-
-        currentPoint = nextPoint;
-    }
-
-    rl_DrawTriangleStrip(points, 2*SPLINE_SEGMENT_DIVISIONS + 2, color);
-}
-
-// Draw spline segment: Quadratic Bezier, 2 points, 1 control point
-void rl_DrawSplineSegmentBezierQuadratic(rl_Vector2 p1, rl_Vector2 c2, rl_Vector2 p3, float thick, rl_Color color)
+// Draw spline, flattened points are computed only if control points changed or scale changed over 2x
+void rl_DrawSpline(rl_Spline *spline, float thick, rl_Color color)
 {
-    const float step = 1.0f/SPLINE_SEGMENT_DIVISIONS;
-
-    rl_Vector2 previous = p1;
-    rl_Vector2 current = { 0 };
-    float t = 0.0f;
-
-    rl_Vector2 points[2*SPLINE_SEGMENT_DIVISIONS + 2] = { 0 };
-
-    for (int i = 1; i <= SPLINE_SEGMENT_DIVISIONS; i++)
+    if (spline->type == SPLINE_LINEAR) rl_DrawSplineLinear(spline->points, spline->pointCount, thick, color);
+    else
     {
-        t = step*(float)i;
-
-        float a = powf(1.0f - t, 2);
-        float b = 2.0f*(1.0f - t)*t;
-        float c = powf(t, 2);
-
-        // NOTE: The easing functions aren't suitable here because they don't take a control point
-        current.y = a*p1.y + b*c2.y + c*p3.y;
-        current.x = a*p1.x + b*c2.x + c*p3.x;
+        float tolerance = GetSplineTolerance();
 
-        float dy = current.y - previous.y;
-        float dx = current.x - previous.x;
-        float size = 0.5f*thick/sqrtf(dx*dx+dy*dy);
-
-        if (i == 1)
+        if ((spline->flatCount == 0) || (tolerance < 0.5f*spline->flatTolerance) || (tolerance > 2.0f*spline->flatTolerance))
         {
-            points[0].x = previous.x + dy*size;
-            points[0].y = previous.y - dx*size;
-            points[1].x = previous.x - dy*size;
-            points[1].y = previous.y + dx*size;
-        }
-
-        points[2*i + 1].x = current.x - dy*size;
-        points[2*i + 1].y = current.y + dx*size;
-        points[2*i].x = current.x + dy*size;
-        points[2*i].y = current.y - dx*size;
+            int count = FlattenSpline(spline->type, spline->points, spline->pointCount, tolerance, NULL);
 
-        previous = current;
-    }
-
-    rl_DrawTriangleStrip(points, 2*SPLINE_SEGMENT_DIVISIONS + 2, color);
-}
-
-// Draw spline segment: Cubic Bezier, 2 points, 2 control points
-void rl_DrawSplineSegmentBezierCubic(rl_Vector2 p1, rl_Vector2 c2, rl_Vector2 c3, rl_Vector2 p4, float thick, rl_Color color)
-{
-    const float step = 1.0f/SPLINE_SEGMENT_DIVISIONS;
-
-    rl_Vector2 previous = p1;
-    rl_Vector2 current = { 0 };
-    float t = 0.0f;
-
-    rl_Vector2 points[2*SPLINE_SEGMENT_DIVISIONS + 2] = { 0 };
-
-    for (int i = 1; i <= SPLINE_SEGMENT_DIVISIONS; i++)
-    {
-        t = step*(float)i;
-
-        float a = powf(1.0f - t, 3);
-        float b = 3.0f*powf(1.0f - t, 2)*t;
-        float c = 3.0f*(1.0f - t)*powf(t, 2);
-        float d = powf(t, 3);
-
-        current.y = a*p1.y + b*c2.y + c*c3.y + d*p4.y;
-        current.x = a*p1.x + b*c2.x + c*c3.x + d*p4.x;
-
-        float dy = current.y - previous.y;
-        float dx = current.x - previous.x;
-        float size = 0.5f*thick/sqrtf(dx*dx+dy*dy);
-
-        if (i == 1)
-        {
-            points[0].x = previous.x + dy*size;
-            points[0].y = previous.y - dx*size;
-            points[1].x = previous.x - dy*size;
-            points[1].y = previous.y + dx*size;
+            RL_FREE(spline->flatPoints);
+            spline->flatPoints = (count > 0)? (rl_Vector2 *)RL_MALLOC(count*sizeof(rl_Vector2)) : NULL;
+            spline->flatCount = (spline->flatPoints != NULL)? FlattenSpline(spline->type, spline->points, spline->pointCount, tolerance, spline->flatPoints) : 0;
+            spline->flatTolerance = tolerance;
         }
 
-        points[2*i + 1].x = current.x - dy*size;
-        points[2*i + 1].y = current.y + dx*size;
-        points[2*i].x = current.x + dy*size;
-        points[2*i].y = current.y - dx*size;
+        int cap = ((spline->type == SPLINE_BASIS) || (spline->type == SPLINE_CATMULLROM))? LINE_CAP_ROUND : LINE_CAP_BUTT;
 
-        previous = current;
+        rl_DrawLineStripEx(spline->flatPoints, spline->flatCount, thick, LINE_JOIN_MITER, cap, color);
     }
-
-    rl_DrawTriangleStrip(points, 2*SPLINE_SEGMENT_DIVISIONS + 2, color);
 }
 
 // Get spline point for a given t [0.0f .. 1.0f], Linear
@@ -2385,4 +2189,883 @@ static float EaseCubicInOut(float t, float b, float c, float d)
     return result;
 }
 
+// Unload shapes module cached data (unit circle tables, SDF shapes and lines shaders, splines points)
+// NOTE: Called by rl_CloseWindow() [rcore]
+void UnloadShapesCache(void)
+{
+    for (int i = 0; i < SHAPES_TRIG_CACHE_SIZE; i++)
+    {
+        RL_FREE(trigTables[i].points);
+        trigTables[i] = (TrigTable){ 0 };
+    }
+
+    trigTablesNext = 0;
+
+    RL_FREE(arcPoints);
+    arcPoints = NULL;
+    arcPointsCapacity = 0;
+
+    if (shaderShapesSDF.id > 0) rl_UnloadShader(shaderShapesSDF);
+    shaderShapesSDF = (rl_Shader){ 0 };
+    shapesSDFMode = false;
+    shaderSDFPrevious = (rl_Shader){ 0 };
+
+    if ((linesRenderer.shaderId > 0) && (linesRenderer.shaderId != rlGetShaderIdDefault())) rlUnloadShaderProgram(linesRenderer.shaderId);
+    rlUnloadVertexArray(linesRenderer.vaoId);
+    rlUnloadVertexBuffer(linesRenderer.vboId[0]);
+    rlUnloadVertexBuffer(linesRenderer.vboId[1]);
+    linesRenderer = (LinesRenderer){ 0 };
+
+    RL_FREE(splinePoints);
+    splinePoints = NULL;
+    splinePointsCapacity = 0;
+}
+
+// Get unit circle table for a number of segments
+// NOTE: Table is computed once and reused by all circular shapes with the same segments,
+// it contains two turns so any arc up to a full circle can be read contiguously
+static const rl_Vector2 *GetCircleTable(int segments)
+{
+    for (int i = 0; i < SHAPES_TRIG_CACHE_SIZE; i++)
+    {
+        if (trigTables[i].segments == segments) return trigTables[i].points;
+    }
+
+    TrigTable *table = &trigTables[trigTablesNext];
+    trigTablesNext = (trigTablesNext + 1)%SHAPES_TRIG_CACHE_SIZE;
+
+    RL_FREE(table->points);
+    table->segments = segments;
+    table->points = (rl_Vector2 *)RL_MALLOC((segments*2 + 1)*sizeof(rl_Vector2));
+
+    if (table->points == NULL)
+    {
+        TRACELOG(LOG_WARNING, "SHAPES: Failed to allocate circle table (%i segments)", segments);
+        table->segments = 0;
+        return NULL;
+    }
+
+    for (int i = 0; i < segments; i++)
+    {
+        double angle = 2.0*PI*(double)i/(double)segments;
+
+        table->points[i] = (rl_Vector2){ (float)cos(angle), (float)sin(angle) };
+        table->points[i + segments] = table->points[i];
+    }
+
+    table->points[segments*2] = table->points[0];
+
+    return table->points;
+}
+
+// Get unit arc points from startAngle to endAngle (in degrees), (segments + 1) points
+// NOTE: Arcs aligned to a full circle subdivision are read from the cached tables,
+// other arcs are generated by rotation, points are only valid until next call, NULL if points can not be allocated
+static const rl_Vector2 *GetUnitArc(float startAngle, float endAngle, int segments)
+{
+    const rl_Vector2 *points = NULL;
+    float span = endAngle - startAngle;
+
+    // Check arc step divides the full circle and arc starts at one of the table steps
+    float stepCount = (span > 0.0f)? 360.0f*(float)segments/span : 0.0f;
+    int tableSegments = (int)(stepCount + 0.5f);
+
+    if ((tableSegments > 0) && (tableSegments >= segments) && (tableSegments <= SHAPES_TRIG_TABLE_MAX_SEGMENTS) &&
+        (fabsf(stepCount - (float)tableSegments) < 0.001f))
+    {
+        float start = startAngle*(float)tableSegments/360.0f;
+        float startIndex = floorf(start + 0.5f);
+
+        if (fabsf(start - startIndex) < 0.001f)
+        {
+            int index = (int)fmodf(startIndex, (float)tableSegments);
+            if (index < 0) index += tableSegments;
+
+            const rl_Vector2 *table = GetCircleTable(tableSegments);
+            if (table != NULL) points = table + index;
+        }
+    }
+
+    if (points == NULL)
+    {
+        if (segments < 0) segments = 0;
+
+        if (arcPointsCapacity < (segments + 1))
+        {
+            rl_Vector2 *newPoints = (rl_Vector2 *)RL_REALLOC(arcPoints, (segments + 1)*sizeof(rl_Vector2));
+
+            if (newPoints == NULL)
+            {
+                TRACELOG(LOG_WARNING, "SHAPES: Failed to allocate arc points (%i segments)", segments);
+                return NULL;
+            }
+
+            arcPoints = newPoints;
+            arcPointsCapacity = segments + 1;
+        }
+
+        // Rotate start point by the step angle, computed in double to avoid drifting
+        double step = (segments > 0)? (double)span*DEG2RAD/segments : 0.0;
+        double cosStep = cos(step);
+        double sinStep = sin(step);
+        double x = cos((double)startAngle*DEG2RAD);
+        double y = sin((double)startAngle*DEG2RAD);
+
+        for (int i = 0; i <= segments; i++)
+        {
+            arcPoints[i] = (rl_Vector2){ (float)x, (float)y };
+
+            double tx = x*cosStep - y*sinStep;
+            y = x*sinStep + y*cosStep;
+            x = tx;
+        }
+
+        points = arcPoints;
+    }
+
+    return points;
+}
+
+// Load SDF shapes shader
+// NOTE: Default shader superset, fragments with shape data (normal.z < -1.5) evaluate the shape distance:
+//   - Rounded box: normal = (halfSize.x - radius, halfSize.y - radius, -(radius + 2))
+//   - Ring: normal = (innerRadius, -1, -(outerRadius + 2))
+// Texture coordinates provide the fragment position in shape local space
+static void LoadShaderShapesSDF(void)
+{
+    const char *vsCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec3 vertexNormal;       \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec3 fragShape;            \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec3 vertexNormal;       \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec3 fragShape;            \n"
+    "varying vec4 fragColor;            \n"
+#else
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec3 vertexNormal;              \n"
+    "in vec4 vertexColor;               \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec3 fragShape;                \n"
+    "out vec4 fragColor;                \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragShape = vertexNormal;      \n"
+    "    fragColor = vertexColor;       \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    const char *fsCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec3 fragShape;            \n"
+    "varying vec4 fragColor;            \n"
+    "#define finalColor gl_FragColor    \n"
+    "#define texture texture2D          \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "#extension GL_OES_standard_derivatives : enable \n"
+    "#ifdef GL_FRAGMENT_PRECISION_HIGH  \n"
+    "precision highp float;             \n"     // Shape coordinates are in pixels, mediump is not enough
+    "#else                              \n"
+    "precision mediump float;           \n"
+    "#endif                             \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec3 fragShape;            \n"
+    "varying vec4 fragColor;            \n"
+    "#define finalColor gl_FragColor    \n"
+    "#define texture texture2D          \n"
+#else
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec3 fragShape;                 \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+#endif
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture(texture0, fragTexCoord); \n"
+    "    float pixelSize = 0.5*(length(dFdx(fragTexCoord)) + length(dFdy(fragTexCoord))); \n"
+    "    if (fragShape.z > -1.5) finalColor = texelColor*colDiffuse*fragColor; \n"
+    "    else                           \n"
+    "    {                              \n"
+    "        float radius = -fragShape.z - 2.0; \n"
+    "        float dist = 0.0;          \n"
+    "        if (fragShape.y < 0.0)     \n"
+    "        {                          \n"
+    "            float len = length(fragTexCoord); \n"
+    "            dist = max(len - radius, fragShape.x - len); \n"
+    "        }                          \n"
+    "        else                       \n"
+    "        {                          \n"
+    "            vec2 q = abs(fragTexCoord) - fragShape.xy; \n"
+    "            dist = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - radius; \n"
+    "        }                          \n"
+    "        float alpha = clamp(0.5 - dist/max(pixelSize, 0.0001), 0.0, 1.0); \n"
+    "        finalColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse; \n"
+    "    }                              \n"
+    "}                                  \n";
+
+    shaderShapesSDF = rl_LoadShaderFromMemory(vsCode, fsCode);
+
+    if (shaderShapesSDF.id == rlGetShaderIdDefault()) TRACELOG(LOG_WARNING, "SHAPES: Failed to load SDF shapes shader, shapes are tessellated");
+}
+
+// Draw SDF shape quad, oriented by axis and covering size (half extents) plus anti-aliasing margin
+// NOTE: Quad provides the shape local position as texcoords and shape parameters as raw normal,
+// using the SDF shapes shader encoding (radius provided in shape.z), margin is converted from pixels
+// to shape units with current matrices and framebuffer size
+static void DrawShapeQuadSDF(rl_Vector2 center, rl_Vector2 axis, rl_Vector2 size, rl_Vector3 shape, rl_Color color)
+{
+    float pixelScale = GetPixelScale(MatrixMultiply(MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview()), rlGetMatrixProjection()));
+    float margin = (pixelScale > 0.0f)? SHAPES_SDF_MARGIN/pixelScale : SHAPES_SDF_MARGIN;
+
+    float width = size.x + margin;
+    float height = size.y + margin;
+
+    rl_Vector2 axisX = { axis.x*width, axis.y*width };
+    rl_Vector2 axisY = { -axis.y*height, axis.x*height };
+
+    rlSetTexture(GetShapesTexture().id);
+
+    rlBegin(RL_QUADS);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        rlNormal3fRaw(shape.x, shape.y, -(shape.z + 2.0f));
+
+        rlTexCoord2f(-width, -height);
+        rlVertex2f(center.x - axisX.x - axisY.x, center.y - axisX.y - axisY.y);
+
+        rlTexCoord2f(-width, height);
+        rlVertex2f(center.x - axisX.x + axisY.x, center.y - axisX.y + axisY.y);
+
+        rlTexCoord2f(width, height);
+        rlVertex2f(center.x + axisX.x + axisY.x, center.y + axisX.y + axisY.y);
+
+        rlTexCoord2f(width, -height);
+        rlVertex2f(center.x + axisX.x - axisY.x, center.y + axisX.y - axisY.y);
+
+        // Reset normal, next vertex must not be evaluated as SDF shape
+        rlNormal3fRaw(0.0f, 0.0f, 1.0f);
+    rlEnd();
+
+    rlSetTexture(0);
+}
+
+// Load line strips GPU expansion shader and template vertices
+// NOTE: Every instance reads consecutive points (pointA, pointB, pointC) from the same points buffer,
+// attributes offsets select the draw: segment bodies, joins (outer side) or caps
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void LoadLinesRenderer(void)
+{
+    const char *vsCode =
+    #if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec2 vertexPosition;     \n"     // Template vertex: segment (t, side) or fan (step, center)
+    "attribute vec2 pointA;             \n"
+    "attribute vec2 pointB;             \n"
+    "attribute vec2 pointC;             \n"
+    "varying float fragEdge;            \n"
+    #elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec2 vertexPosition;     \n"     // Template vertex: segment (t, side) or fan (step, center)
+    "attribute vec2 pointA;             \n"
+    "attribute vec2 pointB;             \n"
+    "attribute vec2 pointC;             \n"
+    "varying float fragEdge;            \n"
+    #else
+    "#version 330                       \n"
+    "in vec2 vertexPosition;            \n"     // Template vertex: segment (t, side) or fan (step, center)
+    "in vec2 pointA;                    \n"
+    "in vec2 pointB;                    \n"
+    "in vec2 pointC;                    \n"
+    "out float fragEdge;                \n"
+    #endif
+    "uniform mat4 mvp;                  \n"
+    "uniform vec4 lineParams;           \n"     // Half thickness, anti-aliasing width, fan segments, miter limit
+    "uniform vec2 lineMode;             \n"     // Draw mode (0: segments, 1: joins, 2: caps), fan type
+    "vec2 Direction(vec2 v)             \n"
+    "{                                  \n"
+    "    float len = length(v);         \n"
+    "    return (len > 0.0)? v/len : vec2(1.0, 0.0); \n"
+    "}                                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float radius = lineParams.x + lineParams.y; \n"
+    "    vec2 position = pointB;        \n"
+    "    fragEdge = 0.0;                \n"
+    "    if (lineMode.x < 0.5)          \n"
+    "    {                              \n"
+    "        vec2 d = Direction(pointB - pointA); \n"
+    "        position = mix(pointA, pointB, vertexPosition.x) + vec2(-d.y, d.x)*vertexPosition.y*radius; \n"
+    "        fragEdge = vertexPosition.y*radius; \n"
+    "    }                              \n"
+    "    else if (vertexPosition.y < 0.5) \n"
+    "    {                              \n"
+    "        vec2 d = Direction(pointB - pointA); \n"
+    "        vec2 a = vec2(-d.y, d.x);  \n"
+    "        vec2 b = -a;               \n"
+    "        float sweep = -3.14159265; \n"
+    "        if (lineMode.x < 1.5)      \n"     // Join: outer side offsets, clockwise
+    "        {                          \n"
+    "            vec2 d1 = Direction(pointC - pointB); \n"
+    "            if ((d.x*d1.y - d.y*d1.x) > 0.0) { b = vec2(d.y, -d.x); a = vec2(d1.y, -d1.x); } \n"
+    "            else b = vec2(-d1.y, d1.x); \n"
+    "            sweep = atan(a.x*b.y - a.y*b.x, dot(a, b)); \n"
+    "            if (dot(a, b) <= -0.999999) sweep = -3.14159265; \n"     // Reversal: half turn clockwise
+    "        }                          \n"
+    "        float u = vertexPosition.x/lineParams.z; \n"
+    "        vec2 offset = mix(a, b, u); \n"    // Bevel
+    "        if (lineMode.y < 0.5)      \n"     // Miter, bevel on reversal (no miter direction)
+    "        {                          \n"
+    "            vec2 m = Direction(a + b); \n"
+    "            float c = dot(m, a);   \n"
+    "            if (((c*lineParams.w) >= 1.0) && (dot(a, b) > -0.999999)) offset = (u < 0.5)? mix(a, m/c, 2.0*u) : mix(m/c, b, 2.0*u - 1.0); \n"
+    "        }                          \n"
+    "        else if (lineMode.y > 2.5) \n"     // Square
+    "        {                          \n"
+    "            float s = 3.0*u;       \n"
+    "            if (s < 1.0) offset = mix(a, a + d, s); \n"
+    "            else if (s < 2.0) offset = mix(a + d, b + d, s - 1.0); \n"
+    "            else offset = mix(b + d, b, s - 2.0); \n"
+    "        }                          \n"
+    "        else if (lineMode.y > 1.5) \n"     // Round
+    "        {                          \n"
+    "            float angle = sweep*u; \n"
+    "            offset = vec2(a.x*cos(angle) - a.y*sin(angle), a.x*sin(angle) + a.y*cos(angle)); \n"
+    "        }                          \n"
+    "        position = pointB + offset*radius; \n"
+    "        fragEdge = radius;         \n"
+    "    }                              \n"
+    "    gl_Position = mvp*vec4(position, 0.0, 1.0); \n"
+    "}                                  \n";
+
+    const char *fsCode =
+    #if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying float fragEdge;            \n"
+    "#define finalColor gl_FragColor    \n"
+    #elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "#ifdef GL_FRAGMENT_PRECISION_HIGH  \n"
+    "precision highp float;             \n"
+    "#else                              \n"
+    "precision mediump float;           \n"
+    "#endif                             \n"
+    "varying float fragEdge;            \n"
+    "#define finalColor gl_FragColor    \n"
+    #else
+    "#version 330                       \n"
+    "in float fragEdge;                 \n"
+    "out vec4 finalColor;               \n"
+    #endif
+    "uniform vec4 lineParams;           \n"
+    "uniform vec4 lineColor;            \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float alpha = clamp((lineParams.x - abs(fragEdge))/lineParams.y + 0.5, 0.0, 1.0); \n"
+    "    finalColor = vec4(lineColor.rgb, lineColor.a*alpha); \n"
+    "}                                  \n";
+
+    linesRenderer.shaderId = rlLoadShaderCode(vsCode, fsCode);
+
+    if (linesRenderer.shaderId != rlGetShaderIdDefault())
+    {
+        linesRenderer.locTemplate = rlGetLocationAttrib(linesRenderer.shaderId, "vertexPosition");
+        linesRenderer.locPoints[0] = rlGetLocationAttrib(linesRenderer.shaderId, "pointA");
+        linesRenderer.locPoints[1] = rlGetLocationAttrib(linesRenderer.shaderId, "pointB");
+        linesRenderer.locPoints[2] = rlGetLocationAttrib(linesRenderer.shaderId, "pointC");
+        linesRenderer.locMvp = rlGetLocationUniform(linesRenderer.shaderId, "mvp");
+        linesRenderer.locParams = rlGetLocationUniform(linesRenderer.shaderId, "lineParams");
+        linesRenderer.locMode = rlGetLocationUniform(linesRenderer.shaderId, "lineMode");
+        linesRenderer.locColor = rlGetLocationUniform(linesRenderer.shaderId, "lineColor");
+
+        // Template vertices: segment quad (t, side) followed by fan triangles (step, center)
+        // NOTE: Triangles winding is the same one used by all 2d shapes
+        float vertices[2*(6 + 3*LINES_MAX_FAN_SEGMENTS)] = { 0.0f, -1.0f, 1.0f, 1.0f, 1.0f, -1.0f, 0.0f, -1.0f, 0.0f, 1.0f, 1.0f, 1.0f };
+
+        for (int k = 0; k < LINES_MAX_FAN_SEGMENTS; k++)
+        {
+            float *triangle = &vertices[12 + 6*k];
+
+            triangle[0] = 0.0f; triangle[1] = 1.0f;
+            triangle[2] = (float)k; triangle[3] = 0.0f;
+            triangle[4] = (float)(k + 1); triangle[5] = 0.0f;
+        }
+
+        linesRenderer.vaoId = rlLoadVertexArray();
+        rlEnableVertexArray(linesRenderer.vaoId);
+        linesRenderer.vboId[0] = rlLoadVertexBuffer(vertices, sizeof(vertices), false);
+        rlDisableVertexArray();
+        rlDisableVertexBuffer();
+    }
+    else TRACELOG(LOG_WARNING, "SHAPES: Failed to load lines shader, line strips are triangulated on CPU");
+}
+#endif
+
+// Draw line strip expanded on GPU, returns false if not possible
+// NOTE: Custom shaders expect shapes vertex data through the render batch
+static bool DrawLineStripInstanced(const rl_Vector2 *points, int pointCount, float thick, int join, int cap, rl_Color color)
+{
+    bool drawn = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (rlIsInstancingSupported() && (rlGetShaderIdCurrent() == rlGetShaderIdDefault()))
+    {
+        if (linesRenderer.shaderId == 0) LoadLinesRenderer();
+
+        drawn = (linesRenderer.shaderId != rlGetShaderIdDefault());
+    }
+
+    if (drawn)
+    {
+        // Shapes already batched must be drawn first
+        rlDrawRenderBatchActive();
+
+        // Upload points as provided, buffer is reloaded only when it requires to grow
+        if (pointCount > linesRenderer.pointsCapacity)
+        {
+            rlUnloadVertexBuffer(linesRenderer.vboId[1]);
+            linesRenderer.pointsCapacity = (pointCount > 2*linesRenderer.pointsCapacity)? pointCount : 2*linesRenderer.pointsCapacity;
+            linesRenderer.vboId[1] = rlLoadVertexBuffer(NULL, linesRenderer.pointsCapacity*sizeof(rl_Vector2), true);
+        }
+
+        rlUpdateVertexBuffer(linesRenderer.vboId[1], points, pointCount*sizeof(rl_Vector2), 0);
+
+        // Anti-aliasing width: one pixel in line units, from current matrices and framebuffer size
+        rl_Matrix matMVP = MatrixMultiply(MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview()), rlGetMatrixProjection());
+        float pixelScale = GetPixelScale(matMVP);
+        float aaWidth = (pixelScale > 0.0f)? 1.0f/pixelScale : 1.0f;
+        float radiusPixels = (0.5f*thick + aaWidth)*pixelScale;
+
+        float params[4] = { 0.5f*thick, aaWidth, 1.0f, LINES_MITER_LIMIT };
+        float lineColor[4] = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+        int capType = (cap == LINE_CAP_ROUND)? LINE_JOIN_ROUND : LINE_FAN_SQUARE;
+        int capInstances = (cap != LINE_CAP_BUTT)? 1 : 0;
+
+        // Draws: first point index for pointA, pointB and pointC, mode, fan type and instances
+        // NOTE: Caps use pointA -> pointB as outwards direction
+        int draws[4][6] = {
+            { 0, 1, 1, 0, 0, pointCount - 1 },                                                          // Segments
+            { 0, 1, 2, 1, join, pointCount - 2 },                                                       // Joins
+            { 1, 0, 0, 2, capType, capInstances },                                                      // Start cap
+            { pointCount - 2, pointCount - 1, pointCount - 1, 2, capType, capInstances }                // End cap
+        };
+
+        rlEnableShader(linesRenderer.shaderId);
+        rlSetUniformMatrix(linesRenderer.locMvp, matMVP);
+        rlSetUniform(linesRenderer.locColor, lineColor, RL_SHADER_UNIFORM_VEC4, 1);
+
+        rlEnableVertexArray(linesRenderer.vaoId);
+        rlEnableVertexBuffer(linesRenderer.vboId[0]);
+        rlSetVertexAttribute(linesRenderer.locTemplate, 2, RL_FLOAT, false, 0, 0);
+        rlEnableVertexAttribute(linesRenderer.locTemplate);
+
+        rlEnableVertexBuffer(linesRenderer.vboId[1]);
+
+        for (int i = 0; i < 4; i++)
+        {
+            if (draws[i][5] <= 0) continue;
+
+            for (int k = 0; k < 3; k++)
+            {
+                rlSetVertexAttribute(linesRenderer.locPoints[k], 2, RL_FLOAT, false, sizeof(rl_Vector2), draws[i][k]*(int)sizeof(rl_Vector2));
+                rlEnableVertexAttribute(linesRenderer.locPoints[k]);
+                rlSetVertexAttributeDivisor(linesRenderer.locPoints[k], 1);
+            }
+
+            int segments = (draws[i][3] == 0)? 0 : GetLineFanSegments(draws[i][4], radiusPixels);
+            float mode[2] = { (float)draws[i][3], (float)draws[i][4] };
+
+            params[2] = (float)segments;
+            rlSetUniform(linesRenderer.locParams, params, RL_SHADER_UNIFORM_VEC4, 1);
+            rlSetUniform(linesRenderer.locMode, mode, RL_SHADER_UNIFORM_VEC2, 1);
+
+            if (draws[i][3] == 0) rlDrawVertexArrayInstanced(0, 6, draws[i][5]);
+            else rlDrawVertexArrayInstanced(6, 3*segments, draws[i][5]);
+        }
+
+        // Without VAO, instance attributes must not be left enabled for render batch drawing
+        if (linesRenderer.vaoId == 0)
+        {
+            for (int k = 0; k < 3; k++)
+            {
+                rlSetVertexAttributeDivisor(linesRenderer.locPoints[k], 0);
+                rlDisableVertexAttribute(linesRenderer.locPoints[k]);
+            }
+        }
+
+        rlDisableVertexArray();
+        rlDisableVertexBuffer();
+        rlDisableShader();
+    }
+#endif
+
+    return drawn;
+}
+
+// Draw line strip triangulated on CPU through the render batch
+// NOTE: Same geometry generated by lines shader, without anti-aliasing fringe
+static void DrawLineStripTriangles(const rl_Vector2 *points, int pointCount, float thick, int join, int cap, rl_Color color)
+{
+    float radius = 0.5f*thick;
+    int capType = (cap == LINE_CAP_ROUND)? LINE_JOIN_ROUND : LINE_FAN_SQUARE;
+    int joinSegments = GetLineFanSegments(join, radius);
+    int capSegments = GetLineFanSegments(capType, radius);
+
+    rlBegin(RL_TRIANGLES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+
+        // Segments bodies
+        for (int i = 0; i < pointCount - 1; i++)
+        {
+            rl_Vector2 d = GetLineDirection(points[i], points[i + 1]);
+            rl_Vector2 n = { -d.y*radius, d.x*radius };
+
+            rlVertex2f(points[i].x - n.x, points[i].y - n.y);
+            rlVertex2f(points[i + 1].x + n.x, points[i + 1].y + n.y);
+            rlVertex2f(points[i + 1].x - n.x, points[i + 1].y - n.y);
+
+            rlVertex2f(points[i].x - n.x, points[i].y - n.y);
+            rlVertex2f(points[i].x + n.x, points[i].y + n.y);
+            rlVertex2f(points[i + 1].x + n.x, points[i + 1].y + n.y);
+        }
+
+        // Joins, outer side offsets ordered clockwise
+        for (int i = 1; i < pointCount - 1; i++)
+        {
+            rl_Vector2 d0 = GetLineDirection(points[i - 1], points[i]);
+            rl_Vector2 d1 = GetLineDirection(points[i], points[i + 1]);
+            rl_Vector2 a = { -d0.y, d0.x };
+            rl_Vector2 b = { -d1.y, d1.x };
+
+            if ((d0.x*d1.y - d0.y*d1.x) > 0.0f)
+            {
+                a = (rl_Vector2){ d1.y, -d1.x };
+                b = (rl_Vector2){ d0.y, -d0.x };
+            }
+
+            // NOTE: On reversal sweep sign is undefined (zero cross product), half turn clockwise is used
+            float dot = a.x*b.x + a.y*b.y;
+            float sweep = (dot <= (-1.0f + EPSILON))? -PI : atan2f(a.x*b.y - a.y*b.x, dot);
+
+            DrawLineFan(points[i], a, b, d1, sweep, join, joinSegments, radius);
+        }
+
+        // Caps, half turn clockwise around outwards direction
+        if (cap != LINE_CAP_BUTT)
+        {
+            rl_Vector2 d = GetLineDirection(points[1], points[0]);
+            DrawLineFan(points[0], (rl_Vector2){ -d.y, d.x }, (rl_Vector2){ d.y, -d.x }, d, -PI, capType, capSegments, radius);
+
+            d = GetLineDirection(points[pointCount - 2], points[pointCount - 1]);
+            DrawLineFan(points[pointCount - 1], (rl_Vector2){ -d.y, d.x }, (rl_Vector2){ d.y, -d.x }, d, -PI, capType, capSegments, radius);
+        }
+    rlEnd();
+}
+
+// Draw line join or cap fan around center, from unit offset a to b
+// NOTE: Requires rlBegin(RL_TRIANGLES) already called
+static void DrawLineFan(rl_Vector2 center, rl_Vector2 a, rl_Vector2 b, rl_Vector2 d, float sweep, int type, int segments, float radius)
+{
+    rl_Vector2 previous = a;
+
+    for (int k = 1; k <= segments; k++)
+    {
+        rl_Vector2 current = GetLineFanOffset(a, b, d, sweep, type, (float)k/segments);
+
+        rlVertex2f(center.x, center.y);
+        rlVertex2f(center.x + previous.x*radius, center.y + previous.y*radius);
+        rlVertex2f(center.x + current.x*radius, center.y + current.y*radius);
+
+        previous = current;
+    }
+}
+
+// Get line unit direction, (1, 0) for zero length lines
+static rl_Vector2 GetLineDirection(rl_Vector2 start, rl_Vector2 end)
+{
+    rl_Vector2 direction = { 1.0f, 0.0f };
+    float dx = end.x - start.x;
+    float dy = end.y - start.y;
+    float length = sqrtf(dx*dx + dy*dy);
+
+    if (length > 0.0f) direction = (rl_Vector2){ dx/length, dy/length };
+
+    return direction;
+}
+
+// Get line fan (join or cap) unit offset at step u [0.0f..1.0f], from a to b
+// NOTE: Same evaluation done by lines shader, d is the square cap direction and sweep the round angle
+static rl_Vector2 GetLineFanOffset(rl_Vector2 a, rl_Vector2 b, rl_Vector2 d, float sweep, int type, float u)
+{
+    rl_Vector2 offset = { a.x + (b.x - a.x)*u, a.y + (b.y - a.y)*u };     // Bevel
+
+    // NOTE: On reversal (b == -a) there is no miter direction, bevel is used
+    if ((type == LINE_JOIN_MITER) && ((a.x*b.x + a.y*b.y) > (-1.0f + EPSILON)))
+    {
+        rl_Vector2 m = GetLineDirection((rl_Vector2){ -a.x, -a.y }, b);
+        float c = m.x*a.x + m.y*a.y;
+
+        if ((c*LINES_MITER_LIMIT) >= 1.0f)
+        {
+            rl_Vector2 tip = { m.x/c, m.y/c };
+
+            if (u < 0.5f) offset = (rl_Vector2){ a.x + (tip.x - a.x)*2.0f*u, a.y + (tip.y - a.y)*2.0f*u };
+            else offset = (rl_Vector2){ tip.x + (b.x - tip.x)*(2.0f*u - 1.0f), tip.y + (b.y - tip.y)*(2.0f*u - 1.0f) };
+        }
+    }
+    else if (type == LINE_JOIN_ROUND)
+    {
+        float cosAngle = cosf(sweep*u);
+        float sinAngle = sinf(sweep*u);
+
+        offset = (rl_Vector2){ a.x*cosAngle - a.y*sinAngle, a.x*sinAngle + a.y*cosAngle };
+    }
+    else if (type == LINE_FAN_SQUARE)
+    {
+        float s = 3.0f*u;
+
+        if (s < 1.0f) offset = (rl_Vector2){ a.x + d.x*s, a.y + d.y*s };
+        else if (s < 2.0f) offset = (rl_Vector2){ a.x + (b.x - a.x)*(s - 1.0f) + d.x, a.y + (b.y - a.y)*(s - 1.0f) + d.y };
+        else offset = (rl_Vector2){ b.x + d.x*(3.0f - s), b.y + d.y*(3.0f - s) };
+    }
+
+    return offset;
+}
+
+// Get line fan segments for a join or cap type, round ones are smooth for the radius (in pixels)
+static int GetLineFanSegments(int type, float radius)
+{
+    int segments = 1;       // Bevel
+
+    if (type == LINE_JOIN_MITER) segments = 2;
+    else if (type == LINE_FAN_SQUARE) segments = 3;
+    else if (type == LINE_JOIN_ROUND)
+    {
+        // NOTE: Joins and caps are half a circle at most
+        segments = (radius > 1.0f)? GetCircleSegments(radius)/2 : 2;
+
+        if (segments < 2) segments = 2;
+        else if (segments > LINES_MAX_FAN_SEGMENTS) segments = LINES_MAX_FAN_SEGMENTS;
+    }
+
+    return segments;
+}
+
+// Get splines flattened points buffer, grown as required
+static rl_Vector2 *GetSplinePoints(int count)
+{
+    if (count > splinePointsCapacity)
+    {
+        rl_Vector2 *points = (rl_Vector2 *)RL_REALLOC(splinePoints, count*sizeof(rl_Vector2));
+
+        if (points != NULL)
+        {
+            splinePoints = points;
+            splinePointsCapacity = count;
+        }
+        else TRACELOG(LOG_WARNING, "SHAPES: Failed to allocate spline points");
+    }
+
+    return (count <= splinePointsCapacity)? splinePoints : NULL;
+}
+
+// Get pixels per unit for a model-view-projection matrix, considering current framebuffer size
+// NOTE: Scale along the x axis, 2d shapes drawing is not expected to be non-uniformly scaled
+static float GetPixelScale(rl_Matrix matMVP)
+{
+    float scaleX = 0.5f*matMVP.m0*rlGetFramebufferWidth();
+    float scaleY = 0.5f*matMVP.m1*rlGetFramebufferHeight();
+
+    return sqrtf(scaleX*scaleX + scaleY*scaleY);
+}
+
+// Get splines flattening tolerance in spline units, 0.0f for fixed divisions
+static float GetSplineTolerance(void)
+{
+    float tolerance = 0.0f;
+
+    if (splineTolerance > 0.0f)
+    {
+        float pixelScale = GetPixelScale(MatrixMultiply(MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview()), rlGetMatrixProjection()));
+
+        tolerance = (pixelScale > 0.0f)? splineTolerance/pixelScale : splineTolerance;
+    }
+
+    return tolerance;
+}
+
+// Flatten spline segments into points, returns points count (output can be NULL to get the count only)
+// NOTE: Every segment is converted to its cubic Bezier control points, divisions required for the tolerance are
+// computed with Wang's formula and points are evaluated on the segment polynomial (Horner's method)
+static int FlattenSpline(int type, const rl_Vector2 *points, int pointCount, float tolerance, rl_Vector2 *output)
+{
+    int order = 2;          // Control points per segment
+    int step = 1;           // Control points step between segments
+
+    switch (type)
+    {
+        case SPLINE_BASIS:
+        case SPLINE_CATMULLROM: order = 4; break;
+        case SPLINE_BEZIER_QUADRATIC: order = 3; step = 2; break;
+        case SPLINE_BEZIER_CUBIC: order = 4; step = 3; break;
+        default: break;
+    }
+
+    int segmentCount = ((points != NULL) && (pointCount >= order))? (pointCount - order)/step + 1 : 0;
+    int count = 0;
+
+    for (int i = 0; i < segmentCount; i++)
+    {
+        const rl_Vector2 *p = &points[i*step];
+        rl_Vector2 b[4] = { 0 };
+
+        switch (type)
+        {
+            case SPLINE_BASIS:
+            {
+                b[0] = (rl_Vector2){ (p[0].x + 4.0f*p[1].x + p[2].x)/6.0f, (p[0].y + 4.0f*p[1].y + p[2].y)/6.0f };
+                b[1] = (rl_Vector2){ (2.0f*p[1].x + p[2].x)/3.0f, (2.0f*p[1].y + p[2].y)/3.0f };
+                b[2] = (rl_Vector2){ (p[1].x + 2.0f*p[2].x)/3.0f, (p[1].y + 2.0f*p[2].y)/3.0f };
+                b[3] = (rl_Vector2){ (p[1].x + 4.0f*p[2].x + p[3].x)/6.0f, (p[1].y + 4.0f*p[2].y + p[3].y)/6.0f };
+            } break;
+            case SPLINE_CATMULLROM:
+            {
+                b[0] = p[1];
+                b[1] = (rl_Vector2){ p[1].x + (p[2].x - p[0].x)/6.0f, p[1].y + (p[2].y - p[0].y)/6.0f };
+                b[2] = (rl_Vector2){ p[2].x - (p[3].x - p[1].x)/6.0f, p[2].y - (p[3].y - p[1].y)/6.0f };
+                b[3] = p[2];
+            } break;
+            case SPLINE_BEZIER_QUADRATIC:
+            {
+                b[0] = p[0];
+                b[1] = (rl_Vector2){ p[0].x + 2.0f*(p[1].x - p[0].x)/3.0f, p[0].y + 2.0f*(p[1].y - p[0].y)/3.0f };
+                b[2] = (rl_Vector2){ p[2].x + 2.0f*(p[1].x - p[2].x)/3.0f, p[2].y + 2.0f*(p[1].y - p[2].y)/3.0f };
+                b[3] = p[2];
+            } break;
+            case SPLINE_BEZIER_CUBIC: b[0] = p[0]; b[1] = p[1]; b[2] = p[2]; b[3] = p[3]; break;
+            default:
+            {
+                b[0] = p[0];
+                b[1] = (rl_Vector2){ p[0].x + (p[1].x - p[0].x)/3.0f, p[0].y + (p[1].y - p[0].y)/3.0f };
+                b[2] = (rl_Vector2){ p[1].x + (p[0].x - p[1].x)/3.0f, p[1].y + (p[0].y - p[1].y)/3.0f };
+                b[3] = p[1];
+            } break;
+        }
+
+        // Segment divisions: Wang's formula for cubic Bezier, n = sqrt(3/4*max|b[i] - 2*b[i + 1] + b[i + 2]|/tolerance)
+        int divisions = 1;
+
+        if (order > 2)
+        {
+            if (tolerance > 0.0f)
+            {
+                float ddx0 = b[0].x - 2.0f*b[1].x + b[2].x, ddy0 = b[0].y - 2.0f*b[1].y + b[2].y;
+                float ddx1 = b[1].x - 2.0f*b[2].x + b[3].x, ddy1 = b[1].y - 2.0f*b[2].y + b[3].y;
+                float dd = sqrtf(fmaxf(ddx0*ddx0 + ddy0*ddy0, ddx1*ddx1 + ddy1*ddy1));
+
+                divisions = (int)ceilf(sqrtf(0.75f*dd/tolerance));
+
+                if (divisions < 1) divisions = 1;
+                else if (divisions > SPLINE_SEGMENT_MAX_DIVISIONS) divisions = SPLINE_SEGMENT_MAX_DIVISIONS;
+            }
+            else divisions = SPLINE_SEGMENT_DIVISIONS;
+        }
+
+        // First segment start point, next segments start at previous segment end point
+        if (count == 0)
+        {
+            if (output != NULL) output[0] = b[0];
+            count = 1;
+        }
+
+        if (output != NULL)
+        {
+            // Segment polynomial: b[0] + t*(c1 + t*(c2 + t*c3))
+            rl_Vector2 c1 = { 3.0f*(b[1].x - b[0].x), 3.0f*(b[1].y - b[0].y) };
+            rl_Vector2 c2 = { 3.0f*(b[2].x - 2.0f*b[1].x + b[0].x), 3.0f*(b[2].y - 2.0f*b[1].y + b[0].y) };
+            rl_Vector2 c3 = { b[3].x - 3.0f*b[2].x + 3.0f*b[1].x - b[0].x, b[3].y - 3.0f*b[2].y + 3.0f*b[1].y - b[0].y };
+            rl_Vector2 *segment = &output[count - 1];
+
+            for (int j = 1; j < divisions; j++)
+            {
+                float t = (float)j/divisions;
+
+                segment[j] = (rl_Vector2){ b[0].x + t*(c1.x + t*(c2.x + t*c3.x)), b[0].y + t*(c1.y + t*(c2.y + t*c3.y)) };
+            }
+
+            segment[divisions] = b[3];
+        }
+
+        count += divisions;
+    }
+
+    return count;
+}
+
+// Draw spline flattened into a line strip, using the shared splines points buffer
+static void DrawSplineFlattened(int type, const rl_Vector2 *points, int pointCount, float thick, int cap, rl_Color color)
+{
+    float tolerance = GetSplineTolerance();
+    int count = FlattenSpline(type, points, pointCount, tolerance, NULL);
+    rl_Vector2 *strip = GetSplinePoints(count);
+
+    if ((count > 0) && (strip != NULL))
+    {
+        FlattenSpline(type, points, pointCount, tolerance, strip);
+        rl_DrawLineStripEx(strip, count, thick, LINE_JOIN_MITER, cap, color);
+    }
+}
+
+// Get number of segments for a smooth full circle of given radius, based on the error rate (usually 0.5f)
+// NOTE: Last radius is cached, shapes are usually drawn many times with the same size
+static int GetCircleSegments(float radius)
+{
+    if ((radius != circleSegmentsRadius) || (circleSegments == 0))
+    {
+        // Calculate the maximum angle between segments based on the error rate
+        float error = 1 - SMOOTH_CIRCLE_ERROR_RATE/radius;
+        float th = acosf(2*error*error - 1);
+
+        circleSegmentsRadius = radius;
+        circleSegments = (int)ceilf(2*PI/th);
+    }
+
+    return circleSegments;
+}
+
+// Get number of segments for a smooth arc, in case provided segments are not enough
+static int GetArcSegments(float radius, float startAngle, float endAngle, int segments)
+{
+    int minSegments = (int)ceilf((endAngle - startAngle)/90);
+
+    if (segments < minSegments)
+    {
+        segments = (int)((endAngle - startAngle)*GetCircleSegments(radius)/360);
+
+        if (segments <= 0) segments = minSegments;
+    }
+
+    return segments;
+}
+
 #endif      // SUPPORT_MODULE_RSHAPES
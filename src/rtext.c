@@ -385,14 +385,14 @@ rl_Font rl_LoadFontEx(const char *fileName, int fontSize, int *codepoints, int c
 
     // Loading file to memory
     int dataSize = 0;
-    unsigned char *fileData = rl_LoadFileData(fileName, &dataSize);
+    unsigned char *fileData = rl_LoadFileDataMapped(fileName, &dataSize);
 
     if (fileData != NULL)
     {
         // Loading font from memory data
         font = rl_LoadFontFromMemory(rl_GetFileExtension(fileName), fileData, dataSize, fontSize, codepoints, codepointCount);
 
-        rl_UnloadFileData(fileData);
+        rl_UnloadFileDataMapped(fileData, dataSize);
     }
     else font = rl_GetFontDefault();
 
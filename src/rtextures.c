@@ -78,6 +78,15 @@
 #include <math.h>               // Required for: fabsf() [Used in rl_DrawTextureRec()]
 #include <stdio.h>              // Required for: sprintf() [Used in rl_ExportImageAsCode()]
 
+// Half-float batch conversion instructions, enabled by compiler target flags (-mf16c, -march=native)
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+    #include <immintrin.h>      // Required for: _mm256_cvtph_ps(), _mm256_cvtps_ph() [Used in HalfToFloatData()/FloatToHalfData()]
+    #define HALF_FLOAT_F16C
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>       // Required for: vcvt_f32_f16(), vcvt_f16_f32() [Used in HalfToFloatData()/FloatToHalfData()]
+    #define HALF_FLOAT_NEON
+#endif
+
 // Support only desired texture formats on stb_image
 #if !defined(SUPPORT_FILEFORMAT_BMP)
     #define STBI_NO_BMP
@@ -207,7 +216,7 @@
 
 #if defined(SUPPORT_IMAGE_GENERATION)
     #define STB_PERLIN_IMPLEMENTATION
-    #include "external/stb_perlin.h"        // Required for: stb_perlin_fbm_noise3
+    #include "external/stb_perlin.h"        // Required for: stb_perlin_fbm_noise3, stb_perlin_noise3_seed, stb_perlin_noise3_wrap_nonpow2
 #endif
 
 #define STBIR_MALLOC(size,c) ((void)(c), RL_MALLOC(size))
@@ -244,15 +253,266 @@
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#define NOISE_PERLIN_MAX_PERIOD           256       // Perlin noise max wrapping period, stb_perlin permutation table size
+
+#ifndef IMAGE_EXPORT_COMPRESSION
+    #define IMAGE_EXPORT_COMPRESSION        8       // Default PNG export compression level: 0 (none), 1-3 (fast), 4-9 (smaller files)
+#endif
+
+#define PNG_FAST_COMPRESSION_LEVEL          3       // PNG export max compression level compressed by bands on loader threads
+#define PNG_FAST_HASH_BITS                 15       // PNG export fast compression matches hash table size, in bits
+
+#ifndef IMAGE_POLYGON_STACK_BUFFER_SIZE
+    #define IMAGE_POLYGON_STACK_BUFFER_SIZE 16384   // Polygon filling stack buffer size in bytes, rows are filled by bands fitting the buffer
+#endif
+#ifndef IMAGE_POLYGON_BAND_ROWS
+    #define IMAGE_POLYGON_BAND_ROWS            16   // Polygon filling rows per band when a row does not fit the stack buffer (buffer allocated)
+#endif
+#ifndef MAX_IMAGE_TEXTURES
+    #define MAX_IMAGE_TEXTURES              8       // Maximum number of image textures with modified regions tracked
+#endif
+#ifndef MAX_IMAGE_DIRTY_RECS
+    #define MAX_IMAGE_DIRTY_RECS           16       // Maximum number of modified regions tracked per image texture
+#endif
+#ifndef MAX_VIRTUAL_TEXTURE_LOADS
+    #define MAX_VIRTUAL_TEXTURE_LOADS      16       // Maximum number of virtual texture tiles loading at the same time (per virtual texture)
+#endif
+
+#define MAX_VIRTUAL_TEXTURE_LEVELS         24       // Maximum number of virtual texture levels
+#define MAX_VIRTUAL_TEXTURE_TILE_SIZE    2048       // Maximum virtual texture tile size (power of two)
+#define VIRTUAL_TEXTURE_FILE_VERSION      100       // Virtual texture tiles file format version
+#define VIRTUAL_TEXTURE_TILE_BORDER         1       // Virtual texture tiles border, in pixels, required for bilinear filtering
+#define VIRTUAL_TEXTURE_HEADER_SIZE        32       // Virtual texture tiles file header size, in bytes
+
+#ifndef MAX_VIDEO_FRAMES
+    #define MAX_VIDEO_FRAMES                4       // Maximum number of video frames decoded ahead (per video)
+#endif
+
+#define VIDEO_FILE_VERSION                100       // Video file format version
+#define VIDEO_HEADER_SIZE                  64       // Video file header size, in bytes
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+#if defined(SUPPORT_FILEFORMAT_GIF)
+// Animated image decoder context (GIF)
+// NOTE: Frames are decoded sequentially on demand, only decoder state is kept in memory,
+// frame following current one is decoded ahead on loader threads (decoder is one frame ahead)
+typedef struct ImageAnimationContext {
+    unsigned char *fileData;    // Compressed file data (internal copy)
+    int dataSize;               // Compressed file data size
+    stbi__context stream;       // stb_image data stream
+    stbi__gif gif;              // stb_image GIF decoder state
+    unsigned char *previous;    // Previous decoded frame
+    unsigned char *twoBack;     // Frame decoded before previous one (required by GIF disposal method 3)
+    int decodedFrame;           // Last decoded frame index (-1 if none)
+    int frameCount;             // Total number of frames, next frame prefetch wraps to first frame
+    int prefetchJobId;          // Next frame prefetch loader job id (-1 if none)
+    bool prefetchSuccess;       // Next frame prefetch decoded successfully
+} ImageAnimationContext;
+#endif
+
+// Image rows band, images generation and transforms are processed by bands on loader threads
+typedef struct ImageRowsBand {
+    void (*process)(void *data, int startY, int endY);  // Rows processing function
+    void *data;                 // Rows processing data
+    int startY;                 // Band first row
+    int endY;                   // Band last row (not included)
+} ImageRowsBand;
+
+// Image affine warp data
+typedef struct ImageWarpData {
+    rl_Image image;             // Source image
+    unsigned char *data;        // Destination pixel data
+    int width;                  // Destination width
+    int height;                 // Destination height
+    float m[6];                 // Inverse transform: source = (m0*x + m1*y + m2, m3*x + m4*y + m5)
+} ImageWarpData;
+
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+// PNG image export data, rows are filtered and compressed by bands on loader threads
+// NOTE: Every band is compressed independently (fixed Huffman codes or stored blocks) and byte aligned
+// with an empty stored block, so compressed bands are concatenated into one zlib stream
+typedef struct ImageExportPNGData {
+    const unsigned char *pixels;    // Image pixels (8bit channels)
+    int width;                      // Image width
+    int height;                     // Image height
+    int channels;                   // Image channels
+    int level;                      // Compression level: 0 (stored blocks) or 1-3 (fixed Huffman codes)
+    unsigned char *filtered;        // Filtered rows, filter type byte + row data per row
+    unsigned char *compressed;      // Compressed bands, every band written at its first row offset
+    size_t rowBound;                // Compressed data size bound per row
+    int *bandSizes;                 // Compressed band size, indexed by band first row (-1 on band allocation failure)
+    int *bandEnds;                  // Band last row (not included), indexed by band first row
+    unsigned short literalCodes[288];   // Fixed Huffman literal/length codes (bit reversed)
+    unsigned char literalLengths[288];  // Fixed Huffman literal/length codes lengths
+    unsigned char lengthSymbols[259];   // Length symbol per match length (0..28)
+    unsigned char distanceSymbols[512]; // Distance symbol per match distance (0..29), indexed by (distance - 1) below 256, then 256 + (distance - 1)/128
+} ImageExportPNGData;
+
+// PNG compressed data bit writer, bits are written starting from least significant bit
+typedef struct PNGBitWriter {
+    unsigned char *data;            // Compressed data
+    int size;                       // Compressed data size written
+    unsigned long long buffer;      // Bits pending to be written
+    int count;                      // Bits pending count
+} PNGBitWriter;
+#endif
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Cellular image generation data
+typedef struct ImageCellularData {
+    rl_Color *pixels;           // Image pixels generated
+    int width;                  // Image width
+    int tileSize;               // Cells tile size
+    int seedsPerRow;            // Seeds per row, one seed per tile
+    int seedsPerCol;            // Seeds per column, one seed per tile
+    rl_Vector2 *seeds;          // Seeds positions
+} ImageCellularData;
+
+// Noise image generation data
+typedef struct ImageNoiseData {
+    rl_Image image;             // Image generated
+    int type;                   // Noise type (NoiseType)
+    float cellsX;               // Noise cells along image width (first octave)
+    float cellsY;               // Noise cells along image height (first octave)
+    int offsetX;                // Noise offset along image width, in pixels
+    int offsetY;                // Noise offset along image height, in pixels
+    int octaves;                // Noise octaves
+    int seed;                   // Noise seed
+    bool tileable;              // Noise wraps at image borders
+} ImageNoiseData;
+#endif
+
+// Image alpha opaque pixels run, used to find image alpha regions
+typedef struct ImageAlphaRun {
+    int startX;                 // Run first pixel
+    int endX;                   // Run last pixel (included)
+    int parent;                 // Run parent, runs connected are joined on a tree
+    int region;                 // Region index (root runs only, -1 if not assigned)
+    int minX, minY;             // Region bounds min (root runs only)
+    int maxX, maxY;             // Region bounds max (root runs only)
+} ImageAlphaRun;
+
+// Image modified region
+typedef struct ImageDirtyRec {
+    int x;                      // Region top-left corner position x
+    int y;                      // Region top-left corner position y
+    int width;                  // Region width
+    int height;                 // Region height
+} ImageDirtyRec;
+
+// Image modified regions tracker, used by image textures
+typedef struct ImageDirtyTracker {
+    void *data;                 // Image pixel data tracked (NULL if tracker not used)
+    unsigned int textureId;     // Texture id updated from image
+    int width;                  // Image width
+    int height;                 // Image height
+    int recCount;               // Modified regions count
+    ImageDirtyRec recs[MAX_IMAGE_DIRTY_RECS];   // Modified regions, coalesced
+    unsigned char *staging;     // Staging buffer, regions pixels are packed before upload
+    int stagingSize;            // Staging buffer size
+} ImageDirtyTracker;
+
+#if defined(SUPPORT_VIDEO_PLAYBACK)
+// Video file format (.rvid)
+//   Header: "rVID" | version | width | height | frameCount | frameRate (x1000) | audioDataSize | audioFileType (8 chars) | reserved (16x 32bit)
+//   Frames index: frame data offset (64bit) and size (64bit) per frame
+//   Audio data: audio file data (any music stream file format supported), frames data: QOI images (RGBA)
+
+// Video frame decoding, run on loader threads
+// NOTE: Frame buffers are allocated on video loading and reused for all frames
+typedef struct VideoFrameDecode {
+    const char *fileName;       // Video file name
+    long long offset;           // Frame data offset in file
+    int dataSize;               // Frame data size
+    unsigned char *data;        // Frame data buffer (QOI), sized for biggest frame
+    unsigned char *pixels;      // Frame pixels decoded (R8G8B8A8)
+    int width;                  // Frame width
+    int height;                 // Frame height
+    int frame;                  // Frame decoding or decoded (-1 if not used)
+    bool ready;                 // Frame decoded and ready for upload
+    bool success;               // Frame decoded successfully
+    int jobId;                  // Loader job id
+} VideoFrameDecode;
+
+// Video playback context
+typedef struct VideoContext {
+    char *fileName;             // Video file name
+    long long *frameIndex;      // Frames data offset and size
+    unsigned char *audioData;   // Audio track file data, required by music stream
+    VideoFrameDecode decodes[MAX_VIDEO_FRAMES];     // Frames decoding
+    int currentFrame;           // Frame uploaded to texture (-1 if none)
+    double time;                // Current playback time (seconds)
+    double lastTime;            // Time of last update (seconds)
+    bool playing;               // Video is playing
+} VideoContext;
+#endif
+
+// Virtual texture tiles file format
+//   Header: "rVTX" | version | width | height | tileSize | border | levels | reserved (8x 32bit)
+//   Tiles data: tiles of every level from level 0 (base size), row by row, tile pixels are (tileSize + 2*border)^2 (R8G8B8A8)
+
+// Virtual texture cache slot, one resident tile
+typedef struct VirtualTextureSlot {
+    int tile;                   // Tile index resident (-1 if slot is free)
+    unsigned int lastUsed;      // Last frame tile was used
+    bool pinned;                // Tile never evicted (coarsest level)
+} VirtualTextureSlot;
+
+// Virtual texture tile load, run on loader threads
+typedef struct VirtualTextureLoad {
+    const char *fileName;       // Tiles file name
+    long long offset;           // Tile data offset in file
+    int dataSize;               // Tile data size
+    unsigned char *data;        // Tile data loaded
+    bool success;               // Tile data loaded successfully
+    int tile;                   // Tile index loading (-1 if load is free)
+    int jobId;                  // Loader job id
+} VirtualTextureLoad;
+
+// Virtual texture tiles streaming context
+// NOTE: Memory used is bounded by cache size and tiles count, source data is only kept in tiles file
+typedef struct VirtualTextureContext {
+    char *fileName;                 // Tiles file name
+    int tileDataSize;               // Tile data size (with border)
+    int tilesX[MAX_VIRTUAL_TEXTURE_LEVELS];     // Tiles per row, per level
+    int tilesY[MAX_VIRTUAL_TEXTURE_LEVELS];     // Tiles per column, per level
+    int firstTile[MAX_VIRTUAL_TEXTURE_LEVELS];  // First tile index, per level
+    int *tileSlots;                 // Cache slot per tile (-1 if not resident, -2 if requested or loading)
+    VirtualTextureSlot *slots;      // Cache slots
+    int slotCount;                  // Cache slots count
+    int slotsPerRow;                // Cache slots per cache texture row
+    int *requests;                  // Tiles requested on current frame, not loading yet
+    int requestCount;               // Tiles requested count
+    VirtualTextureLoad loads[MAX_VIRTUAL_TEXTURE_LOADS];    // Tiles loads
+    unsigned char *indirection;     // Indirection texture pixels
+    bool indirectionDirty;          // Indirection texture requires update
+    unsigned int frame;             // Current frame, used for least recently used tiles eviction
+} VirtualTextureContext;
+
+// Async image loading job
+typedef struct ImageAsyncLoad {
+    char *fileName;             // Image file name (internal copy)
+    rl_Image image;             // Image loaded
+} ImageAsyncLoad;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+// WARNING: Trackers are not thread-safe, they are looked up by image data on every image modification,
+// images can be processed on other threads only while no image texture is loaded, updated or unloaded
+static ImageDirtyTracker imageTrackers[MAX_IMAGE_TEXTURES] = { 0 };   // Image textures modified regions trackers
+static int imageTrackerCount = 0;                                   // Image textures modified regions trackers used
+static int imageExportCompression = IMAGE_EXPORT_COMPRESSION;       // PNG export compression level
+
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+// Deflate length and distance symbols base values and extra bits (RFC 1951, 3.2.5)
+static const unsigned short pngLengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const unsigned char pngLengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const unsigned short pngDistanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+static const unsigned char pngDistanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+#endif
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -264,7 +524,65 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 //----------------------------------------------------------------------------------
 static float HalfToFloat(unsigned short x);
 static unsigned short FloatToHalf(float x);
+static void HalfToFloatData(const unsigned short *values, float *result, int count);  // Convert half-float values to float, batched (F16C/NEON if available)
+static void FloatToHalfData(const float *values, unsigned short *result, int count);  // Convert float values to half-float, batched (F16C/NEON if available)
+static int GetImageFloatFormat(int format);                     // Get 32bit float format equivalent for float and half-float formats (0 for other formats)
+static void GetImagePixelsFloat(rl_Image image, int offset, int count, rl_Vector4 *pixels);        // Get float and half-float image pixels range as rl_Vector4 values
+static void SetImagePixelsFloat(rl_Image *image, int offset, int count, const rl_Vector4 *pixels); // Set float and half-float image pixels range from rl_Vector4 values
 static rl_Vector4 *LoadImageDataNormalized(rl_Image image);       // Load pixel data from image as rl_Vector4 array (float normalized)
+static void LoadImageAsyncJob(void *userData);                  // Load image async job, run on loader threads
+static void ConvertImageColors(rl_Image image, int offset, int count, rl_Color *pixels);    // Convert image pixels range to RGBA 32bit colors
+static bool IsImageFileExtension(const char *fileName, const char *ext); // Check image file extension, case insensitive (thread-safe)
+static void UpdateImageColors(rl_Image *image, rl_Color *pixels);  // Update image with colors view edited, converted back to image format if required
+static const void *GetImageResizeRow(void *buffer, const void *data, int count, int x, int y, void *userData); // Get image row pixels for resizer, converted to RGBA 32bit
+static const unsigned char *GetImageAlphaRow(rl_Image image, int y, unsigned char *buffer, int *stride); // Get image row alpha values (no copy for 8bit alpha formats)
+static int FindImageAlphaRun(ImageAlphaRun *runs, int index);  // Find image alpha run root (region)
+static void ProcessImageRows(void (*process)(void *data, int startY, int endY), void *data, int height); // Process image rows by bands on loader threads
+static void ProcessImageRowsJob(void *userData);                // Process image rows band job, run on loader threads
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static void ImageWarp(rl_Image *image, int width, int height, const float *m);  // Warp image with inverse affine transform, bilinear filtered
+static void ImageWarpRows(void *data, int startY, int endY);    // Warp image rows, 8bit channels (fixed point)
+static void ImageWarpRowsFloat(void *data, int startY, int endY);   // Warp image rows, 32bit float channels
+static void ImageRotateData(const unsigned char *src, unsigned char *dst, int width, int height, int bytesPerPixel, bool clockwise); // Rotate pixel data 90deg, cache blocked
+#endif
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+static unsigned char *ExportImagePNG(const unsigned char *pixels, int width, int height, int channels, int *dataSize); // Export image pixels as PNG file data, using current compression level
+static void ExportImagePNGRows(void *data, int startY, int endY);   // Filter and compress PNG image rows band
+static unsigned int FilterRowPNG(int filter, const unsigned char *row, const unsigned char *prev, int rowSize, int bpp, unsigned char *filtered); // Filter PNG image row, returns filtered row cost
+static void WriteBitsPNG(PNGBitWriter *writer, unsigned int bits, int count);   // Write bits to PNG compressed data
+static int WriteChunkPNG(unsigned char *chunk, const char *type, int dataSize); // Write PNG chunk length, type and CRC around chunk data
+static unsigned int ComputeCRC32PNG(const unsigned char *data, int dataSize);   // Compute PNG chunk CRC-32 (ISO 3309)
+#endif
+#if defined(SUPPORT_IMAGE_GENERATION)
+static void GenImagePerlinNoiseRows(void *data, int startY, int endY);  // Generate perlin noise image rows
+static void GenImageCellularRows(void *data, int startY, int endY);     // Generate cellular image rows
+static void GenImageNoiseRows(void *data, int startY, int endY);        // Generate noise image rows
+static float GetNoiseValue(const ImageNoiseData *noise, float x, float y, float periodX, float periodY); // Get noise value [-1..1] at position (cells units)
+static float GetSimplexNoise(float x, float y, int seed);      // Get simplex noise value [-1..1] at position
+static float GetCellularNoise(float x, float y, int periodX, int periodY, int seed);  // Get cellular noise value [-1..1] at position, periods 0 for no wrapping
+#endif
+static ImageDirtyTracker *GetImageDirtyTracker(const void *data);    // Get image modified regions tracker (NULL if image is not tracked)
+static void SetImageDirtyRec(const rl_Image *image, int x, int y, int width, int height); // Set image region as modified, regions are coalesced
+static void ImageBlendSpan(rl_Image *dst, int x, int y, int count, const unsigned char *coverage, rl_Color color); // Blend color over image pixels span, coverage per pixel (optional)
+static void ImageBlendPixel(rl_Image *dst, int x, int y, rl_Color color);      // Blend color over image pixel, out of bounds pixels are skipped
+static void ImageFillPolygon(rl_Image *dst, const rl_Vector2 *points, int pointCount, rl_Color color);   // Fill polygon within an image, anti-aliased (scanline coverage)
+static void LoadVirtualTextureTileJob(void *userData);          // Load virtual texture tile data, run on loader threads
+static bool SetVirtualTextureTile(rl_VirtualTexture *texture, const VirtualTextureLoad *load, bool pinned); // Set virtual texture tile resident, least recently used tile evicted
+static void RequestVirtualTextureTile(VirtualTextureContext *ctx, int tile);            // Request virtual texture tile, resident tiles are marked as used
+static int GetVirtualTextureLevel(const rl_VirtualTexture *texture, float scale);      // Get virtual texture level for scale (screen pixels per texel)
+static void UpdateVirtualTextureIndirection(rl_VirtualTexture *texture);               // Update virtual texture indirection from resident tiles
+#if defined(SUPPORT_VIDEO_PLAYBACK)
+static void DecodeVideoFrameJob(void *userData);                // Load and decode video frame, run on loader threads
+static bool DecodeVideoFrameQOI(const unsigned char *data, int dataSize, unsigned char *pixels, int width, int height); // Decode QOI frame into pixels buffer (R8G8B8A8)
+static void StartVideoFrameDecode(rl_Video video, VideoFrameDecode *decode, int frame); // Start video frame decoding on loader threads
+#endif
+#if defined(SUPPORT_FILEFORMAT_GIF)
+static int *LoadFrameDelaysGIF(const unsigned char *fileData, int dataSize, int *frameCount);  // Load GIF frames delay without decoding frames
+static void RewindImageAnimation(ImageAnimationContext *ctx);                           // Rewind animated image decoder to first frame
+static bool DecodeNextImageAnimationFrame(ImageAnimationContext *ctx);                  // Decode next animated image frame
+static void PrefetchImageAnimationFrameJob(void *userData);                             // Decode next animated image frame ahead, run on loader threads
+static void WaitImageAnimationPrefetch(rl_ImageAnimation *anim);                        // Wait animated image next frame prefetch, decoder state is available after it
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -288,16 +606,16 @@ rl_Image rl_LoadImage(const char *fileName)
     #define STBI_REQUIRED
 #endif
 
-    // Loading file to memory
+    // Loading file to memory, decoded directly from file mapping
     int dataSize = 0;
-    unsigned char *fileData = rl_LoadFileData(fileName, &dataSize);
+    unsigned char *fileData = rl_LoadFileDataMapped(fileName, &dataSize);
 
     // Loading image from memory data
     if (fileData != NULL)
     {
         image = rl_LoadImageFromMemory(rl_GetFileExtension(fileName), fileData, dataSize);
 
-        rl_UnloadFileData(fileData);
+        rl_UnloadFileDataMapped(fileData, dataSize);
     }
 
     return image;
@@ -418,6 +736,7 @@ rl_Image rl_LoadImageSvg(const char *fileNameOrString, int width, int height)
 //  - Number of frames is returned through 'frames' parameter
 //  - All frames are returned in RGBA format
 //  - Frames delay data is discarded
+// NOTE: All frames are decoded at once, use rl_LoadImageAnimation() to decode frames on demand
 rl_Image rl_LoadImageAnim(const char *fileName, int *frames)
 {
     rl_Image image = { 0 };
@@ -496,6 +815,215 @@ rl_Image LoadImageAnimFromMemory(const char *fileType, const unsigned char *file
     return image;
 }
 
+// Load animated image for streaming frames decoding
+// NOTE: Only the current frame is kept decoded in anim.image (RGBA), use rl_UpdateImageAnimation() to move frames
+rl_ImageAnimation rl_LoadImageAnimation(const char *fileName)
+{
+    rl_ImageAnimation anim = { 0 };
+
+    int dataSize = 0;
+    unsigned char *fileData = rl_LoadFileDataMapped(fileName, &dataSize);
+
+    if (fileData != NULL)
+    {
+        anim = rl_LoadImageAnimationFromMemory(rl_GetFileExtension(fileName), fileData, dataSize);
+
+        rl_UnloadFileDataMapped(fileData, dataSize);
+    }
+
+    return anim;
+}
+
+// Load animated image for streaming from memory buffer, fileType refers to extension: i.e. ".gif"
+// NOTE: Compressed file data is copied internally, frames are decoded from it on demand
+rl_ImageAnimation rl_LoadImageAnimationFromMemory(const char *fileType, const unsigned char *fileData, int dataSize)
+{
+    rl_ImageAnimation anim = { 0 };
+
+    // Security check for input data
+    if ((fileType == NULL) || (fileData == NULL) || (dataSize == 0)) return anim;
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    if ((strcmp(fileType, ".gif") == 0) || (strcmp(fileType, ".GIF") == 0))
+    {
+        int frameCount = 0;
+        int *frameDelays = LoadFrameDelaysGIF(fileData, dataSize, &frameCount);
+
+        if (frameCount > 0)
+        {
+            ImageAnimationContext *ctx = (ImageAnimationContext *)RL_CALLOC(1, sizeof(ImageAnimationContext));
+            if (ctx != NULL) ctx->fileData = (unsigned char *)RL_MALLOC(dataSize);
+
+            if ((ctx == NULL) || (ctx->fileData == NULL))
+            {
+                if (ctx != NULL) RL_FREE(ctx);
+                RL_FREE(frameDelays);
+
+                TRACELOG(LOG_WARNING, "IMAGE: Failed to allocate animated image decoder data");
+                return anim;
+            }
+
+            memcpy(ctx->fileData, fileData, dataSize);
+            ctx->dataSize = dataSize;
+            ctx->frameCount = frameCount;
+            ctx->prefetchJobId = -1;
+
+            RewindImageAnimation(ctx);
+
+            if (DecodeNextImageAnimationFrame(ctx)) anim.image.data = RL_MALLOC(ctx->gif.w*ctx->gif.h*4);
+
+            if (anim.image.data != NULL)
+            {
+                anim.image.width = ctx->gif.w;
+                anim.image.height = ctx->gif.h;
+                anim.image.mipmaps = 1;
+                anim.image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+                memcpy(anim.image.data, ctx->gif.out, anim.image.width*anim.image.height*4);
+
+                anim.frameCount = frameCount;
+                anim.frameDelays = frameDelays;
+                anim.currentFrame = 0;
+                anim.ctxData = ctx;
+
+                // Second frame decoded ahead, ready for playback
+                if (frameCount > 1) ctx->prefetchJobId = AddLoaderJob(PrefetchImageAnimationFrameJob, ctx);
+
+                TRACELOG(LOG_INFO, "IMAGE: Animated image loaded successfully (%ix%i | %i frames)", anim.image.width, anim.image.height, anim.frameCount);
+            }
+            else
+            {
+                RL_FREE(ctx->gif.out);
+                RL_FREE(ctx->gif.background);
+                RL_FREE(ctx->gif.history);
+                RL_FREE(ctx->previous);
+                RL_FREE(ctx->twoBack);
+                RL_FREE(ctx->fileData);
+                RL_FREE(ctx);
+                RL_FREE(frameDelays);
+
+                TRACELOG(LOG_WARNING, "IMAGE: Failed to load animated image first frame");
+            }
+        }
+        else
+        {
+            RL_FREE(frameDelays);
+            TRACELOG(LOG_WARNING, "IMAGE: Animated image data not valid, no frames found");
+        }
+    }
+#else
+    if (false) { }
+#endif
+    else
+    {
+        // Not animated image fileformat, loaded as a single frame animation
+        anim.image = rl_LoadImageFromMemory(fileType, fileData, dataSize);
+
+        if (anim.image.data != NULL)
+        {
+            rl_ImageFormat(&anim.image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+            anim.frameCount = 1;
+            anim.frameDelays = (int *)RL_CALLOC(1, sizeof(int));
+        }
+    }
+
+    return anim;
+}
+
+// Check if an animated image is ready
+bool rl_IsImageAnimationReady(rl_ImageAnimation anim)
+{
+    return (rl_IsImageReady(anim.image) && (anim.frameCount > 0) && (anim.frameDelays != NULL));
+}
+
+// Unload animated image and decoder data
+void rl_UnloadImageAnimation(rl_ImageAnimation anim)
+{
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    ImageAnimationContext *ctx = (ImageAnimationContext *)anim.ctxData;
+
+    if (ctx != NULL)
+    {
+        if (ctx->prefetchJobId >= 0) WaitLoaderJob(ctx->prefetchJobId);
+
+        RL_FREE(ctx->gif.out);
+        RL_FREE(ctx->gif.background);
+        RL_FREE(ctx->gif.history);
+        RL_FREE(ctx->previous);
+        RL_FREE(ctx->twoBack);
+        RL_FREE(ctx->fileData);
+        RL_FREE(ctx);
+    }
+#endif
+
+    RL_FREE(anim.frameDelays);
+    rl_UnloadImage(anim.image);
+}
+
+// Decode animated image frame into anim.image
+// NOTE: Frames are decoded sequentially, seeking backwards requires decoding again from first frame,
+// frame following the requested one is decoded ahead on loader threads (playback does not wait decoding)
+void rl_UpdateImageAnimation(rl_ImageAnimation *anim, int frame)
+{
+    if ((anim == NULL) || (anim->frameCount <= 0)) return;
+
+    frame = frame%anim->frameCount;
+    if (frame < 0) frame += anim->frameCount;
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    ImageAnimationContext *ctx = (ImageAnimationContext *)anim->ctxData;
+
+    if ((ctx != NULL) && (frame != anim->currentFrame))
+    {
+        WaitImageAnimationPrefetch(anim);
+
+        if (frame < ctx->decodedFrame) RewindImageAnimation(ctx);
+
+        while (ctx->decodedFrame < frame)
+        {
+            if (!DecodeNextImageAnimationFrame(ctx))
+            {
+                TRACELOG(LOG_WARNING, "IMAGE: Failed to decode animated image frame %i", ctx->decodedFrame + 1);
+                break;
+            }
+
+            // NOTE: Decoded frame delay is more accurate than the pre-scanned one
+            anim->frameDelays[ctx->decodedFrame] = ctx->gif.delay;
+        }
+
+        if (ctx->decodedFrame >= 0) memcpy(anim->image.data, ctx->gif.out, anim->image.width*anim->image.height*4);
+        anim->currentFrame = ctx->decodedFrame;
+
+        // NOTE: Next frame is decoded on demand if loader queue is full
+        if ((ctx->decodedFrame >= 0) && (anim->frameCount > 1)) ctx->prefetchJobId = AddLoaderJob(PrefetchImageAnimationFrameJob, ctx);
+    }
+#endif
+}
+
+// Get animated image frame index at time (seconds), using frames delay
+// NOTE: Animation loops when time exceeds total frames duration
+int rl_GetImageAnimationFrame(rl_ImageAnimation anim, float time)
+{
+    int frame = 0;
+    int duration = 0;
+
+    for (int i = 0; i < anim.frameCount; i++) duration += anim.frameDelays[i];
+
+    if (duration > 0)
+    {
+        int ms = (int)(time*1000.0f)%duration;
+        if (ms < 0) ms += duration;
+
+        while ((frame < (anim.frameCount - 1)) && (ms >= anim.frameDelays[frame]))
+        {
+            ms -= anim.frameDelays[frame];
+            frame++;
+        }
+    }
+
+    return frame;
+}
+
 // Load image from memory buffer, fileType refers to extension: i.e. ".png"
 // WARNING: File extension must be provided in lower-case
 rl_Image rl_LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize)
@@ -706,6 +1234,58 @@ rl_Image rl_LoadImageFromScreen(void)
     return image;
 }
 
+// Load image from file on loader threads, returns async load id (-1 if loader queue is full)
+// NOTE: File reading and decoding is done on loader threads, textures upload must be done on main thread,
+// image must be retrieved with rl_WaitImageAsync() to release the async load id
+int rl_LoadImageAsync(const char *fileName)
+{
+    if (fileName == NULL) return -1;
+
+    ImageAsyncLoad *load = (ImageAsyncLoad *)RL_CALLOC(1, sizeof(ImageAsyncLoad));
+    if (load == NULL) return -1;
+
+    load->fileName = (char *)RL_CALLOC(strlen(fileName) + 1, 1);
+    if (load->fileName == NULL)
+    {
+        RL_FREE(load);
+        return -1;
+    }
+
+    strcpy(load->fileName, fileName);
+
+    int id = AddLoaderJobAsync(LoadImageAsyncJob, load);
+
+    if (id < 0)
+    {
+        RL_FREE(load->fileName);
+        RL_FREE(load);
+    }
+
+    return id;
+}
+
+// Check if async image loading has finished
+bool rl_IsImageAsyncLoaded(int id)
+{
+    return IsLoaderJobDone(id);
+}
+
+// Wait async image loading to finish and get image, async load id is released
+rl_Image rl_WaitImageAsync(int id)
+{
+    rl_Image image = { 0 };
+    ImageAsyncLoad *load = (ImageAsyncLoad *)WaitLoaderJob(id);
+
+    if (load != NULL)
+    {
+        image = load->image;
+        RL_FREE(load->fileName);
+        RL_FREE(load);
+    }
+
+    return image;
+}
+
 // Check if an image is ready
 bool rl_IsImageReady(rl_Image image)
 {
@@ -727,7 +1307,7 @@ void rl_UnloadImage(rl_Image image)
 }
 
 // Export image data to file
-// NOTE: File format depends on fileName extension
+// NOTE: File format depends on fileName extension, images can be exported from loader threads (i.e. screenshots)
 bool rl_ExportImage(rl_Image image, const char *fileName)
 {
     int result = 0;
@@ -752,28 +1332,28 @@ bool rl_ExportImage(rl_Image image, const char *fileName)
     }
 
 #if defined(SUPPORT_FILEFORMAT_PNG)
-    if (rl_IsFileExtension(fileName, ".png"))
+    if (IsImageFileExtension(fileName, ".png"))
     {
         int dataSize = 0;
-        unsigned char *fileData = stbi_write_png_to_mem((const unsigned char *)imgData, image.width*channels, image.width, image.height, channels, &dataSize);
-        result = rl_SaveFileData(fileName, fileData, dataSize);
+        unsigned char *fileData = ExportImagePNG(imgData, image.width, image.height, channels, &dataSize);
+        if (fileData != NULL) result = rl_SaveFileData(fileName, fileData, dataSize);
         RL_FREE(fileData);
     }
 #else
     if (false) { }
 #endif
 #if defined(SUPPORT_FILEFORMAT_BMP)
-    else if (rl_IsFileExtension(fileName, ".bmp")) result = stbi_write_bmp(fileName, image.width, image.height, channels, imgData);
+    else if (IsImageFileExtension(fileName, ".bmp")) result = stbi_write_bmp(fileName, image.width, image.height, channels, imgData);
 #endif
 #if defined(SUPPORT_FILEFORMAT_TGA)
-    else if (rl_IsFileExtension(fileName, ".tga")) result = stbi_write_tga(fileName, image.width, image.height, channels, imgData);
+    else if (IsImageFileExtension(fileName, ".tga")) result = stbi_write_tga(fileName, image.width, image.height, channels, imgData);
 #endif
 #if defined(SUPPORT_FILEFORMAT_JPG)
-    else if (rl_IsFileExtension(fileName, ".jpg") ||
-             rl_IsFileExtension(fileName, ".jpeg")) result = stbi_write_jpg(fileName, image.width, image.height, channels, imgData, 90);  // JPG quality: between 1 and 100
+    else if (IsImageFileExtension(fileName, ".jpg") ||
+             IsImageFileExtension(fileName, ".jpeg")) result = stbi_write_jpg(fileName, image.width, image.height, channels, imgData, 90);  // JPG quality: between 1 and 100
 #endif
 #if defined(SUPPORT_FILEFORMAT_QOI)
-    else if (rl_IsFileExtension(fileName, ".qoi"))
+    else if (IsImageFileExtension(fileName, ".qoi"))
     {
         channels = 0;
         if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
@@ -793,12 +1373,12 @@ bool rl_ExportImage(rl_Image image, const char *fileName)
     }
 #endif
 #if defined(SUPPORT_FILEFORMAT_KTX)
-    else if (rl_IsFileExtension(fileName, ".ktx"))
+    else if (IsImageFileExtension(fileName, ".ktx"))
     {
         result = rl_save_ktx(fileName, image.data, image.width, image.height, image.format, image.mipmaps);
     }
 #endif
-    else if (rl_IsFileExtension(fileName, ".raw"))
+    else if (IsImageFileExtension(fileName, ".raw"))
     {
         // Export raw pixel data (without header)
         // NOTE: It's up to the user to track image parameters
@@ -825,24 +1405,64 @@ unsigned char *rl_ExportImageToMemory(rl_Image image, const char *fileType, int
 
 #if defined(SUPPORT_IMAGE_EXPORT)
     int channels = 4;
+    bool allocatedData = false;
+    unsigned char *imgData = (unsigned char *)image.data;
 
     if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) channels = 1;
     else if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
     else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
     else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
+    else
+    {
+        // NOTE: Getting rl_Color array as RGBA unsigned char values
+        imgData = (unsigned char *)rl_LoadImageColors(image);
+        allocatedData = true;
+    }
 
 #if defined(SUPPORT_FILEFORMAT_PNG)
     if ((strcmp(fileType, ".png") == 0) || (strcmp(fileType, ".PNG") == 0))
     {
-        fileData = stbi_write_png_to_mem((const unsigned char *)image.data, image.width*channels, image.width, image.height, channels, dataSize);
+        fileData = ExportImagePNG(imgData, image.width, image.height, channels, dataSize);
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOI)
+    if ((strcmp(fileType, ".qoi") == 0) || (strcmp(fileType, ".QOI") == 0))
+    {
+        if ((channels == 3) || (channels == 4))
+        {
+            qoi_desc desc = { 0 };
+            desc.width = image.width;
+            desc.height = image.height;
+            desc.channels = channels;
+            desc.colorspace = QOI_SRGB;
+
+            fileData = (unsigned char *)qoi_encode(imgData, &desc, dataSize);
+        }
+        else TRACELOG(LOG_WARNING, "IMAGE: rl_Image pixel format must be R8G8B8 or R8G8B8A8");
     }
 #endif
 
+    if (allocatedData) RL_FREE(imgData);
 #endif
 
     return fileData;
 }
 
+// Set PNG export compression level: 0 (none), 1-3 (fast, multithreaded), 4-9 (smaller files)
+// NOTE: Levels 0-3 use fixed Huffman codes and filter/compress image rows on loader threads,
+// encoding several times faster than default level for larger files
+void rl_SetImageExportCompression(int level)
+{
+    if (level < 0) level = 0;
+    if (level > 9) level = 9;
+
+    imageExportCompression = level;
+
+#if defined(SUPPORT_IMAGE_EXPORT)
+    if (level > PNG_FAST_COMPRESSION_LEVEL) stbi_write_png_compression_level = level;
+#endif
+}
+
 // Export image as code file (.h) defining an array of bytes
 bool rl_ExportImageAsCode(rl_Image image, const char *fileName)
 {
@@ -900,6 +1520,145 @@ bool rl_ExportImageAsCode(rl_Image image, const char *fileName)
     return success;
 }
 
+// Export image as mipmapped tiles file for virtual texture streaming
+// NOTE: Tiles are written by rows of tiles, levels are generated with a 2x2 box filter until level fits in one tile,
+// level 0 rows are read from image, lower levels are fully kept in memory while next level is generated
+// (up to 1/4 + 1/16 of image pixels), tile size must be a power of two (up to MAX_VIRTUAL_TEXTURE_TILE_SIZE)
+bool rl_ExportImageTiles(rl_Image image, int tileSize, const char *fileName)
+{
+    bool success = false;
+
+    if ((image.data == NULL) || (image.width == 0) || (image.height == 0)) return success;
+
+    if ((tileSize <= 0) || (tileSize > MAX_VIRTUAL_TEXTURE_TILE_SIZE) || ((tileSize & (tileSize - 1)) != 0))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Tiles export requires a power of two tile size (up to %i)", MAX_VIRTUAL_TEXTURE_TILE_SIZE);
+        return success;
+    }
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Tiles export not supported for compressed formats");
+        return success;
+    }
+
+    const int border = VIRTUAL_TEXTURE_TILE_BORDER;
+    const int slotSize = tileSize + 2*border;
+
+    int levels = 1;
+    for (int w = image.width, h = image.height; ((w > tileSize) || (h > tileSize)) && (levels < MAX_VIRTUAL_TEXTURE_LEVELS); levels++)
+    {
+        w = (w + 1)/2;
+        h = (h + 1)/2;
+    }
+
+    int header[8] = { 0 };
+    memcpy(header, "rVTX", 4);
+    header[1] = VIRTUAL_TEXTURE_FILE_VERSION;
+    header[2] = image.width;
+    header[3] = image.height;
+    header[4] = tileSize;
+    header[5] = border;
+    header[6] = levels;
+
+    int tilesX = (image.width + tileSize - 1)/tileSize;
+    rl_Color *tilesRow = (rl_Color *)RL_MALLOC((size_t)tilesX*slotSize*slotSize*sizeof(rl_Color));
+    rl_Color *rowBuffers = (rl_Color *)RL_MALLOC(2*(size_t)image.width*sizeof(rl_Color));
+
+    if ((tilesRow == NULL) || (rowBuffers == NULL)) TRACELOG(LOG_WARNING, "IMAGE: Failed to allocate tiles export data");
+    else success = SaveFileDataRange(fileName, 0, header, sizeof(header));
+
+    long long offset = sizeof(header);
+    rl_Color *level = NULL;         // Current level pixels, level 0 rows are read from image
+    int width = image.width;
+    int height = image.height;
+
+    for (int l = 0; (l < levels) && success; l++)
+    {
+        tilesX = (width + tileSize - 1)/tileSize;
+        int tilesY = (height + tileSize - 1)/tileSize;
+
+        for (int ty = 0; (ty < tilesY) && success; ty++)
+        {
+            for (int py = 0; py < slotSize; py++)
+            {
+                // Border pixels out of level bounds are clamped to edge
+                int y = ty*tileSize + py - border;
+                if (y < 0) y = 0;
+                else if (y >= height) y = height - 1;
+
+                const rl_Color *row = (l == 0)? rl_GetImageColorsRow(image, y, rowBuffers) : level + (size_t)y*width;
+
+                for (int tx = 0; tx < tilesX; tx++)
+                {
+                    rl_Color *pixels = tilesRow + ((size_t)tx*slotSize + py)*slotSize;
+
+                    for (int px = 0; px < slotSize; px++)
+                    {
+                        int x = tx*tileSize + px - border;
+                        if (x < 0) x = 0;
+                        else if (x >= width) x = width - 1;
+
+                        pixels[px] = row[x];
+                    }
+                }
+            }
+
+            // NOTE: Tiles row data size is limited to int, i.e. 127 tiles per row with maximum tile size
+            long long dataSize = (long long)tilesX*slotSize*slotSize*sizeof(rl_Color);
+            success = (dataSize <= 0x7fffffff) && SaveFileDataRange(fileName, offset, tilesRow, (int)dataSize);
+            offset += dataSize;
+        }
+
+        if (success && (l < (levels - 1)))
+        {
+            int nextWidth = (width + 1)/2;
+            int nextHeight = (height + 1)/2;
+            rl_Color *next = (rl_Color *)RL_MALLOC((size_t)nextWidth*nextHeight*sizeof(rl_Color));
+
+            if (next == NULL)
+            {
+                TRACELOG(LOG_WARNING, "IMAGE: Failed to allocate tiles export level data");
+                success = false;
+                break;
+            }
+
+            for (int y = 0; y < nextHeight; y++)
+            {
+                int y1 = (2*y + 1 < height)? 2*y + 1 : 2*y;
+                const rl_Color *row0 = (l == 0)? rl_GetImageColorsRow(image, 2*y, rowBuffers) : level + (size_t)2*y*width;
+                const rl_Color *row1 = (l == 0)? rl_GetImageColorsRow(image, y1, rowBuffers + image.width) : level + (size_t)y1*width;
+
+                for (int x = 0; x < nextWidth; x++)
+                {
+                    int x0 = 2*x;
+                    int x1 = (2*x + 1 < width)? 2*x + 1 : 2*x;
+
+                    next[(size_t)y*nextWidth + x] = (rl_Color){
+                        (unsigned char)((row0[x0].r + row0[x1].r + row1[x0].r + row1[x1].r + 2)/4),
+                        (unsigned char)((row0[x0].g + row0[x1].g + row1[x0].g + row1[x1].g + 2)/4),
+                        (unsigned char)((row0[x0].b + row0[x1].b + row1[x0].b + row1[x1].b + 2)/4),
+                        (unsigned char)((row0[x0].a + row0[x1].a + row1[x0].a + row1[x1].a + 2)/4) };
+                }
+            }
+
+            RL_FREE(level);
+            level = next;
+            width = nextWidth;
+            height = nextHeight;
+        }
+    }
+
+    RL_FREE(level);
+    RL_FREE(rowBuffers);
+    RL_FREE(tilesRow);
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Image tiles exported successfully (%i levels)", fileName, levels);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export image tiles", fileName);
+
+    return success;
+}
+
 //------------------------------------------------------------------------------------
 // rl_Image generation functions
 //------------------------------------------------------------------------------------
@@ -1103,42 +1862,17 @@ rl_Image rl_GenImagePerlinNoise(int width, int height, int offsetX, int offsetY,
 {
     rl_Color *pixels = (rl_Color *)RL_MALLOC(width*height*sizeof(rl_Color));
 
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            float nx = (float)(x + offsetX)*(scale/(float)width);
-            float ny = (float)(y + offsetY)*(scale/(float)height);
+    rl_Image image = {
+        .data = pixels,
+        .width = width,
+        .height = height,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+        .mipmaps = 1
+    };
 
-            // Basic perlin noise implementation (not used)
-            //float p = (stb_perlin_noise3(nx, ny, 0.0f, 0, 0, 0);
+    ImageNoiseData noise = { .image = image, .type = NOISE_PERLIN, .cellsX = scale, .cellsY = scale, .offsetX = offsetX, .offsetY = offsetY, .octaves = 6 };
 
-            // Calculate a better perlin noise using fbm (fractal brownian motion)
-            // Typical values to start playing with:
-            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
-            //   gain       =  0.5   -- relative weighting applied to each successive octave
-            //   octaves    =  6     -- number of "octaves" of noise3() to sum
-            float p = stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6);
-
-            // Clamp between -1.0f and 1.0f
-            if (p < -1.0f) p = -1.0f;
-            if (p > 1.0f) p = 1.0f;
-
-            // We need to normalize the data from [-1..1] to [0..1]
-            float np = (p + 1.0f)/2.0f;
-
-            int intensity = (int)(np*255.0f);
-            pixels[y*width + x] = (rl_Color){ intensity, intensity, intensity, 255 };
-        }
-    }
-
-    rl_Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
+    ProcessImageRows(GenImagePerlinNoiseRows, &noise, height);
 
     return image;
 }
@@ -1161,49 +1895,68 @@ rl_Image rl_GenImageCellular(int width, int height, int tileSize)
         seeds[i] = (rl_Vector2){ (float)x, (float)y };
     }
 
-    for (int y = 0; y < height; y++)
-    {
-        int tileY = y/tileSize;
+    ImageCellularData cellular = { pixels, width, tileSize, seedsPerRow, seedsPerCol, seeds };
 
-        for (int x = 0; x < width; x++)
-        {
-            int tileX = x/tileSize;
+    ProcessImageRows(GenImageCellularRows, &cellular, height);
+
+    RL_FREE(seeds);
 
-            float minDistance = 65536.0f; //(float)strtod("Inf", NULL);
+    rl_Image image = {
+        .data = pixels,
+        .width = width,
+        .height = height,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+        .mipmaps = 1
+    };
 
-            // Check all adjacent tiles
-            for (int i = -1; i < 2; i++)
-            {
-                if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
+    return image;
+}
 
-                for (int j = -1; j < 2; j++)
-                {
-                    if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
+// Generate image: fractal noise (NoiseType), scale is the number of noise cells along image width
+// NOTE: Supported formats are generated directly: PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 and
+// PIXELFORMAT_UNCOMPRESSED_R32 (values in [0..1], useful for heightmaps), other formats are converted from R32.
+// Tileable noise uses an integer number of cells along image width and height, noise wraps every 256 cells,
+// tileable perlin noise is limited to 256 cells and octaves with more than 256 cells are not added
+rl_Image rl_GenImageNoise(int width, int height, int type, float scale, int octaves, int seed, bool tileable, int format)
+{
+    rl_Image image = { 0 };
 
-                    rl_Vector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
+    if ((width <= 0) || (height <= 0) || (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)) return image;
 
-                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
-                    minDistance = (float)fmin(minDistance, dist);
-                }
-            }
+    int genFormat = ((format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))? format : PIXELFORMAT_UNCOMPRESSED_R32;
 
-            // I made this up, but it seems to give good results at all tile sizes
-            int intensity = (int)(minDistance*256.0f/tileSize);
-            if (intensity > 255) intensity = 255;
+    image.data = RL_MALLOC(rl_GetPixelDataSize(width, height, genFormat));
+    image.width = width;
+    image.height = height;
+    image.format = genFormat;
+    image.mipmaps = 1;
 
-            pixels[y*width + x] = (rl_Color){ intensity, intensity, intensity, 255 };
+    ImageNoiseData noise = { 0 };
+    noise.image = image;
+    noise.type = type;
+    noise.cellsX = (scale > 0.0f)? scale : 1.0f;
+    noise.cellsY = noise.cellsX*(float)height/(float)width;
+    noise.octaves = (octaves > 0)? octaves : 1;
+    noise.seed = seed;
+    noise.tileable = tileable;
+
+    if (tileable)
+    {
+        // Integer number of cells required for noise to wrap
+        noise.cellsX = (float)((int)(noise.cellsX + 0.5f) > 0? (int)(noise.cellsX + 0.5f) : 1);
+        noise.cellsY = (float)((int)(noise.cellsY + 0.5f) > 0? (int)(noise.cellsY + 0.5f) : 1);
+
+        // Perlin noise can not wrap on periods above permutation table size
+        if (type == NOISE_PERLIN)
+        {
+            if (noise.cellsX > NOISE_PERLIN_MAX_PERIOD) noise.cellsX = NOISE_PERLIN_MAX_PERIOD;
+            if (noise.cellsY > NOISE_PERLIN_MAX_PERIOD) noise.cellsY = NOISE_PERLIN_MAX_PERIOD;
         }
     }
 
-    RL_FREE(seeds);
+    ProcessImageRows(GenImageNoiseRows, &noise, height);
 
-    rl_Image image = {
-        .data = pixels,
-        .width = width,
-        .height = height,
-        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
-        .mipmaps = 1
-    };
+    if (format != genFormat) rl_ImageFormat(&image, format);
 
     return image;
 }
@@ -1349,7 +2102,29 @@ void rl_ImageFormat(rl_Image *image, int newFormat)
 
     if ((newFormat != 0) && (image->format != newFormat))
     {
-        if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
+        // Float and half-float formats with same channels are converted directly (batched), mipmaps are kept
+        if ((GetImageFloatFormat(image->format) != 0) && (GetImageFloatFormat(image->format) == GetImageFloatFormat(newFormat)))
+        {
+            int count = 0;
+            int mipmaps = (image->mipmaps > 1)? image->mipmaps : 1;
+            for (int i = 0, width = image->width, height = image->height; i < mipmaps; i++)
+            {
+                count += rl_GetPixelDataSize(width, height, GetImageFloatFormat(newFormat))/sizeof(float);
+                if (width > 1) width /= 2;
+                if (height > 1) height /= 2;
+            }
+
+            bool toHalf = (GetImageFloatFormat(newFormat) != newFormat);
+            void *data = RL_MALLOC(count*(toHalf? sizeof(unsigned short) : sizeof(float)));
+
+            if (toHalf) FloatToHalfData((const float *)image->data, (unsigned short *)data, count);
+            else HalfToFloatData((const unsigned short *)image->data, (float *)data, count);
+
+            RL_FREE(image->data);
+            image->data = data;
+            image->format = newFormat;
+        }
+        else if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
         {
             rl_Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
 
@@ -1462,72 +2237,20 @@ void rl_ImageFormat(rl_Image *image, int newFormat)
                     }
                 } break;
                 case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    // WARNING: rl_Image is converted to GRAYSCALE equivalent 32bit
-
-                    image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
-                    }
-                } break;
                 case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                    }
-                } break;
                 case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                        ((float *)image->data)[i + 3] = pixels[k].w;
-                    }
-                } break;
                 case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    // WARNING: rl_Image is converted to GRAYSCALE equivalent 16bit
-
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
-                    }
-                } break;
                 case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned short));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                    }
-                } break;
                 case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
                 {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned short));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                    // WARNING: Single channel formats store GRAYSCALE equivalent
+                    if (GetImageFloatFormat(image->format) == PIXELFORMAT_UNCOMPRESSED_R32)
                     {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                        ((unsigned short *)image->data)[i + 3] = FloatToHalf(pixels[k].w);
+                        for (int i = 0; i < image->width*image->height; i++) pixels[i].x = pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f;
                     }
+
+                    image->data = RL_MALLOC(rl_GetPixelDataSize(image->width, image->height, image->format));
+                    SetImagePixelsFloat(image, 0, image->width*image->height, pixels);     // Half-float converted in batches
                 } break;
                 default: break;
             }
@@ -1636,25 +2359,32 @@ void rl_ImageResizeNN(rl_Image *image,int newWidth,int newHeight)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    rl_Color *pixels = rl_LoadImageColors(*image);
+    // NOTE: Source rows are read as colors views, only one row is converted at a time
+    rl_Color *row = (rl_Color *)RL_MALLOC(image->width*sizeof(rl_Color));
+    const rl_Color *pixels = NULL;
     rl_Color *output = (rl_Color *)RL_MALLOC(newWidth*newHeight*sizeof(rl_Color));
 
     // EDIT: added +1 to account for an early rounding problem
     int xRatio = (int)((image->width << 16)/newWidth) + 1;
     int yRatio = (int)((image->height << 16)/newHeight) + 1;
 
-    int x2, y2;
+    int x2, y2, rowY = -1;
     for (int y = 0; y < newHeight; y++)
     {
+        y2 = ((y*yRatio) >> 16);
+        if (y2 != rowY) pixels = rl_GetImageColorsRow(*image, y2, row);
+        rowY = y2;
+
         for (int x = 0; x < newWidth; x++)
         {
             x2 = ((x*xRatio) >> 16);
-            y2 = ((y*yRatio) >> 16);
 
-            output[(y*newWidth) + x] = pixels[(y2*image->width) + x2] ;
+            output[(y*newWidth) + x] = pixels[x2];
         }
     }
 
+    RL_FREE(row);
+
     int format = image->format;
 
     RL_FREE(image->data);
@@ -1665,8 +2395,6 @@ void rl_ImageResizeNN(rl_Image *image,int newWidth,int newHeight)
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
     rl_ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
-
-    rl_UnloadImageColors(pixels);
 }
 
 // Resize and image to new size
@@ -1702,18 +2430,40 @@ void rl_ImageResize(rl_Image *image, int newWidth, int newHeight)
         image->width = newWidth;
         image->height = newHeight;
     }
+    else if (GetImageFloatFormat(image->format) != 0)
+    {
+        // Float and half-float images are resized with float channels, half-float converted in batches
+        int format = image->format;
+        int floatFormat = GetImageFloatFormat(format);
+        int channels = rl_GetPixelDataSize(1, 1, floatFormat)/sizeof(float);
+
+        if (floatFormat != format) rl_ImageFormat(image, floatFormat);
+
+        float *output = (float *)RL_MALLOC(newWidth*newHeight*channels*sizeof(float));
+        stbir_resize_float_linear((float *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)channels);
+
+        RL_FREE(image->data);
+        image->data = output;
+        image->width = newWidth;
+        image->height = newHeight;
+        image->mipmaps = 1;
+
+        if (floatFormat != format) rl_ImageFormat(image, format);
+    }
     else
     {
-        // Get data as rl_Color pixels array to work with it
-        rl_Color *pixels = rl_LoadImageColors(*image);
         rl_Color *output = (rl_Color *)RL_MALLOC(newWidth*newHeight*sizeof(rl_Color));
 
-        // NOTE: rl_Color data is cast to (unsigned char *), there shouldn't been any problem...
-        stbir_resize_uint8_linear((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, (stbir_pixel_layout)4);
+        // NOTE: Source rows are converted to rl_Color pixels on demand by resizer input callback,
+        // rl_Color data is cast to (unsigned char *), there shouldn't been any problem...
+        STBIR_RESIZE resize = { 0 };
+        stbir_resize_init(&resize, image->data, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, (stbir_pixel_layout)4, STBIR_TYPE_UINT8);
+        stbir_set_pixel_callbacks(&resize, GetImageResizeRow, NULL);
+        stbir_set_user_data(&resize, image);
+        stbir_resize_extended(&resize);
 
         int format = image->format;
 
-        rl_UnloadImageColors(pixels);
         RL_FREE(image->data);
 
         image->data = output;
@@ -1923,6 +2673,8 @@ void rl_ImageAlphaClear(rl_Image *image, rl_Color color, float threshold)
             } break;
             default: break;
         }
+
+        SetImageDirtyRec(image, 0, 0, image->width, image->height);
     }
 }
 
@@ -1971,6 +2723,8 @@ void rl_ImageAlphaMask(rl_Image *image, rl_Image alphaMask)
             {
                 ((unsigned char *)image->data)[k] = ((unsigned char *)mask.data)[i];
             }
+
+            SetImageDirtyRec(image, 0, 0, image->width, image->height);
         }
 
         rl_UnloadImage(mask);
@@ -1984,7 +2738,7 @@ void rl_ImageAlphaPremultiply(rl_Image *image)
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
     float alpha = 0.0f;
-    rl_Color *pixels = rl_LoadImageColors(*image);
+    rl_Color *pixels = rl_LoadImageColorsView(*image);
 
     for (int i = 0; i < image->width*image->height; i++)
     {
@@ -2003,13 +2757,7 @@ void rl_ImageAlphaPremultiply(rl_Image *image)
         }
     }
 
-    RL_FREE(image->data);
-
-    int format = image->format;
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    rl_ImageFormat(image, format);
+    UpdateImageColors(image, pixels);
 }
 
 // Apply box blur to image
@@ -2018,20 +2766,39 @@ void rl_ImageBlurGaussian(rl_Image *image, int blurSize)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    rl_ImageAlphaPremultiply(image);
-
-    rl_Color *pixels = rl_LoadImageColors(*image);
+    // Float and half-float images are blurred with float channels (no precision lost)
+    bool floatChannels = (GetImageFloatFormat(image->format) != 0);
+    rl_Color *pixels = NULL;
 
     // Loop switches between pixelsCopy1 and pixelsCopy2
-    rl_Vector4 *pixelsCopy1 = RL_MALLOC((image->height)*(image->width)*sizeof(rl_Vector4));
+    rl_Vector4 *pixelsCopy1 = NULL;
     rl_Vector4 *pixelsCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(rl_Vector4));
 
-    for (int i = 0; i < (image->height*image->width); i++)
+    if (floatChannels)
+    {
+        pixelsCopy1 = LoadImageDataNormalized(*image);
+
+        for (int i = 0; i < (image->height*image->width); i++)
+        {
+            pixelsCopy1[i].x *= pixelsCopy1[i].w;
+            pixelsCopy1[i].y *= pixelsCopy1[i].w;
+            pixelsCopy1[i].z *= pixelsCopy1[i].w;
+        }
+    }
+    else
     {
-        pixelsCopy1[i].x = pixels[i].r;
-        pixelsCopy1[i].y = pixels[i].g;
-        pixelsCopy1[i].z = pixels[i].b;
-        pixelsCopy1[i].w = pixels[i].a;
+        rl_ImageAlphaPremultiply(image);
+
+        pixels = rl_LoadImageColorsView(*image);
+        pixelsCopy1 = RL_MALLOC((image->height)*(image->width)*sizeof(rl_Vector4));
+
+        for (int i = 0; i < (image->height*image->width); i++)
+        {
+            pixelsCopy1[i].x = pixels[i].r;
+            pixelsCopy1[i].y = pixels[i].g;
+            pixelsCopy1[i].z = pixels[i].b;
+            pixelsCopy1[i].w = pixels[i].a;
+        }
     }
 
     // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
@@ -2117,12 +2884,44 @@ void rl_ImageBlurGaussian(rl_Image *image, int blurSize)
                     convolutionSize++;
                 }
 
-                pixelsCopy1[y*image->width + col].x = (unsigned char) (avgR/convolutionSize);
-                pixelsCopy1[y*image->width + col].y = (unsigned char) (avgG/convolutionSize);
-                pixelsCopy1[y*image->width + col].z = (unsigned char) (avgB/convolutionSize);
-                pixelsCopy1[y*image->width + col].w = (unsigned char) (avgAlpha/convolutionSize);
+                if (floatChannels)
+                {
+                    pixelsCopy1[y*image->width + col].x = avgR/convolutionSize;
+                    pixelsCopy1[y*image->width + col].y = avgG/convolutionSize;
+                    pixelsCopy1[y*image->width + col].z = avgB/convolutionSize;
+                    pixelsCopy1[y*image->width + col].w = avgAlpha/convolutionSize;
+                }
+                else
+                {
+                    pixelsCopy1[y*image->width + col].x = (unsigned char) (avgR/convolutionSize);
+                    pixelsCopy1[y*image->width + col].y = (unsigned char) (avgG/convolutionSize);
+                    pixelsCopy1[y*image->width + col].z = (unsigned char) (avgB/convolutionSize);
+                    pixelsCopy1[y*image->width + col].w = (unsigned char) (avgAlpha/convolutionSize);
+                }
+            }
+        }
+    }
+
+    if (floatChannels)
+    {
+        // Reverse premultiply, float channels
+        for (int i = 0; i < (image->width)*(image->height); i++)
+        {
+            if (pixelsCopy1[i].w == 0.0f) pixelsCopy1[i] = (rl_Vector4){ 0 };
+            else
+            {
+                pixelsCopy1[i].x /= pixelsCopy1[i].w;
+                pixelsCopy1[i].y /= pixelsCopy1[i].w;
+                pixelsCopy1[i].z /= pixelsCopy1[i].w;
             }
         }
+
+        SetImagePixelsFloat(image, 0, image->width*image->height, pixelsCopy1);
+        SetImageDirtyRec(image, 0, 0, image->width, image->height);
+
+        RL_FREE(pixelsCopy1);
+        RL_FREE(pixelsCopy2);
+        return;
     }
 
     // Reverse premultiply
@@ -2145,15 +2944,10 @@ void rl_ImageBlurGaussian(rl_Image *image, int blurSize)
         }
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
     RL_FREE(pixelsCopy1);
     RL_FREE(pixelsCopy2);
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    rl_ImageFormat(image, format);
+    UpdateImageColors(image, pixels);
 }
 
 // The kernel matrix is assumed to be square. Only supply the width of the kernel
@@ -2169,7 +2963,7 @@ void ImageKernelConvolution(rl_Image *image, float* kernel, int kernelSize)
         return;
     }
 
-    rl_Color *pixels = rl_LoadImageColors(*image);
+    rl_Color *pixels = rl_LoadImageColorsView(*image);
 
     rl_Vector4 *imageCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(rl_Vector4));
     rl_Vector4 *temp = RL_MALLOC(kernelSize*sizeof(rl_Vector4));
@@ -2275,14 +3069,10 @@ void ImageKernelConvolution(rl_Image *image, float* kernel, int kernelSize)
         pixels[i].a = (unsigned char)((alpha)*255.0f);
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
     RL_FREE(imageCopy2);
     RL_FREE(temp);
 
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-    rl_ImageFormat(image, format);
+    UpdateImageColors(image, pixels);
 }
 
 // Generate all mipmap levels for a provided image
@@ -2330,13 +3120,24 @@ void rl_ImageMipmaps(rl_Image *image)
         mipSize = rl_GetPixelDataSize(mipWidth, mipHeight, image->format);
         rl_Image imCopy = rl_ImageCopy(*image);
 
+        // Half-float levels are generated from float channels, converted back in batches
+        int floatFormat = GetImageFloatFormat(image->format);
+        bool halfChannels = ((floatFormat != 0) && (floatFormat != image->format));
+
+        if (halfChannels)
+        {
+            imCopy.mipmaps = 1;
+            rl_ImageFormat(&imCopy, floatFormat);
+        }
+
         for (int i = 1; i < mipCount; i++)
         {
             TRACELOGD("IMAGE: Generating mipmap level: %i (%i x %i) - size: %i - offset: 0x%x", i, mipWidth, mipHeight, mipSize, nextmip);
 
             rl_ImageResize(&imCopy, mipWidth, mipHeight);  // Uses internally Mitchell cubic downscale filter
 
-            memcpy(nextmip, imCopy.data, mipSize);
+            if (halfChannels) FloatToHalfData((const float *)imCopy.data, (unsigned short *)nextmip, mipSize/sizeof(unsigned short));
+            else memcpy(nextmip, imCopy.data, mipSize);
             nextmip += mipSize;
             image->mipmaps++;
 
@@ -2375,9 +3176,10 @@ void rl_ImageDither(rl_Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
     }
     else
     {
-        rl_Color *pixels = rl_LoadImageColors(*image);
+        // NOTE: RGBA 32bit image data is dithered in place and freed at the end
+        rl_Color *pixels = rl_LoadImageColorsView(*image);
 
-        RL_FREE(image->data);      // free old image data
+        if ((void *)pixels != image->data) RL_FREE(image->data);      // free old image data
 
         if ((image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
         {
@@ -2477,17 +3279,23 @@ void rl_ImageFlipVertical(rl_Image *image)
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "rl_Image manipulation not supported for compressed formats");
     else
     {
-        int bytesPerPixel = rl_GetPixelDataSize(1, 1, image->format);
-        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
+        // NOTE: Rows are swapped in place, only one row is allocated
+        int rowSize = image->width*rl_GetPixelDataSize(1, 1, image->format);
+        unsigned char *row = (unsigned char *)RL_MALLOC(rowSize);
 
-        for (int i = (image->height - 1), offsetSize = 0; i >= 0; i--)
+        for (int y = 0; y < image->height/2; y++)
         {
-            memcpy(flippedData + offsetSize, ((unsigned char *)image->data) + i*image->width*bytesPerPixel, image->width*bytesPerPixel);
-            offsetSize += image->width*bytesPerPixel;
+            unsigned char *top = (unsigned char *)image->data + (size_t)y*rowSize;
+            unsigned char *bottom = (unsigned char *)image->data + (size_t)(image->height - 1 - y)*rowSize;
+
+            memcpy(row, top, rowSize);
+            memcpy(top, bottom, rowSize);
+            memcpy(bottom, row, rowSize);
         }
 
-        RL_FREE(image->data);
-        image->data = flippedData;
+        RL_FREE(row);
+
+        SetImageDirtyRec(image, 0, 0, image->width, image->height);
     }
 }
 
@@ -2501,38 +3309,58 @@ void rl_ImageFlipHorizontal(rl_Image *image)
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "rl_Image manipulation not supported for compressed formats");
     else
     {
+        // NOTE: Pixels are swapped in place, common pixel sizes are swapped as integers
         int bytesPerPixel = rl_GetPixelDataSize(1, 1, image->format);
-        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
 
         for (int y = 0; y < image->height; y++)
         {
-            for (int x = 0; x < image->width; x++)
-            {
-                // OPTION 1: Move pixels with memcpy()
-                //memcpy(flippedData + (y*image->width + x)*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - 1 - x))*bytesPerPixel, bytesPerPixel);
-
-                // OPTION 2: Just copy data pixel by pixel
-                for (int i = 0; i < bytesPerPixel; i++) flippedData[(y*image->width + x)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - 1 - x))*bytesPerPixel + i];
-            }
-        }
+            unsigned char *row = (unsigned char *)image->data + (size_t)y*image->width*bytesPerPixel;
 
-        RL_FREE(image->data);
-        image->data = flippedData;
-
-        /*
-        // OPTION 3: Faster implementation (specific for 32bit pixels)
-        // NOTE: It does not require additional allocations
-        uint32_t *ptr = (uint32_t *)image->data;
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width/2; x++)
+            switch (bytesPerPixel)
             {
-                uint32_t backup = ptr[y*image->width + x];
-                ptr[y*image->width + x] = ptr[y*image->width + (image->width - 1 - x)];
-                ptr[y*image->width + (image->width - 1 - x)] = backup;
+                case 1:
+                {
+                    for (int left = 0, right = image->width - 1; left < right; left++, right--)
+                    {
+                        unsigned char backup = row[left];
+                        row[left] = row[right];
+                        row[right] = backup;
+                    }
+                } break;
+                case 2:
+                {
+                    unsigned short *pixels = (unsigned short *)row;
+                    for (int left = 0, right = image->width - 1; left < right; left++, right--)
+                    {
+                        unsigned short backup = pixels[left];
+                        pixels[left] = pixels[right];
+                        pixels[right] = backup;
+                    }
+                } break;
+                case 4:
+                {
+                    unsigned int *pixels = (unsigned int *)row;
+                    for (int left = 0, right = image->width - 1; left < right; left++, right--)
+                    {
+                        unsigned int backup = pixels[left];
+                        pixels[left] = pixels[right];
+                        pixels[right] = backup;
+                    }
+                } break;
+                default:
+                {
+                    unsigned char backup[16] = { 0 };
+                    for (int left = 0, right = image->width - 1; left < right; left++, right--)
+                    {
+                        memcpy(backup, row + left*bytesPerPixel, bytesPerPixel);
+                        memcpy(row + left*bytesPerPixel, row + right*bytesPerPixel, bytesPerPixel);
+                        memcpy(row + right*bytesPerPixel, backup, bytesPerPixel);
+                    }
+                } break;
             }
         }
-        */
+
+        SetImageDirtyRec(image, 0, 0, image->width, image->height);
     }
 }
 
@@ -2553,45 +3381,47 @@ void rl_ImageRotate(rl_Image *image, int degrees)
         int width = (int)(fabsf(image->width*cosRadius) + fabsf(image->height*sinRadius));
         int height = (int)(fabsf(image->height*cosRadius) + fabsf(image->width*sinRadius));
 
-        int bytesPerPixel = rl_GetPixelDataSize(1, 1, image->format);
-        unsigned char *rotatedData = (unsigned char *)RL_CALLOC(width*height, bytesPerPixel);
-
-        for (int y = 0; y < height; y++)
-        {
-            for (int x = 0; x < width; x++)
-            {
-                float oldX = ((x - width/2.0f)*cosRadius + (y - height/2.0f)*sinRadius) + image->width/2.0f;
-                float oldY = ((y - height/2.0f)*cosRadius - (x - width/2.0f)*sinRadius) + image->height/2.0f;
-
-                if ((oldX >= 0) && (oldX < image->width) && (oldY >= 0) && (oldY < image->height))
-                {
-                    int x1 = (int)floorf(oldX);
-                    int y1 = (int)floorf(oldY);
-                    int x2 = MIN(x1 + 1, image->width - 1);
-                    int y2 = MIN(y1 + 1, image->height - 1);
+        // Inverse mapping around images centers:
+        // oldX = (x - width/2)*cos + (y - height/2)*sin + image->width/2
+        // oldY = (y - height/2)*cos - (x - width/2)*sin + image->height/2
+        float m[6] = {
+            cosRadius, sinRadius, -width/2.0f*cosRadius - height/2.0f*sinRadius + image->width/2.0f,
+            -sinRadius, cosRadius, width/2.0f*sinRadius - height/2.0f*cosRadius + image->height/2.0f
+        };
 
-                    float px = oldX - x1;
-                    float py = oldY - y1;
+        ImageWarp(image, width, height, m);
+    }
+}
 
-                    for (int i = 0; i < bytesPerPixel; i++)
-                    {
-                        float f1 = ((unsigned char *)image->data)[(y1*image->width + x1)*bytesPerPixel + i];
-                        float f2 = ((unsigned char *)image->data)[(y1*image->width + x2)*bytesPerPixel + i];
-                        float f3 = ((unsigned char *)image->data)[(y2*image->width + x1)*bytesPerPixel + i];
-                        float f4 = ((unsigned char *)image->data)[(y2*image->width + x2)*bytesPerPixel + i];
+// Apply affine transform to image (rotation, scale, shear, translation), bilinear filtered
+// NOTE: Transform maps source pixels to destination image of size newWidth x newHeight,
+// only 2d part of the matrix is used: x' = m0*x + m4*y + m12, y' = m1*x + m5*y + m13
+void rl_ImageTransform(rl_Image *image, int newWidth, int newHeight, rl_Matrix transform)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || (newWidth <= 0) || (newHeight <= 0)) return;
 
-                        float val = f1*(1 - px)*(1 - py) + f2*px*(1 - py) + f3*(1 - px)*py + f4*px*py;
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "rl_Image manipulation only applied to base mipmap level");
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "rl_Image manipulation not supported for compressed formats");
+    else
+    {
+        float det = transform.m0*transform.m5 - transform.m4*transform.m1;
 
-                        rotatedData[(y*width + x)*bytesPerPixel + i] = (unsigned char)val;
-                    }
-                }
-            }
+        if (fabsf(det) < 1e-8f)
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Failed to transform image, transform is not invertible");
+            return;
         }
 
-        RL_FREE(image->data);
-        image->data = rotatedData;
-        image->width = width;
-        image->height = height;
+        // Inverse transform, maps destination pixels to source pixels
+        float m[6] = {
+            transform.m5/det, -transform.m4/det, 0.0f,
+            -transform.m1/det, transform.m0/det, 0.0f
+        };
+        m[2] = -(m[0]*transform.m12 + m[1]*transform.m13);
+        m[5] = -(m[3]*transform.m12 + m[4]*transform.m13);
+
+        ImageWarp(image, newWidth, newHeight, m);
     }
 }
 
@@ -2608,14 +3438,7 @@ void rl_ImageRotateCW(rl_Image *image)
         int bytesPerPixel = rl_GetPixelDataSize(1, 1, image->format);
         unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
 
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                //memcpy(rotatedData + (x*image->height + (image->height - y - 1))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + x)*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + (image->height - y - 1))*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + x)*bytesPerPixel + i];
-            }
-        }
+        ImageRotateData((unsigned char *)image->data, rotatedData, image->width, image->height, bytesPerPixel, true);
 
         RL_FREE(image->data);
         image->data = rotatedData;
@@ -2640,14 +3463,7 @@ void rl_ImageRotateCCW(rl_Image *image)
         int bytesPerPixel = rl_GetPixelDataSize(1, 1, image->format);
         unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
 
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                //memcpy(rotatedData + (x*image->height + y))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - x - 1))*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + y)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - x - 1))*bytesPerPixel + i];
-            }
-        }
+        ImageRotateData((unsigned char *)image->data, rotatedData, image->width, image->height, bytesPerPixel, false);
 
         RL_FREE(image->data);
         image->data = rotatedData;
@@ -2665,7 +3481,7 @@ void ImageColorTint(rl_Image *image, rl_Color color)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    rl_Color *pixels = rl_LoadImageColors(*image);
+    rl_Color *pixels = rl_LoadImageColorsView(*image);
 
     for (int i = 0; i < image->width*image->height; i++)
     {
@@ -2680,13 +3496,7 @@ void ImageColorTint(rl_Image *image, rl_Color color)
         pixels[i].a = a;
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    rl_ImageFormat(image, format);
+    UpdateImageColors(image, pixels);
 }
 
 // Modify image color: invert
@@ -2695,7 +3505,7 @@ void rl_ImageColorInvert(rl_Image *image)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    rl_Color *pixels = rl_LoadImageColors(*image);
+    rl_Color *pixels = rl_LoadImageColorsView(*image);
 
     for (int i = 0; i < image->width*image->height; i++)
     {
@@ -2704,13 +3514,7 @@ void rl_ImageColorInvert(rl_Image *image)
         pixels[i].b = 255 - pixels[i].b;
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    rl_ImageFormat(image, format);
+    UpdateImageColors(image, pixels);
 }
 
 // Modify image color: grayscale
@@ -2732,7 +3536,7 @@ void rl_ImageColorContrast(rl_Image *image, float contrast)
     contrast = (100.0f + contrast)/100.0f;
     contrast *= contrast;
 
-    rl_Color *pixels = rl_LoadImageColors(*image);
+    rl_Color *pixels = rl_LoadImageColorsView(*image);
 
     for (int i = 0; i < image->width*image->height; i++)
     {
@@ -2765,13 +3569,7 @@ void rl_ImageColorContrast(rl_Image *image, float contrast)
         pixels[i].b = (unsigned char)pB;
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    rl_ImageFormat(image, format);
+    UpdateImageColors(image, pixels);
 }
 
 // Modify image color: brightness
@@ -2784,7 +3582,7 @@ void rl_ImageColorBrightness(rl_Image *image, int brightness)
     if (brightness < -255) brightness = -255;
     if (brightness > 255) brightness = 255;
 
-    rl_Color *pixels = rl_LoadImageColors(*image);
+    rl_Color *pixels = rl_LoadImageColorsView(*image);
 
     for (int i = 0; i < image->width*image->height; i++)
     {
@@ -2806,13 +3604,7 @@ void rl_ImageColorBrightness(rl_Image *image, int brightness)
         pixels[i].b = (unsigned char)cB;
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    rl_ImageFormat(image, format);
+    UpdateImageColors(image, pixels);
 }
 
 // Modify image color: replace color
@@ -2821,7 +3613,7 @@ void rl_ImageColorReplace(rl_Image *image, rl_Color color, rl_Color replace)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    rl_Color *pixels = rl_LoadImageColors(*image);
+    rl_Color *pixels = rl_LoadImageColorsView(*image);
 
     for (int i = 0; i < image->width*image->height; i++)
     {
@@ -2837,13 +3629,7 @@ void rl_ImageColorReplace(rl_Image *image, rl_Color color, rl_Color replace)
         }
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    rl_ImageFormat(image, format);
+    UpdateImageColors(image, pixels);
 }
 #endif      // SUPPORT_IMAGE_MANIPULATION
 
@@ -2866,133 +3652,40 @@ rl_Color *rl_LoadImageColors(rl_Image image)
             (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) ||
             (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 16bit to 8bit per channel");
 
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
-        {
-            switch (image.format)
-            {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[i];
-                    pixels[i].g = ((unsigned char *)image.data)[i];
-                    pixels[i].b = ((unsigned char *)image.data)[i];
-                    pixels[i].a = 255;
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k];
-                    pixels[i].b = ((unsigned char *)image.data)[k];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
-
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
-                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
-                    pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
-                    pixels[i].a = 255;
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
-                    pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = ((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 3];
-
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
-                    pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = 255;
+        ConvertImageColors(image, 0, image.width*image.height, pixels);
+    }
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
+    return pixels;
+}
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = 255;
+// Load color data view from image as a rl_Color array (RGBA - 32bit)
+// NOTE: RGBA 32bit image data is returned directly (no copy), other formats are converted,
+// view should be unloaded using rl_UnloadImageColorsView() and it is not valid once image is modified
+rl_Color *rl_LoadImageColorsView(rl_Image image)
+{
+    if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) return (rl_Color *)image.data;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].a = (unsigned char)(((float *)image.data)[k]*255.0f);
+    return rl_LoadImageColors(image);
+}
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
+// Unload color data view loaded with rl_LoadImageColorsView()
+void rl_UnloadImageColorsView(rl_Image image, rl_Color *colors)
+{
+    if ((void *)colors != image.data) RL_FREE(colors);
+}
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
-                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
-                    pixels[i].a = 255;
+// Get image row colors (RGBA - 32bit)
+// NOTE: RGBA 32bit image row is returned directly (no copy), other formats row is converted
+// into provided buffer (image width size), compressed formats return NULL
+const rl_Color *rl_GetImageColorsRow(rl_Image image, int y, rl_Color *buffer)
+{
+    if ((image.data == NULL) || (y < 0) || (y >= image.height) || (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)) return NULL;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].a = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
+    if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) return (const rl_Color *)image.data + (size_t)y*image.width;
 
-                    k += 4;
-                } break;
-                default: break;
-            }
-        }
-    }
+    ConvertImageColors(image, y*image.width, image.width, buffer);
 
-    return pixels;
+    return buffer;
 }
 
 // Load colors palette from image as a rl_Color array (RGBA - 32bit)
@@ -3003,49 +3696,56 @@ rl_Color *rl_LoadImagePalette(rl_Image image, int maxPaletteSize, int *colorCoun
 
     int palCount = 0;
     rl_Color *palette = NULL;
-    rl_Color *pixels = rl_LoadImageColors(image);
 
-    if (pixels != NULL)
+    // NOTE: Image is read row by row, converted into a row buffer if not RGBA 32bit
+    rl_Color *rowBuffer = (rl_Color *)RL_MALLOC(image.width*sizeof(rl_Color));
+
+    if ((rowBuffer != NULL) && (rl_GetImageColorsRow(image, 0, rowBuffer) != NULL))
     {
         palette = (rl_Color *)RL_MALLOC(maxPaletteSize*sizeof(rl_Color));
 
         for (int i = 0; i < maxPaletteSize; i++) palette[i] = rl_BLANK;   // Set all colors to rl_BLANK
 
-        for (int i = 0; i < image.width*image.height; i++)
+        for (int y = 0; (y < image.height) && (palCount < maxPaletteSize); y++)
         {
-            if (pixels[i].a > 0)
-            {
-                bool colorInPalette = false;
+            const rl_Color *pixels = rl_GetImageColorsRow(image, y, rowBuffer);
 
-                // Check if the color is already on palette
-                for (int j = 0; j < maxPaletteSize; j++)
+            for (int x = 0; x < image.width; x++)
+            {
+                if (pixels[x].a > 0)
                 {
-                    if (COLOR_EQUAL(pixels[i], palette[j]))
+                    bool colorInPalette = false;
+
+                    // Check if the color is already on palette
+                    for (int j = 0; j < maxPaletteSize; j++)
                     {
-                        colorInPalette = true;
-                        break;
+                        if (COLOR_EQUAL(pixels[x], palette[j]))
+                        {
+                            colorInPalette = true;
+                            break;
+                        }
                     }
-                }
-
-                // Store color if not on the palette
-                if (!colorInPalette)
-                {
-                    palette[palCount] = pixels[i];      // Add pixels[i] to palette
-                    palCount++;
 
-                    // We reached the limit of colors supported by palette
-                    if (palCount >= maxPaletteSize)
+                    // Store color if not on the palette
+                    if (!colorInPalette)
                     {
-                        i = image.width*image.height;   // Finish palette get
-                        TRACELOG(LOG_WARNING, "IMAGE: Palette is greater than %i colors", maxPaletteSize);
+                        palette[palCount] = pixels[x];      // Add pixels[x] to palette
+                        palCount++;
+
+                        // We reached the limit of colors supported by palette
+                        if (palCount >= maxPaletteSize)
+                        {
+                            TRACELOG(LOG_WARNING, "IMAGE: Palette is greater than %i colors", maxPaletteSize);
+                            break;      // Finish palette get
+                        }
                     }
                 }
             }
         }
-
-        rl_UnloadImageColors(pixels);
     }
 
+    RL_FREE(rowBuffer);
+
     *colorCount = palCount;
 
     return palette;
@@ -3065,45 +3765,218 @@ void rl_UnloadImagePalette(rl_Color *colors)
 
 // Get image alpha border rectangle
 // NOTE: Threshold is defined as a percentage: 0.0f -> 1.0f
+// Pixel data is scanned in place from image borders, scan stops at first opaque pixel found
 rl_Rectangle rl_GetImageAlphaBorder(rl_Image image, float threshold)
 {
     rl_Rectangle crop = { 0 };
 
-    rl_Color *pixels = rl_LoadImageColors(image);
+    if ((image.data == NULL) || (image.width == 0) || (image.height == 0) || (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)) return crop;
+
+    unsigned char thresholdValue = (unsigned char)(threshold*255.0f);
+    unsigned char *buffer = (unsigned char *)RL_MALLOC(image.width);
+    int stride = 0;
 
-    if (pixels != NULL)
+    // Find first and last rows with opaque pixels
+    int yMin = -1;
+    int yMax = -1;
+    int xMin = image.width;
+    int xMax = -1;
+
+    for (int y = 0; (y < image.height) && (yMin < 0); y++)
     {
-        int xMin = 65536;   // Define a big enough number
-        int xMax = 0;
-        int yMin = 65536;
-        int yMax = 0;
+        const unsigned char *alpha = GetImageAlphaRow(image, y, buffer, &stride);
 
-        for (int y = 0; y < image.height; y++)
+        for (int x = 0; x < image.width; x++)
         {
-            for (int x = 0; x < image.width; x++)
+            if (alpha[x*stride] > thresholdValue)
             {
-                if (pixels[y*image.width + x].a > (unsigned char)(threshold*255.0f))
-                {
-                    if (x < xMin) xMin = x;
-                    if (x > xMax) xMax = x;
-                    if (y < yMin) yMin = y;
-                    if (y > yMax) yMax = y;
-                }
+                yMin = y;
+                break;
+            }
+        }
+    }
+
+    for (int y = image.height - 1; (y >= yMin) && (yMin >= 0) && (yMax < 0); y--)
+    {
+        const unsigned char *alpha = GetImageAlphaRow(image, y, buffer, &stride);
+
+        for (int x = 0; x < image.width; x++)
+        {
+            if (alpha[x*stride] > thresholdValue)
+            {
+                yMax = y;
+                break;
             }
         }
+    }
+
+    // Find left and right borders, only pixels out of current borders are checked
+    for (int y = yMin; (y <= yMax) && (yMin >= 0); y++)
+    {
+        const unsigned char *alpha = GetImageAlphaRow(image, y, buffer, &stride);
 
-        // Check for empty blank image
-        if ((xMin != 65536) && (xMax != 65536))
+        for (int x = 0; x < xMin; x++)
         {
-            crop = (rl_Rectangle){ (float)xMin, (float)yMin, (float)((xMax + 1) - xMin), (float)((yMax + 1) - yMin) };
+            if (alpha[x*stride] > thresholdValue)
+            {
+                xMin = x;
+                break;
+            }
         }
 
-        rl_UnloadImageColors(pixels);
+        for (int x = image.width - 1; x > xMax; x--)
+        {
+            if (alpha[x*stride] > thresholdValue)
+            {
+                xMax = x;
+                break;
+            }
+        }
     }
 
+    RL_FREE(buffer);
+
+    // Check for empty blank image
+    if (yMin >= 0) crop = (rl_Rectangle){ (float)xMin, (float)yMin, (float)((xMax + 1) - xMin), (float)((yMax + 1) - yMin) };
+
     return crop;
 }
 
+// Get image opaque pixels count per row and per column
+// NOTE: rowCoverage must hold image.height values and columnCoverage image.width values, any of them can be NULL
+void rl_GetImageAlphaCoverage(rl_Image image, float threshold, int *rowCoverage, int *columnCoverage)
+{
+    if ((image.data == NULL) || (image.width == 0) || (image.height == 0) || (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)) return;
+
+    unsigned char thresholdValue = (unsigned char)(threshold*255.0f);
+    unsigned char *buffer = (unsigned char *)RL_MALLOC(image.width);
+    int stride = 0;
+
+    if (columnCoverage != NULL) memset(columnCoverage, 0, image.width*sizeof(int));
+
+    for (int y = 0; y < image.height; y++)
+    {
+        const unsigned char *alpha = GetImageAlphaRow(image, y, buffer, &stride);
+        int count = 0;
+
+        for (int x = 0; x < image.width; x++)
+        {
+            int opaque = (alpha[x*stride] > thresholdValue);
+
+            count += opaque;
+            if (columnCoverage != NULL) columnCoverage[x] += opaque;
+        }
+
+        if (rowCoverage != NULL) rowCoverage[y] = count;
+    }
+
+    RL_FREE(buffer);
+}
+
+// Load image alpha regions, bounding rectangles of disjoint groups of opaque pixels
+// NOTE 1: Opaque pixels are grouped when touching, including diagonals (8-connectivity)
+// NOTE 2: Regions are sorted by first pixel found, scanning rows top to bottom
+// NOTE 3: Memory allocated should be freed using rl_UnloadImageAlphaRegions()
+rl_Rectangle *rl_LoadImageAlphaRegions(rl_Image image, float threshold, int *regionCount)
+{
+    rl_Rectangle *regions = NULL;
+    *regionCount = 0;
+
+    if ((image.data == NULL) || (image.width == 0) || (image.height == 0) || (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)) return regions;
+
+    unsigned char thresholdValue = (unsigned char)(threshold*255.0f);
+    unsigned char *buffer = (unsigned char *)RL_MALLOC(image.width);
+    int stride = 0;
+
+    // Opaque pixels are processed as horizontal runs, runs touching runs
+    // on previous row are joined into the same region
+    int runCapacity = 256;
+    int runCount = 0;
+    ImageAlphaRun *runs = (ImageAlphaRun *)RL_MALLOC(runCapacity*sizeof(ImageAlphaRun));
+    int prevStart = 0;
+    int prevEnd = 0;
+
+    for (int y = 0; y < image.height; y++)
+    {
+        const unsigned char *alpha = GetImageAlphaRow(image, y, buffer, &stride);
+        int rowStart = runCount;
+        int prev = prevStart;
+
+        for (int x = 0; x < image.width; x++)
+        {
+            if (alpha[x*stride] <= thresholdValue) continue;
+
+            int startX = x;
+            while ((x < image.width) && (alpha[x*stride] > thresholdValue)) x++;
+            int endX = x - 1;
+
+            if (runCount == runCapacity)
+            {
+                runCapacity *= 2;
+                runs = (ImageAlphaRun *)RL_REALLOC(runs, runCapacity*sizeof(ImageAlphaRun));
+            }
+
+            runs[runCount] = (ImageAlphaRun){ startX, endX, runCount, -1, startX, y, endX, y };
+
+            // Join previous row runs touching this run
+            while ((prev < prevEnd) && (runs[prev].endX + 1 < startX)) prev++;
+
+            for (int i = prev; (i < prevEnd) && (runs[i].startX <= endX + 1); i++)
+            {
+                int root = FindImageAlphaRun(runs, runCount);
+                int other = FindImageAlphaRun(runs, i);
+
+                if (root != other)
+                {
+                    runs[other].parent = root;
+                    if (runs[other].minX < runs[root].minX) runs[root].minX = runs[other].minX;
+                    if (runs[other].minY < runs[root].minY) runs[root].minY = runs[other].minY;
+                    if (runs[other].maxX > runs[root].maxX) runs[root].maxX = runs[other].maxX;
+                    if (runs[other].maxY > runs[root].maxY) runs[root].maxY = runs[other].maxY;
+                }
+            }
+
+            runCount++;
+        }
+
+        prevStart = rowStart;
+        prevEnd = runCount;
+    }
+
+    RL_FREE(buffer);
+
+    // Assign regions in runs order
+    int count = 0;
+    for (int i = 0; i < runCount; i++)
+    {
+        int root = FindImageAlphaRun(runs, i);
+        if (runs[root].region < 0) runs[root].region = count++;
+    }
+
+    if (count > 0)
+    {
+        regions = (rl_Rectangle *)RL_MALLOC(count*sizeof(rl_Rectangle));
+
+        for (int i = 0; i < runCount; i++)
+        {
+            if (runs[i].parent == i) regions[runs[i].region] = (rl_Rectangle){ (float)runs[i].minX, (float)runs[i].minY,
+                (float)(runs[i].maxX + 1 - runs[i].minX), (float)(runs[i].maxY + 1 - runs[i].minY) };
+        }
+    }
+
+    RL_FREE(runs);
+
+    *regionCount = count;
+
+    return regions;
+}
+
+// Unload alpha regions loaded with rl_LoadImageAlphaRegions()
+void rl_UnloadImageAlphaRegions(rl_Rectangle *regions)
+{
+    RL_FREE(regions);
+}
+
 // Get image pixel color at (x, y) position
 rl_Color rl_GetImageColor(rl_Image image, int x, int y)
 {
@@ -3194,9 +4067,9 @@ rl_Color rl_GetImageColor(rl_Image image, int x, int y)
             case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
             {
                 color.r = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
-                color.g = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
-                color.b = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
-                color.a = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
+                color.g = (unsigned char)(((float *)image.data)[(y*image.width + x)*4 + 1]*255.0f);
+                color.b = (unsigned char)(((float *)image.data)[(y*image.width + x)*4 + 2]*255.0f);
+                color.a = (unsigned char)(((float *)image.data)[(y*image.width + x)*4 + 3]*255.0f);
 
             } break;
             case PIXELFORMAT_UNCOMPRESSED_R16:
@@ -3218,9 +4091,9 @@ rl_Color rl_GetImageColor(rl_Image image, int x, int y)
             case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
             {
                 color.r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
-                color.g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
-                color.b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
-                color.a = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
+                color.g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4 + 1])*255.0f);
+                color.b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4 + 2])*255.0f);
+                color.a = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4 + 3])*255.0f);
 
             } break;
             default: TRACELOG(LOG_WARNING, "Compressed image format does not support color reading"); break;
@@ -3240,6 +4113,8 @@ void rl_ImageClearBackground(rl_Image *dst, rl_Color color)
     // Security check to avoid program crash
     if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
 
+    SetImageDirtyRec(dst, 0, 0, dst->width, dst->height);
+
     // Fill in first pixel based on image format
     rl_ImageDrawPixel(dst, 0, 0, color);
 
@@ -3260,6 +4135,8 @@ void rl_ImageDrawPixel(rl_Image *dst, int x, int y, rl_Color color)
     // Security check to avoid program crash
     if ((dst->data == NULL) || (x < 0) || (x >= dst->width) || (y < 0) || (y >= dst->height)) return;
 
+    if (imageTrackerCount > 0) SetImageDirtyRec(dst, x, y, 1, 1);
+
     switch (dst->format)
     {
         case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
@@ -3444,7 +4321,7 @@ void rl_ImageDrawLine(rl_Image *dst, int startPosX, int startPosY, int endPosX,
 
         stepV = (changeInY < 0)? -1 : 1;
 
-        rl_ImageDrawPixel(dst, startU, startV, color);     // At this point they are correctly ordered...
+        ImageBlendPixel(dst, startU, startV, color);     // At this point they are correctly ordered...
     }
     else
     {
@@ -3473,7 +4350,7 @@ void rl_ImageDrawLine(rl_Image *dst, int startPosX, int startPosY, int endPosX,
 
         stepV = (changeInX < 0)? -1 : 1;
 
-        rl_ImageDrawPixel(dst, startV, startU, color);     // ... but need to be reversed here. Repeated in the main loop below
+        ImageBlendPixel(dst, startV, startU, color);     // ... but need to be reversed here. Repeated in the main loop below
     }
 
     // We already drew the start point. If we started at startU + 0, the line would be crooked and too short
@@ -3486,8 +4363,8 @@ void rl_ImageDrawLine(rl_Image *dst, int startPosX, int startPosY, int endPosX,
         }
         else P += A;        // Remembers how far we are from the direct line
 
-        if (reversedXY) rl_ImageDrawPixel(dst, u, v, color);
-        else rl_ImageDrawPixel(dst, v, u, color);
+        if (reversedXY) ImageBlendPixel(dst, u, v, color);
+        else ImageBlendPixel(dst, v, u, color);
     }
 }
 
@@ -3500,16 +4377,19 @@ void rl_ImageDrawLineV(rl_Image *dst, rl_Vector2 start, rl_Vector2 end, rl_Color
 // Draw circle within an image
 void rl_ImageDrawCircle(rl_Image* dst, int centerX, int centerY, int radius, rl_Color color)
 {
+    if (radius < 0) return;
+
+    // Compute every row span half-width first, so every pixel is blended only once
+    int *halfWidths = (int *)RL_CALLOC(radius + 1, sizeof(int));
+
     int x = 0;
     int y = radius;
     int decesionParameter = 3 - 2*radius;
 
     while (y >= x)
     {
-        rl_ImageDrawRectangle(dst, centerX - x, centerY + y, x*2, 1, color);
-        rl_ImageDrawRectangle(dst, centerX - x, centerY - y, x*2, 1, color);
-        rl_ImageDrawRectangle(dst, centerX - y, centerY + x, y*2, 1, color);
-        rl_ImageDrawRectangle(dst, centerX - y, centerY - x, y*2, 1, color);
+        if (halfWidths[y] < x) halfWidths[y] = x;
+        if (halfWidths[x] < y) halfWidths[x] = y;
         x++;
 
         if (decesionParameter > 0)
@@ -3519,6 +4399,16 @@ void rl_ImageDrawCircle(rl_Image* dst, int centerX, int centerY, int radius, rl_
         }
         else decesionParameter = decesionParameter + 4*x + 6;
     }
+
+    rl_ImageDrawRectangle(dst, centerX - halfWidths[0], centerY, halfWidths[0]*2, 1, color);
+
+    for (int i = 1; i <= radius; i++)
+    {
+        rl_ImageDrawRectangle(dst, centerX - halfWidths[i], centerY + i, halfWidths[i]*2, 1, color);
+        rl_ImageDrawRectangle(dst, centerX - halfWidths[i], centerY - i, halfWidths[i]*2, 1, color);
+    }
+
+    RL_FREE(halfWidths);
 }
 
 // Draw circle within an image (Vector version)
@@ -3536,14 +4426,25 @@ void rl_ImageDrawCircleLines(rl_Image *dst, int centerX, int centerY, int radius
 
     while (y >= x)
     {
-        rl_ImageDrawPixel(dst, centerX + x, centerY + y, color);
-        rl_ImageDrawPixel(dst, centerX - x, centerY + y, color);
-        rl_ImageDrawPixel(dst, centerX + x, centerY - y, color);
-        rl_ImageDrawPixel(dst, centerX - x, centerY - y, color);
-        rl_ImageDrawPixel(dst, centerX + y, centerY + x, color);
-        rl_ImageDrawPixel(dst, centerX - y, centerY + x, color);
-        rl_ImageDrawPixel(dst, centerX + y, centerY - x, color);
-        rl_ImageDrawPixel(dst, centerX - y, centerY - x, color);
+        // NOTE: Octants points overlapping (x == 0, x == y) are only blended once
+        ImageBlendPixel(dst, centerX + x, centerY + y, color);
+        ImageBlendPixel(dst, centerX + x, centerY - y, color);
+        if (x != 0)
+        {
+            ImageBlendPixel(dst, centerX - x, centerY + y, color);
+            ImageBlendPixel(dst, centerX - x, centerY - y, color);
+        }
+
+        if (x != y)
+        {
+            ImageBlendPixel(dst, centerX + y, centerY + x, color);
+            ImageBlendPixel(dst, centerX - y, centerY + x, color);
+            if (x != 0)
+            {
+                ImageBlendPixel(dst, centerX + y, centerY - x, color);
+                ImageBlendPixel(dst, centerX - y, centerY - x, color);
+            }
+        }
         x++;
 
         if (decesionParameter > 0)
@@ -3574,6 +4475,7 @@ void rl_ImageDrawRectangleV(rl_Image *dst, rl_Vector2 position, rl_Vector2 size,
 }
 
 // Draw rectangle within an image
+// NOTE: Translucent colors are alpha blended over image pixels
 void rl_ImageDrawRectangleRec(rl_Image *dst, rl_Rectangle rec, rl_Color color)
 {
     // Security check to avoid program crash
@@ -3595,26 +4497,27 @@ void rl_ImageDrawRectangleRec(rl_Image *dst, rl_Rectangle rec, rl_Color color)
 
     int sy = (int)rec.y;
     int sx = (int)rec.x;
+    int width = (int)rec.width;
+    int height = (int)rec.height;
 
-    int bytesPerPixel = rl_GetPixelDataSize(1, 1, dst->format);
+    if ((width <= 0) || (height <= 0)) return;
 
-    // Fill in the first pixel of the first row based on image format
-    rl_ImageDrawPixel(dst, sx, sy, color);
+    if (color.a == 255)
+    {
+        // Opaque color: fill first row, repeat the first row data for all other rows
+        SetImageDirtyRec(dst, sx, sy, width, height);
+        ImageBlendSpan(dst, sx, sy, width, NULL, color);
 
-    int bytesOffset = ((sy*dst->width) + sx)*bytesPerPixel;
-    unsigned char *pSrcPixel = (unsigned char *)dst->data + bytesOffset;
+        int bytesPerPixel = rl_GetPixelDataSize(1, 1, dst->format);
+        int bytesPerRow = bytesPerPixel*width;
+        unsigned char *pSrcPixel = (unsigned char *)dst->data + ((sy*dst->width) + sx)*bytesPerPixel;
 
-    // Repeat the first pixel data throughout the row
-    for (int x = 1; x < (int)rec.width; x++)
-    {
-        memcpy(pSrcPixel + x*bytesPerPixel, pSrcPixel, bytesPerPixel);
+        for (int y = 1; y < height; y++) memcpy(pSrcPixel + (y*dst->width)*bytesPerPixel, pSrcPixel, bytesPerRow);
     }
-
-    // Repeat the first row data for all other rows
-    int bytesPerRow = bytesPerPixel*(int)rec.width;
-    for (int y = 1; y < (int)rec.height; y++)
+    else
     {
-        memcpy(pSrcPixel + (y*dst->width)*bytesPerPixel, pSrcPixel, bytesPerRow);
+        // Translucent color: every row is blended with destination
+        for (int y = 0; y < height; y++) ImageBlendSpan(dst, sx, sy + y, width, NULL, color);
     }
 }
 
@@ -3627,6 +4530,77 @@ void rl_ImageDrawRectangleLines(rl_Image *dst, rl_Rectangle rec, int thick, rl_C
     rl_ImageDrawRectangle(dst, (int)rec.x, (int)(rec.y + rec.height - thick), (int)rec.width, thick, color);
 }
 
+// Draw line within an image with thickness, anti-aliased
+void rl_ImageDrawLineEx(rl_Image *dst, rl_Vector2 start, rl_Vector2 end, float thick, rl_Color color)
+{
+    float dx = end.x - start.x;
+    float dy = end.y - start.y;
+    float length = sqrtf(dx*dx + dy*dy);
+
+    if ((length <= 0.0f) || (thick <= 0.0f)) return;
+
+    // Line quad, offset half thickness along line normal
+    float nx = -dy/length*thick*0.5f;
+    float ny = dx/length*thick*0.5f;
+
+    rl_Vector2 quad[4] = {
+        { start.x + nx, start.y + ny },
+        { end.x + nx, end.y + ny },
+        { end.x - nx, end.y - ny },
+        { start.x - nx, start.y - ny }
+    };
+
+    ImageFillPolygon(dst, quad, 4, color);
+}
+
+// Draw circle within an image, anti-aliased (sub-pixel center and radius)
+void rl_ImageDrawCircleEx(rl_Image *dst, rl_Vector2 center, float radius, rl_Color color)
+{
+    if (radius <= 0.0f) return;
+
+    #define IMAGE_CIRCLE_MAX_SEGMENTS   8192    // Max circle segments, error is above 1/8 pixel only for huge circles
+
+    // Segments required to keep max error below 1/8 pixel
+    // NOTE: Segments are clamped before conversion, for huge radius acosf() returns 0.0f
+    float maxError = (radius > 0.125f)? 0.125f/radius : 1.0f;
+    float segmentAngle = acosf(1.0f - maxError);
+    float segmentsCount = (segmentAngle > 0.0f)? ceilf(PI/segmentAngle) : (float)IMAGE_CIRCLE_MAX_SEGMENTS;
+    int segments = (segmentsCount < (float)IMAGE_CIRCLE_MAX_SEGMENTS)? (int)segmentsCount : IMAGE_CIRCLE_MAX_SEGMENTS;
+    if (segments < 8) segments = 8;
+
+    // Polygon radius scaled to keep circle area
+    float step = 2.0f*PI/(float)segments;
+    float polyRadius = radius*sqrtf(step/sinf(step));
+
+    rl_Vector2 *points = (rl_Vector2 *)RL_MALLOC(segments*sizeof(rl_Vector2));
+    if (points == NULL) return;
+
+    for (int i = 0; i < segments; i++)
+    {
+        float angle = step*(float)i;
+        points[i] = (rl_Vector2){ center.x + cosf(angle)*polyRadius, center.y + sinf(angle)*polyRadius };
+    }
+
+    ImageFillPolygon(dst, points, segments, color);
+
+    RL_FREE(points);
+}
+
+// Draw triangle within an image, anti-aliased
+void rl_ImageDrawTriangle(rl_Image *dst, rl_Vector2 v1, rl_Vector2 v2, rl_Vector2 v3, rl_Color color)
+{
+    rl_Vector2 points[3] = { v1, v2, v3 };
+
+    ImageFillPolygon(dst, points, 3, color);
+}
+
+// Draw polygon within an image, anti-aliased
+// NOTE: Polygon can be convex or concave, self-intersecting areas are filled using non-zero rule
+void rl_ImageDrawPolygon(rl_Image *dst, const rl_Vector2 *points, int pointCount, rl_Color color)
+{
+    ImageFillPolygon(dst, points, pointCount, color);
+}
+
 // Draw an image (source) within an image (destination)
 // NOTE: rl_Color tint is applied to source image
 void rl_ImageDraw(rl_Image *dst, rl_Image src, rl_Rectangle srcRec, rl_Rectangle dstRec, rl_Color tint)
@@ -3691,9 +4665,66 @@ void rl_ImageDraw(rl_Image *dst, rl_Image src, rl_Rectangle srcRec, rl_Rectangle
         //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
         //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
         //    [-] rl_GetPixelColor(): Get rl_Vector4 instead of rl_Color, easier for rl_ColorAlphaBlend()
-        //    [ ] Support f32bit channels drawing
+        //    [x] Support f32bit channels drawing (float and half-float destination formats)
+
+        if (GetImageFloatFormat(dst->format) != 0)
+        {
+            // Float channels path: rows are blended in float, no 8-bit quantization of destination
+            int width = (int)srcRec.width;
+            bool srcFloat = (GetImageFloatFormat(srcPtr->format) != 0);
+            int bytesPerPixelSrc = rl_GetPixelDataSize(srcPtr->width, 1, srcPtr->format)/srcPtr->width;
+            rl_Vector4 colTint = { tint.r/255.0f, tint.g/255.0f, tint.b/255.0f, tint.a/255.0f };
+
+            rl_Vector4 *rowSrc = (rl_Vector4 *)RL_MALLOC(width*2*sizeof(rl_Vector4));
+            rl_Vector4 *rowDst = rowSrc + width;
+
+            if (width > 0) SetImageDirtyRec(dst, (int)dstRec.x, (int)dstRec.y, width, (int)srcRec.height);
+
+            for (int y = 0; (y < (int)srcRec.height) && (width > 0); y++)
+            {
+                int offsetSrc = ((int)srcRec.y + y)*srcPtr->width + (int)srcRec.x;
+                int offsetDst = ((int)dstRec.y + y)*dst->width + (int)dstRec.x;
+
+                if (srcFloat) GetImagePixelsFloat(*srcPtr, offsetSrc, width, rowSrc);
+                else
+                {
+                    unsigned char *pSrc = (unsigned char *)srcPtr->data + offsetSrc*bytesPerPixelSrc;
+
+                    for (int x = 0; x < width; x++, pSrc += bytesPerPixelSrc)
+                    {
+                        rl_Color col = rl_GetPixelColor(pSrc, srcPtr->format);
+                        rowSrc[x] = (rl_Vector4){ col.r/255.0f, col.g/255.0f, col.b/255.0f, col.a/255.0f };
+                    }
+                }
+
+                GetImagePixelsFloat(*dst, offsetDst, width, rowDst);
+
+                for (int x = 0; x < width; x++)
+                {
+                    rl_Vector4 s = { rowSrc[x].x*colTint.x, rowSrc[x].y*colTint.y, rowSrc[x].z*colTint.z, rowSrc[x].w*colTint.w };
+                    rl_Vector4 d = rowDst[x];
+
+                    if (s.w <= 0.0f) continue;
+                    else if (s.w >= 1.0f) rowDst[x] = s;
+                    else
+                    {
+                        float alpha = s.w + d.w*(1.0f - s.w);
 
-        // TODO: Support PIXELFORMAT_UNCOMPRESSED_R32, PIXELFORMAT_UNCOMPRESSED_R32G32B32, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 and 16-bit equivalents
+                        rowDst[x].x = (s.x*s.w + d.x*d.w*(1.0f - s.w))/alpha;
+                        rowDst[x].y = (s.y*s.w + d.y*d.w*(1.0f - s.w))/alpha;
+                        rowDst[x].z = (s.z*s.w + d.z*d.w*(1.0f - s.w))/alpha;
+                        rowDst[x].w = alpha;
+                    }
+                }
+
+                SetImagePixelsFloat(dst, offsetDst, width, rowDst);
+            }
+
+            RL_FREE(rowSrc);
+
+            if (useSrcMod) rl_UnloadImage(srcMod);     // Unload source modified image
+            return;
+        }
 
         rl_Color colSrc, colDst, blend;
         bool blendRequired = true;
@@ -3710,6 +4741,8 @@ void rl_ImageDraw(rl_Image *dst, rl_Image src, rl_Rectangle srcRec, rl_Rectangle
         unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
         unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
 
+        SetImageDirtyRec(dst, (int)dstRec.x, (int)dstRec.y, (int)srcRec.width, (int)srcRec.height);
+
         for (int y = 0; y < (int)srcRec.height; y++)
         {
             unsigned char *pSrc = pSrcBase;
@@ -4018,6 +5051,397 @@ void rl_UpdateTextureRec(rl_Texture2D texture, rl_Rectangle rec, const void *pix
     rlUpdateTexture(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
 }
 
+// Load image texture from image data, modified regions are tracked
+// NOTE: Image data ownership is taken, image data must be unloaded with rl_UnloadImageTexture()
+// WARNING: Image textures must be loaded, modified and updated on the same thread (regions tracking is not thread-safe)
+rl_ImageTexture rl_LoadImageTexture(rl_Image image)
+{
+    rl_ImageTexture imageTexture = { 0 };
+
+    imageTexture.image = image;
+    imageTexture.texture = rl_LoadTextureFromImage(image);
+
+    if ((imageTexture.texture.id > 0) && (image.format < PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        int index = 0;
+        while ((index < MAX_IMAGE_TEXTURES) && (imageTrackers[index].data != NULL)) index++;
+
+        if (index < MAX_IMAGE_TEXTURES)
+        {
+            imageTrackers[index].data = image.data;
+            imageTrackers[index].textureId = imageTexture.texture.id;
+            imageTrackers[index].width = image.width;
+            imageTrackers[index].height = image.height;
+            imageTrackers[index].recCount = 0;
+            imageTrackerCount++;
+        }
+        else TRACELOG(LOG_WARNING, "IMAGE: Image textures limit reached (%i), image texture updates will upload full image", MAX_IMAGE_TEXTURES);
+    }
+
+    return imageTexture;
+}
+
+// Unload image texture data from CPU and GPU memory
+void rl_UnloadImageTexture(rl_ImageTexture imageTexture)
+{
+    ImageDirtyTracker *tracker = NULL;
+
+    for (int i = 0; (i < MAX_IMAGE_TEXTURES) && (tracker == NULL); i++)
+    {
+        if ((imageTrackers[i].data != NULL) && (imageTrackers[i].textureId == imageTexture.texture.id)) tracker = &imageTrackers[i];
+    }
+
+    if (tracker != NULL)
+    {
+        RL_FREE(tracker->staging);
+        *tracker = (ImageDirtyTracker){ 0 };
+        imageTrackerCount--;
+    }
+
+    rl_UnloadTexture(imageTexture.texture);
+    rl_UnloadImage(imageTexture.image);
+}
+
+// Update image texture, only image modified regions are uploaded to GPU
+// NOTE 1: Regions covering most of the image are uploaded as a full image update
+// NOTE 2: If image has been reallocated (i.e. rl_ImageFormat()), full image is uploaded and tracking is restarted,
+// image size and format must match texture, only base mipmap level is updated
+void rl_UpdateImageTexture(rl_ImageTexture *imageTexture)
+{
+    rl_Image *image = &imageTexture->image;
+    rl_Texture2D texture = imageTexture->texture;
+
+    if ((image->data == NULL) || (texture.id == 0)) return;
+
+    if ((image->width != texture.width) || (image->height != texture.height) || (image->format != texture.format))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Image texture can not be updated, image size or format does not match texture");
+        return;
+    }
+
+    ImageDirtyTracker *tracker = GetImageDirtyTracker(image->data);
+
+    if (tracker == NULL)
+    {
+        // Image data reallocated, tracker registered for texture is restarted with new image data
+        for (int i = 0; (i < MAX_IMAGE_TEXTURES) && (tracker == NULL); i++)
+        {
+            if ((imageTrackers[i].data != NULL) && (imageTrackers[i].textureId == texture.id)) tracker = &imageTrackers[i];
+        }
+
+        if (tracker != NULL)
+        {
+            tracker->data = image->data;
+            tracker->recCount = 0;
+        }
+
+        rl_UpdateTexture(texture, image->data);
+        return;
+    }
+
+    int modifiedSize = 0;
+    for (int i = 0; i < tracker->recCount; i++) modifiedSize += tracker->recs[i].width*tracker->recs[i].height;
+
+    if (modifiedSize >= (image->width*image->height/2)) rl_UpdateTexture(texture, image->data);
+    else
+    {
+        int bytesPerPixel = rl_GetPixelDataSize(1, 1, image->format);
+
+        for (int i = 0; i < tracker->recCount; i++)
+        {
+            ImageDirtyRec rec = tracker->recs[i];
+            const unsigned char *pixels = (const unsigned char *)image->data + ((size_t)rec.y*image->width + rec.x)*bytesPerPixel;
+
+            // Full width regions are contiguous in image data, other regions rows are packed into staging buffer
+            if (rec.width != image->width)
+            {
+                int size = rec.width*rec.height*bytesPerPixel;
+
+                if (size > tracker->stagingSize)
+                {
+                    RL_FREE(tracker->staging);
+                    tracker->staging = (unsigned char *)RL_MALLOC(size);
+                    tracker->stagingSize = (tracker->staging != NULL)? size : 0;
+                }
+
+                if (tracker->staging == NULL)
+                {
+                    TRACELOG(LOG_WARNING, "IMAGE: Failed to allocate image texture staging buffer, full image uploaded");
+                    rl_UpdateTexture(texture, image->data);
+                    break;
+                }
+
+                for (int y = 0; y < rec.height; y++)
+                {
+                    memcpy(tracker->staging + (size_t)y*rec.width*bytesPerPixel, pixels + (size_t)y*image->width*bytesPerPixel, rec.width*bytesPerPixel);
+                }
+
+                pixels = tracker->staging;
+            }
+
+            rl_UpdateTextureRec(texture, (rl_Rectangle){ (float)rec.x, (float)rec.y, (float)rec.width, (float)rec.height }, pixels);
+        }
+    }
+
+    tracker->recCount = 0;
+}
+
+// Set image region as modified, required when image pixels are modified directly
+// NOTE: rl_ImageDraw*() and in place image manipulation functions set modified regions automatically
+void rl_SetImageDirty(rl_Image image, rl_Rectangle rec)
+{
+    SetImageDirtyRec(&image, (int)rec.x, (int)rec.y, (int)ceilf(rec.x + rec.width) - (int)rec.x, (int)ceilf(rec.y + rec.height) - (int)rec.y);
+}
+
+// Load virtual texture from tiles file (exported with rl_ExportImageTiles())
+// NOTE: Coarsest level tiles are loaded immediately and always kept resident, they are used
+// for regions not loaded yet, cache should hold all the tiles visible at the same time
+rl_VirtualTexture rl_LoadVirtualTexture(const char *fileName, int cacheTiles)
+{
+    rl_VirtualTexture texture = { 0 };
+    int header[8] = { 0 };
+
+    bool valid = LoadFileDataRange(fileName, 0, header, sizeof(header)) && (memcmp(header, "rVTX", 4) == 0) &&
+        (header[1] == VIRTUAL_TEXTURE_FILE_VERSION) && (header[2] > 0) && (header[3] > 0) &&
+        (header[4] > 0) && (header[4] <= MAX_VIRTUAL_TEXTURE_TILE_SIZE) && ((header[4] & (header[4] - 1)) == 0) &&
+        (header[5] == VIRTUAL_TEXTURE_TILE_BORDER) && (header[6] > 0) && (header[6] <= MAX_VIRTUAL_TEXTURE_LEVELS);
+
+    // Levels count must match base level size, levels are generated until level fits in one tile
+    // NOTE: Tiles count is computed with 64bit integers, tiles indices are stored as int
+    long long tileCount = 0;
+
+    if (valid)
+    {
+        int levels = 1;
+        int w = header[2];
+        int h = header[3];
+
+        for (; ((w > header[4]) || (h > header[4])) && (levels < MAX_VIRTUAL_TEXTURE_LEVELS); levels++)
+        {
+            tileCount += (long long)((w + header[4] - 1)/header[4])*((h + header[4] - 1)/header[4]);
+            w = (w + 1)/2;
+            h = (h + 1)/2;
+        }
+
+        // Coarsest level tiles are always resident, cache also requires one free slot (up to 256x256 slots)
+        long long coarsestTiles = (long long)((w + header[4] - 1)/header[4])*((h + header[4] - 1)/header[4]);
+        tileCount += coarsestTiles;
+
+        if ((levels != header[6]) || (coarsestTiles >= 256*256) || (tileCount > 0x7fffffff/(long long)sizeof(int))) valid = false;
+    }
+
+    if (!valid)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [%s] Failed to load virtual texture, tiles file not valid", fileName);
+        return texture;
+    }
+
+    VirtualTextureContext *ctx = (VirtualTextureContext *)RL_CALLOC(1, sizeof(VirtualTextureContext));
+
+    if (ctx == NULL)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [%s] Failed to allocate virtual texture data", fileName);
+        return texture;
+    }
+
+    texture.width = header[2];
+    texture.height = header[3];
+    texture.tileSize = header[4];
+    texture.levels = header[6];
+    texture.ctxData = ctx;
+
+    ctx->fileName = (char *)RL_CALLOC(strlen(fileName) + 1, 1);
+    if (ctx->fileName != NULL) strcpy(ctx->fileName, fileName);
+
+    const int slotSize = texture.tileSize + 2*VIRTUAL_TEXTURE_TILE_BORDER;
+    ctx->tileDataSize = slotSize*slotSize*4;
+
+    for (int l = 0, w = texture.width, h = texture.height, first = 0; l < texture.levels; l++)
+    {
+        ctx->tilesX[l] = (w + texture.tileSize - 1)/texture.tileSize;
+        ctx->tilesY[l] = (h + texture.tileSize - 1)/texture.tileSize;
+        ctx->firstTile[l] = first;
+        first += ctx->tilesX[l]*ctx->tilesY[l];
+        w = (w + 1)/2;
+        h = (h + 1)/2;
+    }
+
+    // Cache keeps all coarsest level tiles, slots position is stored in 8bit indirection channels
+    int coarsestTiles = ctx->tilesX[texture.levels - 1]*ctx->tilesY[texture.levels - 1];
+    if (cacheTiles <= coarsestTiles) cacheTiles = coarsestTiles + 1;
+
+    ctx->slotsPerRow = (int)ceilf(sqrtf((float)cacheTiles));
+    if (ctx->slotsPerRow > 256) ctx->slotsPerRow = 256;
+    int slotRows = (cacheTiles + ctx->slotsPerRow - 1)/ctx->slotsPerRow;
+    if (slotRows > 256) slotRows = 256;
+    ctx->slotCount = ctx->slotsPerRow*slotRows;
+
+    ctx->tileSlots = (int *)RL_MALLOC((size_t)tileCount*sizeof(int));
+    ctx->slots = (VirtualTextureSlot *)RL_CALLOC(ctx->slotCount, sizeof(VirtualTextureSlot));
+    ctx->requests = (int *)RL_MALLOC(ctx->slotCount*sizeof(int));
+    ctx->indirection = (unsigned char *)RL_CALLOC((size_t)ctx->tilesX[0]*ctx->tilesY[0], 4);
+
+    bool allocated = (ctx->fileName != NULL) && (ctx->tileSlots != NULL) && (ctx->slots != NULL) && (ctx->requests != NULL) && (ctx->indirection != NULL);
+
+    for (int i = 0; i < MAX_VIRTUAL_TEXTURE_LOADS; i++)
+    {
+        ctx->loads[i].fileName = ctx->fileName;
+        ctx->loads[i].dataSize = ctx->tileDataSize;
+        ctx->loads[i].data = (unsigned char *)RL_MALLOC(ctx->tileDataSize);
+        ctx->loads[i].tile = -1;
+        ctx->loads[i].jobId = -1;
+
+        if (ctx->loads[i].data == NULL) allocated = false;
+    }
+
+    if (!allocated)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [%s] Failed to allocate virtual texture data", fileName);
+        rl_UnloadVirtualTexture(texture);
+        return (rl_VirtualTexture){ 0 };
+    }
+
+    for (int i = 0; i < tileCount; i++) ctx->tileSlots[i] = -1;
+    for (int i = 0; i < ctx->slotCount; i++) ctx->slots[i].tile = -1;
+
+    texture.cache.id = rlLoadTexture(NULL, ctx->slotsPerRow*slotSize, slotRows*slotSize, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+    texture.cache.width = ctx->slotsPerRow*slotSize;
+    texture.cache.height = slotRows*slotSize;
+    texture.cache.mipmaps = 1;
+    texture.cache.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+    texture.indirection.id = rlLoadTexture(NULL, ctx->tilesX[0], ctx->tilesY[0], PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+    texture.indirection.width = ctx->tilesX[0];
+    texture.indirection.height = ctx->tilesY[0];
+    texture.indirection.mipmaps = 1;
+    texture.indirection.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+    // Coarsest level tiles loaded on calling thread
+    VirtualTextureLoad *load = &ctx->loads[0];
+
+    for (int i = 0; i < coarsestTiles; i++)
+    {
+        load->tile = ctx->firstTile[texture.levels - 1] + i;
+        load->offset = VIRTUAL_TEXTURE_HEADER_SIZE + (long long)load->tile*ctx->tileDataSize;
+
+        LoadVirtualTextureTileJob(load);
+        if (load->success) SetVirtualTextureTile(&texture, load, true);
+    }
+
+    load->tile = -1;
+
+    UpdateVirtualTextureIndirection(&texture);
+
+    TRACELOG(LOG_INFO, "TEXTURE: [%s] Virtual texture loaded successfully (%ix%i | %i levels | %i cache tiles)", fileName, texture.width, texture.height, texture.levels, ctx->slotCount);
+
+    return texture;
+}
+
+// Unload virtual texture, pending tiles loads are finished
+void rl_UnloadVirtualTexture(rl_VirtualTexture texture)
+{
+    VirtualTextureContext *ctx = (VirtualTextureContext *)texture.ctxData;
+
+    if (ctx != NULL)
+    {
+        for (int i = 0; i < MAX_VIRTUAL_TEXTURE_LOADS; i++)
+        {
+            if (ctx->loads[i].tile >= 0) WaitLoaderJob(ctx->loads[i].jobId);
+            RL_FREE(ctx->loads[i].data);
+        }
+
+        RL_FREE(ctx->indirection);
+        RL_FREE(ctx->requests);
+        RL_FREE(ctx->slots);
+        RL_FREE(ctx->tileSlots);
+        RL_FREE(ctx->fileName);
+        RL_FREE(ctx);
+    }
+
+    rl_UnloadTexture(texture.cache);
+    rl_UnloadTexture(texture.indirection);
+}
+
+// Request virtual texture region tiles, level selected from scale (screen pixels per texel)
+// NOTE: Region is defined in base level pixels, requested tiles are loaded on next rl_UpdateVirtualTexture()
+void rl_RequestVirtualTextureRec(rl_VirtualTexture *texture, rl_Rectangle source, float scale)
+{
+    VirtualTextureContext *ctx = (VirtualTextureContext *)texture->ctxData;
+    if (ctx == NULL) return;
+
+    int level = GetVirtualTextureLevel(texture, scale);
+    float levelTileSize = (float)(texture->tileSize << level);
+
+    int startX = (int)floorf(source.x/levelTileSize);
+    int startY = (int)floorf(source.y/levelTileSize);
+    int endX = (int)ceilf((source.x + source.width)/levelTileSize);
+    int endY = (int)ceilf((source.y + source.height)/levelTileSize);
+
+    if (startX < 0) startX = 0;
+    if (startY < 0) startY = 0;
+    if (endX > ctx->tilesX[level]) endX = ctx->tilesX[level];
+    if (endY > ctx->tilesY[level]) endY = ctx->tilesY[level];
+
+    for (int y = startY; y < endY; y++)
+    {
+        for (int x = startX; x < endX; x++) RequestVirtualTextureTile(ctx, ctx->firstTile[level] + y*ctx->tilesX[level] + x);
+    }
+}
+
+// Update virtual texture: upload loaded tiles, load requested tiles and update indirection texture
+// NOTE: Tiles are loaded on loader threads, requests not loading on current frame are dropped
+// (they should be requested again), least recently used tiles are evicted when cache is full
+void rl_UpdateVirtualTexture(rl_VirtualTexture *texture)
+{
+    VirtualTextureContext *ctx = (VirtualTextureContext *)texture->ctxData;
+    if (ctx == NULL) return;
+
+    // Upload loaded tiles into cache
+    for (int i = 0; i < MAX_VIRTUAL_TEXTURE_LOADS; i++)
+    {
+        VirtualTextureLoad *load = &ctx->loads[i];
+
+        if ((load->tile >= 0) && IsLoaderJobDone(load->jobId))
+        {
+            WaitLoaderJob(load->jobId);
+
+            if (!load->success || !SetVirtualTextureTile(texture, load, false)) ctx->tileSlots[load->tile] = -1;
+            load->tile = -1;
+        }
+    }
+
+    // Start requested tiles loads
+    int request = 0;
+
+    for (int i = 0; (i < MAX_VIRTUAL_TEXTURE_LOADS) && (request < ctx->requestCount); i++)
+    {
+        VirtualTextureLoad *load = &ctx->loads[i];
+
+        if (load->tile < 0)
+        {
+            load->tile = ctx->requests[request];
+            load->offset = VIRTUAL_TEXTURE_HEADER_SIZE + (long long)load->tile*ctx->tileDataSize;
+            load->success = false;
+            load->jobId = AddLoaderJob(LoadVirtualTextureTileJob, load);
+
+            if (load->jobId < 0)
+            {
+                load->tile = -1;
+                break;
+            }
+
+            request++;
+        }
+    }
+
+    for (; request < ctx->requestCount; request++) ctx->tileSlots[ctx->requests[request]] = -1;
+    ctx->requestCount = 0;
+
+    if (ctx->indirectionDirty) UpdateVirtualTextureIndirection(texture);
+
+    ctx->frame++;
+}
+
 //------------------------------------------------------------------------------------
 // rl_Texture configuration functions
 //------------------------------------------------------------------------------------
@@ -4282,6 +5706,79 @@ void rl_DrawTexturePro(rl_Texture2D texture, rl_Rectangle source, rl_Rectangle d
     }
 }
 
+// Draw a part of a virtual texture with resident tiles, missing tiles are requested
+// NOTE: Tiles not resident are drawn from the finest resident level covering them
+void rl_DrawVirtualTexture(rl_VirtualTexture texture, rl_Rectangle source, rl_Rectangle dest, rl_Color tint)
+{
+    VirtualTextureContext *ctx = (VirtualTextureContext *)texture.ctxData;
+    if ((ctx == NULL) || (texture.cache.id == 0) || (source.width <= 0) || (source.height <= 0)) return;
+
+    float scaleX = dest.width/source.width;
+    float scaleY = dest.height/source.height;
+
+    int level = GetVirtualTextureLevel(&texture, (scaleX < scaleY)? scaleX : scaleY);
+    int levelTileSize = texture.tileSize << level;
+    const int slotSize = texture.tileSize + 2*VIRTUAL_TEXTURE_TILE_BORDER;
+
+    int startX = (int)floorf(source.x/levelTileSize);
+    int startY = (int)floorf(source.y/levelTileSize);
+    int endX = (int)ceilf((source.x + source.width)/levelTileSize);
+    int endY = (int)ceilf((source.y + source.height)/levelTileSize);
+
+    if (startX < 0) startX = 0;
+    if (startY < 0) startY = 0;
+    if (endX > ctx->tilesX[level]) endX = ctx->tilesX[level];
+    if (endY > ctx->tilesY[level]) endY = ctx->tilesY[level];
+
+    for (int y = startY; y < endY; y++)
+    {
+        for (int x = startX; x < endX; x++)
+        {
+            RequestVirtualTextureTile(ctx, ctx->firstTile[level] + y*ctx->tilesX[level] + x);
+
+            // Tile region within source and base size
+            float minX = (float)(x*levelTileSize);
+            float minY = (float)(y*levelTileSize);
+            float maxX = minX + levelTileSize;
+            float maxY = minY + levelTileSize;
+
+            if (minX < source.x) minX = source.x;
+            if (minY < source.y) minY = source.y;
+            if (maxX > (source.x + source.width)) maxX = source.x + source.width;
+            if (maxY > (source.y + source.height)) maxY = source.y + source.height;
+            if (maxX > texture.width) maxX = (float)texture.width;
+            if (maxY > texture.height) maxY = (float)texture.height;
+            if ((maxX <= minX) || (maxY <= minY)) continue;
+
+            // Finest resident tile covering region, coarsest level is always resident
+            for (int l = level; l < texture.levels; l++)
+            {
+                int tileX = x >> (l - level);
+                int tileY = y >> (l - level);
+                int slot = ctx->tileSlots[ctx->firstTile[l] + tileY*ctx->tilesX[l] + tileX];
+
+                if (slot >= 0)
+                {
+                    ctx->slots[slot].lastUsed = ctx->frame;
+
+                    float levelScale = (float)(1 << l);
+                    float originX = (float)(tileX*(texture.tileSize << l));
+                    float originY = (float)(tileY*(texture.tileSize << l));
+
+                    rl_Rectangle cacheRec = {
+                        (float)((slot%ctx->slotsPerRow)*slotSize + VIRTUAL_TEXTURE_TILE_BORDER) + (minX - originX)/levelScale,
+                        (float)((slot/ctx->slotsPerRow)*slotSize + VIRTUAL_TEXTURE_TILE_BORDER) + (minY - originY)/levelScale,
+                        (maxX - minX)/levelScale, (maxY - minY)/levelScale };
+                    rl_Rectangle destRec = { dest.x + (minX - source.x)*scaleX, dest.y + (minY - source.y)*scaleY, (maxX - minX)*scaleX, (maxY - minY)*scaleY };
+
+                    rl_DrawTexturePro(texture.cache, cacheRec, destRec, (rl_Vector2){ 0.0f, 0.0f }, 0.0f, tint);
+                    break;
+                }
+            }
+        }
+    }
+}
+
 // Draws a texture (or part of it) that stretches or shrinks nicely using n-patch info
 void rl_DrawTextureNPatch(rl_Texture2D texture, rl_NPatchInfo nPatchInfo, rl_Rectangle dest, rl_Vector2 origin, float rotation, rl_Color tint)
 {
@@ -4479,86 +5976,565 @@ void rl_DrawTextureNPatch(rl_Texture2D texture, rl_NPatchInfo nPatchInfo, rl_Rec
     }
 }
 
-// Check if two colors are equal
-bool ColorIsEqual(rl_Color col1, rl_Color col2)
+#if defined(SUPPORT_VIDEO_PLAYBACK)
+//------------------------------------------------------------------------------------
+// rl_Video loading and playback functions
+//------------------------------------------------------------------------------------
+// Export images as video file (.rvid), audio file embedded as audio track (optional)
+// NOTE: All frames must have the same size, frames are encoded as QOI images
+bool rl_ExportVideo(const char *fileName, const rl_Image *frames, int frameCount, float frameRate, const char *audioFileName)
 {
-    bool result = false;
+    bool success = false;
 
-    if ((col1.r == col2.r) && (col1.g == col2.g) && (col1.b == col2.b) && (col1.a == col2.a)) result = true;
+#if defined(SUPPORT_FILEFORMAT_QOI)
+    if ((frames == NULL) || (frameCount <= 0) || (frameRate <= 0.0f) || (frames[0].width <= 0) || (frames[0].height <= 0)) return success;
 
-    return result;
-}
+    int audioDataSize = 0;
+    unsigned char *audioData = NULL;
+    const char *audioFileType = "";
 
-// Get color with alpha applied, alpha goes from 0.0f to 1.0f
-rl_Color rl_Fade(rl_Color color, float alpha)
-{
-    rl_Color result = color;
+    if (audioFileName != NULL)
+    {
+        audioData = rl_LoadFileData(audioFileName, &audioDataSize);
+        if (audioData != NULL) audioFileType = rl_GetFileExtension(audioFileName);
+    }
 
-    if (alpha < 0.0f) alpha = 0.0f;
-    else if (alpha > 1.0f) alpha = 1.0f;
+    int header[VIDEO_HEADER_SIZE/4] = { 0 };
+    memcpy(header, "rVID", 4);
+    header[1] = VIDEO_FILE_VERSION;
+    header[2] = frames[0].width;
+    header[3] = frames[0].height;
+    header[4] = frameCount;
+    header[5] = (int)(frameRate*1000.0f + 0.5f);
+    header[6] = audioDataSize;
+    strncpy((char *)&header[7], audioFileType, 7);
 
-    result.a = (unsigned char)(255.0f*alpha);
+    long long *frameIndex = (long long *)RL_CALLOC(2*frameCount, sizeof(long long));
+    long long offset = VIDEO_HEADER_SIZE + 2*frameCount*sizeof(long long);
 
-    return result;
-}
+    success = SaveFileDataRange(fileName, 0, header, VIDEO_HEADER_SIZE);
 
-// Get hexadecimal value for a rl_Color
-int rl_ColorToInt(rl_Color color)
-{
-    int result = 0;
-    
-    result = (int)(((unsigned int)color.r << 24) | 
-                   ((unsigned int)color.g << 16) | 
-                   ((unsigned int)color.b << 8) | 
-                    (unsigned int)color.a);
-    
-    return result;
-}
+    if (success && (audioDataSize > 0)) success = SaveFileDataRange(fileName, offset, audioData, audioDataSize);
+    offset += audioDataSize;
 
-// Get color normalized as float [0..1]
-rl_Vector4 rl_ColorNormalize(rl_Color color)
-{
-    rl_Vector4 result;
+    for (int i = 0; (i < frameCount) && success; i++)
+    {
+        if ((frames[i].width != frames[0].width) || (frames[i].height != frames[0].height) || (frames[i].format >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
+        {
+            TRACELOG(LOG_WARNING, "FILEIO: [%s] Video frame %i size or format not valid", fileName, i);
+            success = false;
+            break;
+        }
 
-    result.x = (float)color.r/255.0f;
-    result.y = (float)color.g/255.0f;
-    result.z = (float)color.b/255.0f;
-    result.w = (float)color.a/255.0f;
+        rl_Color *pixels = rl_LoadImageColorsView(frames[i]);
+        qoi_desc desc = { (unsigned int)frames[i].width, (unsigned int)frames[i].height, 4, QOI_SRGB };
+        int dataSize = 0;
+        void *data = qoi_encode(pixels, &desc, &dataSize);
+        rl_UnloadImageColorsView(frames[i], pixels);
 
-    return result;
-}
+        success = (data != NULL) && SaveFileDataRange(fileName, offset, data, dataSize);
+        frameIndex[2*i] = offset;
+        frameIndex[2*i + 1] = dataSize;
+        offset += dataSize;
 
-// Get color from normalized values [0..1]
-rl_Color rl_ColorFromNormalized(rl_Vector4 normalized)
-{
-    rl_Color result;
+        RL_FREE(data);
+    }
 
-    result.r = (unsigned char)(normalized.x*255.0f);
-    result.g = (unsigned char)(normalized.y*255.0f);
-    result.b = (unsigned char)(normalized.z*255.0f);
-    result.a = (unsigned char)(normalized.w*255.0f);
+    if (success) success = SaveFileDataRange(fileName, VIDEO_HEADER_SIZE, frameIndex, 2*frameCount*sizeof(long long));
 
-    return result;
+    RL_FREE(frameIndex);
+    rl_UnloadFileData(audioData);
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Video exported successfully (%i frames)", fileName, frameCount);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export video", fileName);
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: [%s] Video export requires QOI file format support", fileName);
+#endif
+
+    return success;
 }
 
-// Get HSV values for a rl_Color
-// NOTE: Hue is returned as degrees [0..360]
-rl_Vector3 rl_ColorToHSV(rl_Color color)
+// Load video from file (.rvid), frames are streamed from file
+// NOTE: First frame is decoded on loading, audio track is loaded if audio device is ready
+rl_Video rl_LoadVideo(const char *fileName)
 {
-    rl_Vector3 hsv = { 0 };
-    rl_Vector3 rgb = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-    float min, max, delta;
+    rl_Video video = { 0 };
+    int header[VIDEO_HEADER_SIZE/4] = { 0 };
 
-    min = rgb.x < rgb.y? rgb.x : rgb.y;
-    min = min  < rgb.z? min  : rgb.z;
-
-    max = rgb.x > rgb.y? rgb.x : rgb.y;
-    max = max  > rgb.z? max  : rgb.z;
+    bool headerLoaded = LoadFileDataRange(fileName, 0, header, VIDEO_HEADER_SIZE);
 
-    hsv.z = max;            // Value
-    delta = max - min;
+    // NOTE: Frames index must be inside file, frames index and frame pixels sizes must fit in int
+    long long fileSize = GetFileDataLength(fileName);
+    long long indexSize = 2*(long long)header[4]*(long long)sizeof(long long);
 
-    if (delta < 0.00001f)
+    if (!headerLoaded || (memcmp(header, "rVID", 4) != 0) || (header[1] != VIDEO_FILE_VERSION) ||
+        (header[2] <= 0) || (header[3] <= 0) || (header[4] <= 0) || (header[5] <= 0) || (((long long)header[2]*header[3]) > (INT_MAX/4)) ||
+        (indexSize > (fileSize - VIDEO_HEADER_SIZE)) || (indexSize > INT_MAX))
+    {
+        TRACELOG(LOG_WARNING, "VIDEO: [%s] Failed to load video, file not valid", fileName);
+        return video;
+    }
+
+    VideoContext *ctx = (VideoContext *)RL_CALLOC(1, sizeof(VideoContext));
+
+    if (ctx == NULL)
+    {
+        TRACELOG(LOG_WARNING, "VIDEO: [%s] Failed to allocate video decoding context", fileName);
+        return video;
+    }
+
+    ctx->fileName = (char *)RL_CALLOC(strlen(fileName) + 1, 1);
+    if (ctx->fileName != NULL) strcpy(ctx->fileName, fileName);
+    ctx->frameIndex = (long long *)RL_MALLOC((size_t)indexSize);
+    ctx->currentFrame = -1;
+
+    bool indexValid = (ctx->fileName != NULL) && (ctx->frameIndex != NULL) && LoadFileDataRange(fileName, VIDEO_HEADER_SIZE, ctx->frameIndex, (int)indexSize);
+
+    // Frames data ranges must be inside file, frames data buffers are allocated with the largest frame data size
+    long long maxDataSize = 0;
+
+    for (int i = 0; (i < header[4]) && indexValid; i++)
+    {
+        long long offset = ctx->frameIndex[2*i];
+        long long dataSize = ctx->frameIndex[2*i + 1];
+
+        if ((offset < VIDEO_HEADER_SIZE) || (dataSize <= 0) || (dataSize > INT_MAX) || (offset > (fileSize - dataSize))) indexValid = false;
+        else if (dataSize > maxDataSize) maxDataSize = dataSize;
+    }
+
+    bool buffersLoaded = indexValid;
+
+    for (int i = 0; i < MAX_VIDEO_FRAMES; i++)
+    {
+        ctx->decodes[i].fileName = ctx->fileName;
+        ctx->decodes[i].width = header[2];
+        ctx->decodes[i].height = header[3];
+        ctx->decodes[i].frame = -1;
+        ctx->decodes[i].jobId = -1;
+
+        if (buffersLoaded)
+        {
+            ctx->decodes[i].data = (unsigned char *)RL_MALLOC((size_t)maxDataSize);
+            ctx->decodes[i].pixels = (unsigned char *)RL_MALLOC((size_t)header[2]*header[3]*4);
+            if ((ctx->decodes[i].data == NULL) || (ctx->decodes[i].pixels == NULL)) buffersLoaded = false;
+        }
+    }
+
+    if (!buffersLoaded)
+    {
+        if (!indexValid) TRACELOG(LOG_WARNING, "VIDEO: [%s] Failed to load video frames index", fileName);
+        else TRACELOG(LOG_WARNING, "VIDEO: [%s] Failed to allocate video frames buffers", fileName);
+
+        for (int i = 0; i < MAX_VIDEO_FRAMES; i++)
+        {
+            RL_FREE(ctx->decodes[i].data);
+            RL_FREE(ctx->decodes[i].pixels);
+        }
+
+        RL_FREE(ctx->frameIndex);
+        RL_FREE(ctx->fileName);
+        RL_FREE(ctx);
+        return video;
+    }
+
+    video.frameCount = header[4];
+    video.frameRate = (float)header[5]/1000.0f;
+    video.looping = false;
+    video.ctxData = ctx;
+
+#if defined(SUPPORT_MODULE_RAUDIO)
+    // Audio data is stored after frames index, audio is not loaded if its data range is not inside file
+    if ((header[6] > 0) && ((long long)header[6] <= (fileSize - VIDEO_HEADER_SIZE - indexSize)) && rl_IsAudioDeviceReady())
+    {
+        char audioFileType[8] = { 0 };
+        memcpy(audioFileType, &header[7], 7);
+
+        ctx->audioData = (unsigned char *)RL_MALLOC(header[6]);
+
+        if ((ctx->audioData != NULL) && LoadFileDataRange(fileName, VIDEO_HEADER_SIZE + indexSize, ctx->audioData, header[6]))
+        {
+            video.music = rl_LoadMusicStreamFromMemory(audioFileType, ctx->audioData, header[6]);
+            video.music.looping = false;
+        }
+    }
+#endif
+
+    video.texture.id = rlLoadTexture(NULL, header[2], header[3], PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+    video.texture.width = header[2];
+    video.texture.height = header[3];
+    video.texture.mipmaps = 1;
+    video.texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+    // First frame decoded on calling thread
+    VideoFrameDecode *decode = &ctx->decodes[0];
+    decode->offset = ctx->frameIndex[0];
+    decode->dataSize = (int)ctx->frameIndex[1];
+    DecodeVideoFrameJob(decode);
+
+    if (decode->success)
+    {
+        rl_UpdateTexture(video.texture, decode->pixels);
+        ctx->currentFrame = 0;
+    }
+
+    TRACELOG(LOG_INFO, "VIDEO: [%s] Video loaded successfully (%ix%i | %i frames | %.2f fps)", fileName, video.texture.width, video.texture.height, video.frameCount, video.frameRate);
+
+    return video;
+}
+
+// Check if a video is ready
+bool rl_IsVideoReady(rl_Video video)
+{
+    return ((video.ctxData != NULL) &&      // Validate decoding context loaded
+            (video.texture.id > 0) &&       // Validate frame texture loaded
+            (video.frameCount > 0) &&       // Validate video frame count
+            (video.frameRate > 0.0f));      // Validate video frame rate
+}
+
+// Unload video, pending frames decoding is finished
+void rl_UnloadVideo(rl_Video video)
+{
+    VideoContext *ctx = (VideoContext *)video.ctxData;
+
+    if (ctx != NULL)
+    {
+        for (int i = 0; i < MAX_VIDEO_FRAMES; i++)
+        {
+            if (ctx->decodes[i].jobId >= 0) WaitLoaderJob(ctx->decodes[i].jobId);
+            RL_FREE(ctx->decodes[i].data);
+            RL_FREE(ctx->decodes[i].pixels);
+        }
+
+#if defined(SUPPORT_MODULE_RAUDIO)
+        if (video.music.ctxData != NULL) rl_UnloadMusicStream(video.music);
+#endif
+        RL_FREE(ctx->audioData);
+        RL_FREE(ctx->frameIndex);
+        RL_FREE(ctx->fileName);
+        RL_FREE(ctx);
+    }
+
+    rl_UnloadTexture(video.texture);
+}
+
+// Start video playing
+void rl_PlayVideo(rl_Video video)
+{
+    VideoContext *ctx = (VideoContext *)video.ctxData;
+    if (ctx == NULL) return;
+
+    ctx->playing = true;
+    ctx->lastTime = rl_GetTime();
+
+#if defined(SUPPORT_MODULE_RAUDIO)
+    if (rl_IsMusicReady(video.music))
+    {
+        rl_PlayMusicStream(video.music);
+        if (ctx->time > 0.0) rl_SeekMusicStream(video.music, (float)ctx->time);
+    }
+#endif
+}
+
+// Check if video is playing
+bool rl_IsVideoPlaying(rl_Video video)
+{
+    VideoContext *ctx = (VideoContext *)video.ctxData;
+
+    return ((ctx != NULL) && ctx->playing);
+}
+
+// Update video texture with current frame and request next frames decoding
+// NOTE: Decoding is never waited, if current frame is not decoded yet latest decoded frame is kept,
+// audio track is used as playback clock while playing, frame time is used otherwise
+void rl_UpdateVideo(rl_Video video)
+{
+    VideoContext *ctx = (VideoContext *)video.ctxData;
+    if (ctx == NULL) return;
+
+    double currentTime = rl_GetTime();
+    if (ctx->playing) ctx->time += (currentTime - ctx->lastTime);
+    ctx->lastTime = currentTime;
+
+#if defined(SUPPORT_MODULE_RAUDIO)
+    if (ctx->playing && rl_IsMusicReady(video.music))
+    {
+        rl_UpdateMusicStream(video.music);
+        if (rl_IsMusicStreamPlaying(video.music)) ctx->time = rl_GetMusicTimePlayed(video.music);
+    }
+#endif
+
+    double length = (double)video.frameCount/video.frameRate;
+
+    if (ctx->time >= length)
+    {
+        if (video.looping)
+        {
+            ctx->time = fmod(ctx->time, length);
+#if defined(SUPPORT_MODULE_RAUDIO)
+            if (rl_IsMusicReady(video.music))
+            {
+                rl_StopMusicStream(video.music);
+                rl_PlayMusicStream(video.music);
+                if (ctx->time > 0.0) rl_SeekMusicStream(video.music, (float)ctx->time);
+            }
+#endif
+        }
+        else
+        {
+            ctx->time = length;
+            ctx->playing = false;
+        }
+    }
+
+    int frame = (int)(ctx->time*video.frameRate);
+    if (frame >= video.frameCount) frame = video.frameCount - 1;
+
+    // Release finished decoding jobs
+    for (int i = 0; i < MAX_VIDEO_FRAMES; i++)
+    {
+        VideoFrameDecode *decode = &ctx->decodes[i];
+
+        if ((decode->jobId >= 0) && IsLoaderJobDone(decode->jobId))
+        {
+            WaitLoaderJob(decode->jobId);
+            decode->jobId = -1;
+
+            if (decode->success) decode->ready = true;
+            else decode->frame = -1;
+        }
+    }
+
+    // Upload latest decoded frame up to current frame, older frames and frames out of decoding range are released
+    VideoFrameDecode *latest = NULL;
+    int latestDistance = 0;
+
+    for (int i = 0; i < MAX_VIDEO_FRAMES; i++)
+    {
+        VideoFrameDecode *decode = &ctx->decodes[i];
+        if (!decode->ready) continue;
+
+        int distance = decode->frame - frame;
+        if (video.looping && (distance < -video.frameCount/2)) distance += video.frameCount;
+
+        if (distance <= 0)
+        {
+            if ((latest == NULL) || (distance > latestDistance))
+            {
+                latest = decode;
+                latestDistance = distance;
+            }
+        }
+        else if (distance >= MAX_VIDEO_FRAMES)
+        {
+            decode->ready = false;
+            decode->frame = -1;
+        }
+    }
+
+    if ((latest != NULL) && (latest->frame != ctx->currentFrame))
+    {
+        rl_UpdateTexture(video.texture, latest->pixels);
+        ctx->currentFrame = latest->frame;
+    }
+
+    for (int i = 0; i < MAX_VIDEO_FRAMES; i++)
+    {
+        VideoFrameDecode *decode = &ctx->decodes[i];
+
+        int distance = decode->frame - frame;
+        if (video.looping && (distance < -video.frameCount/2)) distance += video.frameCount;
+
+        if (decode->ready && (distance <= 0))
+        {
+            decode->ready = false;
+            decode->frame = -1;
+        }
+    }
+
+    // Request current and next frames decoding
+    for (int i = 0; i < MAX_VIDEO_FRAMES; i++)
+    {
+        int next = frame + i;
+
+        if (next >= video.frameCount)
+        {
+            if (video.looping) next -= video.frameCount;
+            else break;
+        }
+
+        if (next == ctx->currentFrame) continue;
+
+        VideoFrameDecode *available = NULL;
+        bool decoding = false;
+
+        for (int k = 0; k < MAX_VIDEO_FRAMES; k++)
+        {
+            if (ctx->decodes[k].frame == next) decoding = true;
+            else if ((available == NULL) && (ctx->decodes[k].frame < 0)) available = &ctx->decodes[k];
+        }
+
+        if (decoding) continue;
+        if (available == NULL) break;
+
+        StartVideoFrameDecode(video, available, next);
+    }
+}
+
+// Stop video playing, video is rewound
+void rl_StopVideo(rl_Video video)
+{
+    VideoContext *ctx = (VideoContext *)video.ctxData;
+    if (ctx == NULL) return;
+
+    ctx->playing = false;
+    ctx->time = 0.0;
+
+#if defined(SUPPORT_MODULE_RAUDIO)
+    if (rl_IsMusicReady(video.music)) rl_StopMusicStream(video.music);
+#endif
+}
+
+// Pause video playing
+void rl_PauseVideo(rl_Video video)
+{
+    VideoContext *ctx = (VideoContext *)video.ctxData;
+    if (ctx == NULL) return;
+
+    ctx->playing = false;
+
+#if defined(SUPPORT_MODULE_RAUDIO)
+    if (rl_IsMusicReady(video.music)) rl_PauseMusicStream(video.music);
+#endif
+}
+
+// Resume paused video playing
+void rl_ResumeVideo(rl_Video video)
+{
+    VideoContext *ctx = (VideoContext *)video.ctxData;
+    if (ctx == NULL) return;
+
+    ctx->playing = true;
+    ctx->lastTime = rl_GetTime();
+
+#if defined(SUPPORT_MODULE_RAUDIO)
+    if (rl_IsMusicReady(video.music)) rl_ResumeMusicStream(video.music);
+#endif
+}
+
+// Seek video to a position (in seconds)
+// NOTE: Frame at position is shown once decoded, on next updates
+void rl_SeekVideo(rl_Video video, float position)
+{
+    VideoContext *ctx = (VideoContext *)video.ctxData;
+    if (ctx == NULL) return;
+
+    float length = (float)video.frameCount/video.frameRate;
+
+    if (position < 0.0f) position = 0.0f;
+    else if (position > length) position = length;
+
+    ctx->time = position;
+
+#if defined(SUPPORT_MODULE_RAUDIO)
+    if (rl_IsMusicReady(video.music)) rl_SeekMusicStream(video.music, position);
+#endif
+}
+
+// Get video time length (in seconds)
+float rl_GetVideoTimeLength(rl_Video video)
+{
+    return (video.frameRate > 0.0f)? (float)video.frameCount/video.frameRate : 0.0f;
+}
+
+// Get current video time played (in seconds)
+float rl_GetVideoTimePlayed(rl_Video video)
+{
+    VideoContext *ctx = (VideoContext *)video.ctxData;
+
+    return (ctx != NULL)? (float)ctx->time : 0.0f;
+}
+#endif      // SUPPORT_VIDEO_PLAYBACK
+
+// Check if two colors are equal
+bool ColorIsEqual(rl_Color col1, rl_Color col2)
+{
+    bool result = false;
+
+    if ((col1.r == col2.r) && (col1.g == col2.g) && (col1.b == col2.b) && (col1.a == col2.a)) result = true;
+
+    return result;
+}
+
+// Get color with alpha applied, alpha goes from 0.0f to 1.0f
+rl_Color rl_Fade(rl_Color color, float alpha)
+{
+    rl_Color result = color;
+
+    if (alpha < 0.0f) alpha = 0.0f;
+    else if (alpha > 1.0f) alpha = 1.0f;
+
+    result.a = (unsigned char)(255.0f*alpha);
+
+    return result;
+}
+
+// Get hexadecimal value for a rl_Color
+int rl_ColorToInt(rl_Color color)
+{
+    int result = 0;
+    
+    result = (int)(((unsigned int)color.r << 24) | 
+                   ((unsigned int)color.g << 16) | 
+                   ((unsigned int)color.b << 8) | 
+                    (unsigned int)color.a);
+    
+    return result;
+}
+
+// Get color normalized as float [0..1]
+rl_Vector4 rl_ColorNormalize(rl_Color color)
+{
+    rl_Vector4 result;
+
+    result.x = (float)color.r/255.0f;
+    result.y = (float)color.g/255.0f;
+    result.z = (float)color.b/255.0f;
+    result.w = (float)color.a/255.0f;
+
+    return result;
+}
+
+// Get color from normalized values [0..1]
+rl_Color rl_ColorFromNormalized(rl_Vector4 normalized)
+{
+    rl_Color result;
+
+    result.r = (unsigned char)(normalized.x*255.0f);
+    result.g = (unsigned char)(normalized.y*255.0f);
+    result.b = (unsigned char)(normalized.z*255.0f);
+    result.a = (unsigned char)(normalized.w*255.0f);
+
+    return result;
+}
+
+// Get HSV values for a rl_Color
+// NOTE: Hue is returned as degrees [0..360]
+rl_Vector3 rl_ColorToHSV(rl_Color color)
+{
+    rl_Vector3 hsv = { 0 };
+    rl_Vector3 rgb = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    float min, max, delta;
+
+    min = rgb.x < rgb.y? rgb.x : rgb.y;
+    min = min  < rgb.z? min  : rgb.z;
+
+    max = rgb.x > rgb.y? rgb.x : rgb.y;
+    max = max  > rgb.z? max  : rgb.z;
+
+    hsv.z = max;            // Value
+    delta = max - min;
+
+    if (delta < 0.00001f)
     {
         hsv.y = 0.0f;
         hsv.x = 0.0f;       // Undefined, maybe NAN?
@@ -5041,10 +7017,12 @@ static float HalfToFloat(unsigned short x)
     const unsigned int e = (x & 0x7C00) >> 10; // Exponent
     const unsigned int m = (x & 0x03FF) << 13; // Mantissa
     const float fm = (float)m;
-    const unsigned int v = (*(unsigned int*)&fm) >> 23; // Evil log2 bit hack to count leading zeros in denormalized format
+    unsigned int v = 0;
+    memcpy(&v, &fm, sizeof(float));
+    v >>= 23; // Evil log2 bit hack to count leading zeros in denormalized format
     const unsigned int r = (x & 0x8000) << 16 | (e != 0)*((e + 112) << 23 | m) | ((e == 0)&(m != 0))*((v - 37) << 23 | ((m << (150 - v)) & 0x007FE000)); // sign : normalized : denormalized
 
-    result = *(float *)&r;
+    memcpy(&result, &r, sizeof(float));
 
     return result;
 }
@@ -5054,7 +7032,9 @@ static unsigned short FloatToHalf(float x)
 {
     unsigned short result = 0;
 
-    const unsigned int b = (*(unsigned int*) & x) + 0x00001000; // Round-to-nearest-even: add last bit after truncated mantissa
+    unsigned int b = 0;
+    memcpy(&b, &x, sizeof(float));
+    b += 0x00001000; // Round-to-nearest-even: add last bit after truncated mantissa
     const unsigned int e = (b & 0x7F800000) >> 23; // Exponent
     const unsigned int m = b & 0x007FFFFF; // Mantissa; in line below: 0x007FF000 = 0x00800000-0x00001000 = decimal indicator flag - initial rounding
 
@@ -5063,140 +7043,2061 @@ static unsigned short FloatToHalf(float x)
     return result;
 }
 
-// Get pixel data from image as rl_Vector4 array (float normalized)
-static rl_Vector4 *LoadImageDataNormalized(rl_Image image)
+// Convert half-float values to float, batched (F16C/NEON if available)
+static void HalfToFloatData(const unsigned short *values, float *result, int count)
 {
-    rl_Vector4 *pixels = (rl_Vector4 *)RL_MALLOC(image.width*image.height*sizeof(rl_Vector4));
+    int i = 0;
 
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
-    else
-    {
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
-        {
-            switch (image.format)
+#if defined(HALF_FLOAT_F16C)
+    for (; (i + 8) <= count; i += 8) _mm256_storeu_ps(result + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(values + i))));
+#elif defined(HALF_FLOAT_NEON)
+    for (; (i + 4) <= count; i += 4) vst1q_f32(result + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(values + i))));
+#endif
+
+    for (; i < count; i++) result[i] = HalfToFloat(values[i]);
+}
+
+// Convert float values to half-float, batched (F16C/NEON if available)
+static void FloatToHalfData(const float *values, unsigned short *result, int count)
+{
+    int i = 0;
+
+#if defined(HALF_FLOAT_F16C)
+    for (; (i + 8) <= count; i += 8) _mm_storeu_si128((__m128i *)(result + i), _mm256_cvtps_ph(_mm256_loadu_ps(values + i), _MM_FROUND_TO_NEAREST_INT));
+#elif defined(HALF_FLOAT_NEON)
+    for (; (i + 4) <= count; i += 4) vst1_u16(result + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(values + i))));
+#endif
+
+    for (; i < count; i++) result[i] = FloatToHalf(values[i]);
+}
+
+// Get 32bit float format equivalent for float and half-float formats (0 for other formats)
+static int GetImageFloatFormat(int format)
+{
+    int floatFormat = 0;
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        case PIXELFORMAT_UNCOMPRESSED_R16: floatFormat = PIXELFORMAT_UNCOMPRESSED_R32; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16: floatFormat = PIXELFORMAT_UNCOMPRESSED_R32G32B32; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: floatFormat = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32; break;
+        default: break;
+    }
+
+    return floatFormat;
+}
+
+// Get float and half-float image pixels range as rl_Vector4 values, values are not clamped
+// NOTE: Single channel is returned as (value, 0, 0, 1), alpha is 1.0f for formats without alpha
+static void GetImagePixelsFloat(rl_Image image, int offset, int count, rl_Vector4 *pixels)
+{
+    #define IMAGE_PIXELS_BATCH  256     // Half-float pixels converted per batch
+
+    int floatFormat = GetImageFloatFormat(image.format);
+    if (floatFormat == 0) return;
+
+    int channels = rl_GetPixelDataSize(1, 1, floatFormat)/sizeof(float);
+    bool half = (floatFormat != image.format);
+    float values[IMAGE_PIXELS_BATCH*4] = { 0 };
+
+    for (int start = 0; start < count; start += IMAGE_PIXELS_BATCH)
+    {
+        int batch = ((count - start) < IMAGE_PIXELS_BATCH)? (count - start) : IMAGE_PIXELS_BATCH;
+        const float *src = values;
+
+        if (half) HalfToFloatData((const unsigned short *)image.data + (size_t)(offset + start)*channels, values, batch*channels);
+        else src = (const float *)image.data + (size_t)(offset + start)*channels;
+
+        rl_Vector4 *dst = pixels + start;
+
+        switch (channels)
+        {
+            case 1: for (int i = 0; i < batch; i++) dst[i] = (rl_Vector4){ src[i], 0.0f, 0.0f, 1.0f }; break;
+            case 3: for (int i = 0; i < batch; i++) dst[i] = (rl_Vector4){ src[i*3], src[i*3 + 1], src[i*3 + 2], 1.0f }; break;
+            case 4: memcpy(dst, src, batch*sizeof(rl_Vector4)); break;
+            default: break;
+        }
+    }
+}
+
+// Set float and half-float image pixels range from rl_Vector4 values
+// NOTE: Single channel is set from x component, alpha is ignored for formats without alpha
+static void SetImagePixelsFloat(rl_Image *image, int offset, int count, const rl_Vector4 *pixels)
+{
+    int floatFormat = GetImageFloatFormat(image->format);
+    if (floatFormat == 0) return;
+
+    int channels = rl_GetPixelDataSize(1, 1, floatFormat)/sizeof(float);
+    bool half = (floatFormat != image->format);
+    float values[IMAGE_PIXELS_BATCH*4] = { 0 };
+
+    for (int start = 0; start < count; start += IMAGE_PIXELS_BATCH)
+    {
+        int batch = ((count - start) < IMAGE_PIXELS_BATCH)? (count - start) : IMAGE_PIXELS_BATCH;
+        float *dst = half? values : ((float *)image->data + (size_t)(offset + start)*channels);
+        const rl_Vector4 *src = pixels + start;
+
+        switch (channels)
+        {
+            case 1: for (int i = 0; i < batch; i++) dst[i] = src[i].x; break;
+            case 3:
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                for (int i = 0; i < batch; i++)
                 {
-                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].w = 1.0f;
+                    dst[i*3] = src[i].x;
+                    dst[i*3 + 1] = src[i].y;
+                    dst[i*3 + 2] = src[i].z;
+                }
+            } break;
+            case 4: memcpy(dst, src, batch*sizeof(rl_Vector4)); break;
+            default: break;
+        }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+        if (half) FloatToHalfData(values, (unsigned short *)image->data + (size_t)(offset + start)*channels, batch*channels);
+    }
+}
 
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+// Get image modified regions tracker (NULL if image is not tracked)
+static ImageDirtyTracker *GetImageDirtyTracker(const void *data)
+{
+    if ((imageTrackerCount == 0) || (data == NULL)) return NULL;
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
-                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
-                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+    for (int i = 0; i < MAX_IMAGE_TEXTURES; i++)
+    {
+        if (imageTrackers[i].data == data) return &imageTrackers[i];
+    }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+    return NULL;
+}
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
-                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
-                    pixels[i].w = 1.0f;
+// Set image region as modified, regions are coalesced
+// NOTE: Regions touching or overlapping are merged, also regions close enough to waste less
+// than IMAGE_DIRTY_MERGE_PIXELS on merging, when regions limit is reached the region
+// growing less on merging is used
+static void SetImageDirtyRec(const rl_Image *image, int x, int y, int width, int height)
+{
+    #define IMAGE_DIRTY_MERGE_PIXELS    1024    // Pixels allowed to be uploaded not modified when merging regions
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+    ImageDirtyTracker *tracker = GetImageDirtyTracker(image->data);
+    if (tracker == NULL) return;
 
-                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
-                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
-                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
-                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+    // Clip region to image bounds
+    if (x < 0) { width += x; x = 0; }
+    if (y < 0) { height += y; y = 0; }
+    if ((x + width) > tracker->width) width = tracker->width - x;
+    if ((y + height) > tracker->height) height = tracker->height - y;
+    if ((width <= 0) || (height <= 0)) return;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+    ImageDirtyRec rec = { x, y, width, height };
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = 1.0f;
+    // Check if region is already modified (most common case on consecutive drawing)
+    for (int i = 0; i < tracker->recCount; i++)
+    {
+        ImageDirtyRec *other = &tracker->recs[i];
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
+        if ((rec.x >= other->x) && (rec.y >= other->y) && ((rec.x + rec.width) <= (other->x + other->width)) &&
+            ((rec.y + rec.height) <= (other->y + other->height))) return;
+    }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = 1.0f;
+    // Merge region with modified regions, merged region is checked again with all regions
+    for (int i = 0; i < tracker->recCount; i++)
+    {
+        ImageDirtyRec *other = &tracker->recs[i];
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = ((float *)image.data)[k + 3];
+        int minX = (rec.x < other->x)? rec.x : other->x;
+        int minY = (rec.y < other->y)? rec.y : other->y;
+        int maxX = ((rec.x + rec.width) > (other->x + other->width))? (rec.x + rec.width) : (other->x + other->width);
+        int maxY = ((rec.y + rec.height) > (other->y + other->height))? (rec.y + rec.height) : (other->y + other->height);
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
+        bool touching = (rec.x <= (other->x + other->width)) && (other->x <= (rec.x + rec.width)) &&
+                        (rec.y <= (other->y + other->height)) && (other->y <= (rec.y + rec.height));
+        int wasted = (maxX - minX)*(maxY - minY) - rec.width*rec.height - other->width*other->height;
+
+        if (touching || (wasted <= IMAGE_DIRTY_MERGE_PIXELS))
+        {
+            rec = (ImageDirtyRec){ minX, minY, maxX - minX, maxY - minY };
+
+            tracker->recs[i] = tracker->recs[tracker->recCount - 1];
+            tracker->recCount--;
+            i = -1;
+        }
+    }
+
+    if (tracker->recCount == MAX_IMAGE_DIRTY_RECS)
+    {
+        // Regions limit reached, merge with the region growing less
+        int best = 0;
+        int bestGrowth = 0;
+
+        for (int i = 0; i < tracker->recCount; i++)
+        {
+            ImageDirtyRec *other = &tracker->recs[i];
+
+            int minX = (rec.x < other->x)? rec.x : other->x;
+            int minY = (rec.y < other->y)? rec.y : other->y;
+            int maxX = ((rec.x + rec.width) > (other->x + other->width))? (rec.x + rec.width) : (other->x + other->width);
+            int maxY = ((rec.y + rec.height) > (other->y + other->height))? (rec.y + rec.height) : (other->y + other->height);
+            int growth = (maxX - minX)*(maxY - minY) - other->width*other->height;
+
+            if ((i == 0) || (growth < bestGrowth))
+            {
+                best = i;
+                bestGrowth = growth;
+            }
+        }
+
+        ImageDirtyRec *other = &tracker->recs[best];
+        int minX = (rec.x < other->x)? rec.x : other->x;
+        int minY = (rec.y < other->y)? rec.y : other->y;
+        int maxX = ((rec.x + rec.width) > (other->x + other->width))? (rec.x + rec.width) : (other->x + other->width);
+        int maxY = ((rec.y + rec.height) > (other->y + other->height))? (rec.y + rec.height) : (other->y + other->height);
+
+        *other = (ImageDirtyRec){ minX, minY, maxX - minX, maxY - minY };
+    }
+    else tracker->recs[tracker->recCount++] = rec;
+}
+
+// Blend color over image pixels span, coverage per pixel (optional)
+// NOTE: Source-over alpha compositing (straight alpha), span must be inside image bounds
+static void ImageBlendSpan(rl_Image *dst, int x, int y, int count, const unsigned char *coverage, rl_Color color)
+{
+    if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) return;
+
+    if (imageTrackerCount > 0) SetImageDirtyRec(dst, x, y, count, 1);
+
+    switch (dst->format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            unsigned char *pixel = (unsigned char *)dst->data + (y*dst->width + x)*4;
+
+            for (int i = 0; i < count; i++, pixel += 4)
+            {
+                int alpha = (coverage == NULL)? color.a : (color.a*coverage[i] + 127)/255;
+
+                if (alpha == 255)
                 {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+                    pixel[0] = color.r;
+                    pixel[1] = color.g;
+                    pixel[2] = color.b;
+                    pixel[3] = 255;
+                }
+                else if (alpha > 0)
                 {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
-                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
-                    pixels[i].w = 1.0f;
+                    // Destination weight and resulting alpha, scaled by 255
+                    int dstWeight = pixel[3]*(255 - alpha);
+                    int outAlpha = alpha*255 + dstWeight;
+
+                    pixel[0] = (unsigned char)((color.r*alpha*255 + pixel[0]*dstWeight + outAlpha/2)/outAlpha);
+                    pixel[1] = (unsigned char)((color.g*alpha*255 + pixel[1]*dstWeight + outAlpha/2)/outAlpha);
+                    pixel[2] = (unsigned char)((color.b*alpha*255 + pixel[2]*dstWeight + outAlpha/2)/outAlpha);
+                    pixel[3] = (unsigned char)((outAlpha + 127)/255);
+                }
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            unsigned char *pixel = (unsigned char *)dst->data + (y*dst->width + x)*3;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+            for (int i = 0; i < count; i++, pixel += 3)
+            {
+                int alpha = (coverage == NULL)? color.a : (color.a*coverage[i] + 127)/255;
+
+                pixel[0] = (unsigned char)((color.r*alpha + pixel[0]*(255 - alpha) + 127)/255);
+                pixel[1] = (unsigned char)((color.g*alpha + pixel[1]*(255 - alpha) + 127)/255);
+                pixel[2] = (unsigned char)((color.b*alpha + pixel[2]*(255 - alpha) + 127)/255);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            // NOTE: Calculate grayscale equivalent color
+            int gray = (int)(((float)color.r/255.0f*0.299f + (float)color.g/255.0f*0.587f + (float)color.b/255.0f*0.114f)*255.0f);
+            int bytesPerPixel = (dst->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)? 1 : 2;
+            unsigned char *pixel = (unsigned char *)dst->data + (y*dst->width + x)*bytesPerPixel;
+
+            for (int i = 0; i < count; i++, pixel += bytesPerPixel)
+            {
+                int alpha = (coverage == NULL)? color.a : (color.a*coverage[i] + 127)/255;
+
+                if (bytesPerPixel == 1) pixel[0] = (unsigned char)((gray*alpha + pixel[0]*(255 - alpha) + 127)/255);
+                else if (alpha > 0)
                 {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
-                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
-                    pixels[i].w = HalfToFloat(((unsigned short *)image.data)[k + 3]);
+                    int dstWeight = pixel[1]*(255 - alpha);
+                    int outAlpha = alpha*255 + dstWeight;
 
-                    k += 4;
-                } break;
-                default: break;
+                    pixel[0] = (unsigned char)((gray*alpha*255 + pixel[0]*dstWeight + outAlpha/2)/outAlpha);
+                    pixel[1] = (unsigned char)((outAlpha + 127)/255);
+                }
             }
-        }
+        } break;
+        default:
+        {
+            // Other formats: read, blend and write every pixel
+            for (int i = 0; i < count; i++)
+            {
+                rl_Color src = color;
+                if (coverage != NULL) src.a = (unsigned char)((color.a*coverage[i] + 127)/255);
+
+                if (src.a == 255) rl_ImageDrawPixel(dst, x + i, y, src);
+                else if (src.a > 0) rl_ImageDrawPixel(dst, x + i, y, rl_ColorAlphaBlend(rl_GetImageColor(*dst, x + i, y), src, rl_WHITE));
+            }
+        } break;
     }
+}
 
-    return pixels;
+// Blend color over image pixel, out of bounds pixels are skipped
+static void ImageBlendPixel(rl_Image *dst, int x, int y, rl_Color color)
+{
+    if ((dst->data == NULL) || (x < 0) || (x >= dst->width) || (y < 0) || (y >= dst->height)) return;
+
+    ImageBlendSpan(dst, x, y, 1, NULL, color);
 }
 
+// Fill polygon within an image, anti-aliased (scanline coverage)
+// NOTE: Exact area coverage is accumulated per pixel for every polygon edge (signed area),
+// coverage is then integrated along every row and blended in spans, only polygon bounds are processed, by bands of rows
+static void ImageFillPolygon(rl_Image *dst, const rl_Vector2 *points, int pointCount, rl_Color color)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) || (points == NULL) || (pointCount < 3)) return;
+    if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) { TRACELOG(LOG_WARNING, "rl_Image drawing not supported for compressed formats"); return; }
+
+    // Get polygon bounds, clipped to image
+    float minX = points[0].x, maxX = points[0].x;
+    float minY = points[0].y, maxY = points[0].y;
+
+    for (int i = 1; i < pointCount; i++)
+    {
+        if (points[i].x < minX) minX = points[i].x;
+        if (points[i].x > maxX) maxX = points[i].x;
+        if (points[i].y < minY) minY = points[i].y;
+        if (points[i].y > maxY) maxY = points[i].y;
+    }
+
+    // NOTE: Polygons outside image are discarded before bounds conversion to integer, points can be far away
+    if (!(minX < (float)dst->width) || !(minY < (float)dst->height) || !(maxX > 0.0f) || !(maxY > 0.0f)) return;
+
+    int boundsX = (minX > 0.0f)? (int)minX : 0;
+    int boundsY = (minY > 0.0f)? (int)minY : 0;
+    int boundsWidth = ((maxX < (float)dst->width)? (int)ceilf(maxX) : dst->width) - boundsX;
+    int boundsHeight = ((maxY < (float)dst->height)? (int)ceilf(maxY) : dst->height) - boundsY;
+
+    if ((boundsWidth <= 0) || (boundsHeight <= 0)) return;
+
+    // Coverage accumulation buffer for a band of rows, two extra columns for edges contributions to the right
+    // NOTE: Columns range touched by edges is tracked per row, coverage is only integrated in that range,
+    // rows are processed by bands fitting the stack buffer, bands are blended as they complete,
+    // very wide polygons allocate a buffer for IMAGE_POLYGON_BAND_ROWS rows (image drawing stays reentrant)
+    int stride = boundsWidth + 2;
+    size_t rowSize = (size_t)stride*sizeof(float) + 2*sizeof(int);
+
+    float stackBuffer[IMAGE_POLYGON_STACK_BUFFER_SIZE/sizeof(float)];
+    unsigned char *buffer = (unsigned char *)stackBuffer;
+    int bandRows = (sizeof(stackBuffer) > (size_t)boundsWidth)? (int)((sizeof(stackBuffer) - boundsWidth)/rowSize) : 0;
+
+    if (bandRows < 1)
+    {
+        bandRows = IMAGE_POLYGON_BAND_ROWS;
+        buffer = (unsigned char *)RL_MALLOC(rowSize*bandRows + boundsWidth);
+
+        if (buffer == NULL)
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Failed to allocate polygon filling buffer");
+            return;
+        }
+    }
+
+    if (bandRows > boundsHeight) bandRows = boundsHeight;
+
+    float *accum = (float *)buffer;
+    int *rowMin = (int *)(buffer + (size_t)stride*bandRows*sizeof(float));
+    int *rowMax = rowMin + bandRows;
+    unsigned char *coverage = (unsigned char *)(rowMax + bandRows);
+
+    for (int bandY = 0; bandY < boundsHeight; bandY += bandRows)
+    {
+        int bandEnd = ((bandY + bandRows) < boundsHeight)? (bandY + bandRows) : boundsHeight;
+
+        memset(accum, 0, (size_t)stride*bandRows*sizeof(float));
+
+        for (int y = 0; y < bandRows; y++)
+        {
+            rowMin[y] = stride;
+            rowMax[y] = 0;
+        }
+
+        for (int i = 0; i < pointCount; i++)
+        {
+            rl_Vector2 p0 = { points[i].x - boundsX, points[i].y - boundsY };
+            rl_Vector2 p1 = { points[(i + 1)%pointCount].x - boundsX, points[(i + 1)%pointCount].y - boundsY };
+
+            if (p0.y == p1.y) continue;
+
+            // Edges are processed top to bottom, direction is the coverage sign
+            float dir = 1.0f;
+            if (p0.y > p1.y) { rl_Vector2 temp = p0; p0 = p1; p1 = temp; dir = -1.0f; }
+
+            // Edges not crossing band rows are skipped
+            if ((p1.y <= (float)bandY) || (p0.y >= (float)bandEnd)) continue;
+
+            // Split edge at bounds left (x = 0) and right (x = boundsWidth) sides:
+            // parts on the left are projected to x = 0, parts on the right don't cover pixels inside bounds
+            float splits[4] = { 0.0f, 1.0f, 1.0f, 1.0f };
+            int splitCount = 1;
+            float dx = p1.x - p0.x;
+
+            if (dx != 0.0f)
+            {
+                float t0 = (0.0f - p0.x)/dx;
+                float t1 = ((float)boundsWidth - p0.x)/dx;
+                if (t0 > t1) { float temp = t0; t0 = t1; t1 = temp; }
+                if ((t0 > 0.0f) && (t0 < 1.0f)) splits[splitCount++] = t0;
+                if ((t1 > 0.0f) && (t1 < 1.0f)) splits[splitCount++] = t1;
+            }
+            splits[splitCount] = 1.0f;
+
+            for (int s = 0; s < splitCount; s++)
+            {
+                rl_Vector2 a = { p0.x + dx*splits[s], p0.y + (p1.y - p0.y)*splits[s] };
+                rl_Vector2 b = { p0.x + dx*splits[s + 1], p0.y + (p1.y - p0.y)*splits[s + 1] };
+                float midX = (a.x + b.x)*0.5f;
+
+                // Parts above or below band don't cover pixels inside band
+                if ((b.y <= (float)bandY) || (a.y >= (float)bandEnd)) continue;
+
+                int startY = (a.y > (float)bandY)? (int)a.y : bandY;
+                int endY = (b.y < (float)bandEnd)? (int)ceilf(b.y) : bandEnd;
+
+                if (midX >= (float)boundsWidth)
+                {
+                    // Part on the right: coverage of its rows must be integrated up to bounds right side
+                    for (int y = startY; y < endY; y++) rowMax[y - bandY] = stride;
+                    continue;
+                }
+                if (midX <= 0.0f) { a.x = 0.0f; b.x = 0.0f; }
+                if (a.x < 0.0f) a.x = 0.0f;
+                if (b.x < 0.0f) b.x = 0.0f;
+
+                if (b.y <= a.y) continue;
+                float dxdy = (b.x - a.x)/(b.y - a.y);
+
+                // Edge position at first band row processed
+                float x = a.x;
+                if (a.y < (float)startY) x += ((float)startY - a.y)*dxdy;
+
+                for (int y = startY; y < endY; y++)
+                {
+                    float *row = accum + (y - bandY)*stride;
+                    float dy = (((float)(y + 1) < b.y)? (float)(y + 1) : b.y) - (((float)y > a.y)? (float)y : a.y);
+                    float nextX = x + dxdy*dy;
+                    float d = dy*dir;
+
+                    float x0 = (x < nextX)? x : nextX;
+                    float x1 = (x < nextX)? nextX : x;
+                    if (x0 < 0.0f) x0 = 0.0f;
+                    if (x1 > (float)boundsWidth) x1 = (float)boundsWidth;
+                    if (x1 < x0) x1 = x0;
+
+                    float x0floor = floorf(x0);
+                    int x0i = (int)x0floor;
+                    float x1ceil = ceilf(x1);
+                    int x1i = (int)x1ceil;
+
+                    if (x0i < rowMin[y - bandY]) rowMin[y - bandY] = x0i;
+                    if ((x1i + 1) > rowMax[y - bandY]) rowMax[y - bandY] = x1i + 1;
+
+                    if (x1i <= x0i + 1)
+                    {
+                        // Edge inside one pixel column: trapezoid area
+                        float xmf = 0.5f*(x0 + x1) - x0floor;
+                        row[x0i] += d - d*xmf;
+                        row[x0i + 1] += d*xmf;
+                    }
+                    else
+                    {
+                        // Edge crossing several pixel columns: area distributed along columns
+                        float invWidth = 1.0f/(x1 - x0);
+                        float x0f = x0 - x0floor;
+                        float a0 = 0.5f*invWidth*(1.0f - x0f)*(1.0f - x0f);
+                        float x1f = x1 - x1ceil + 1.0f;
+                        float am = 0.5f*invWidth*x1f*x1f;
+
+                        row[x0i] += d*a0;
+
+                        if (x1i == x0i + 2) row[x0i + 1] += d*(1.0f - a0 - am);
+                        else
+                        {
+                            float a1 = invWidth*(1.5f - x0f);
+                            row[x0i + 1] += d*(a1 - a0);
+                            for (int xi = x0i + 2; xi < x1i - 1; xi++) row[xi] += d*invWidth;
+                            float a2 = a1 + (float)(x1i - x0i - 3)*invWidth;
+                            row[x1i - 1] += d*(1.0f - a2 - am);
+                        }
+
+                        row[x1i] += d*am;
+                    }
+
+                    x = nextX;
+                }
+            }
+        }
+
+        // Integrate band coverage along rows, blending covered spans
+        for (int y = 0; y < (bandEnd - bandY); y++)
+        {
+            float *row = accum + y*stride;
+            float sum = 0.0f;
+            int spanStart = -1;
+            int endX = (rowMax[y] < boundsWidth)? rowMax[y] : boundsWidth;
+
+            for (int x = rowMin[y]; x <= endX; x++)
+            {
+                int value = 0;
+
+                if (x < endX)
+                {
+                    sum += row[x];
+                    float area = fabsf(sum);
+                    value = (area >= 1.0f)? 255 : (int)(area*255.0f + 0.5f);
+                    coverage[x] = (unsigned char)value;
+                }
+
+                if ((value > 0) && (spanStart < 0)) spanStart = x;
+                else if ((value == 0) && (spanStart >= 0))
+                {
+                    ImageBlendSpan(dst, boundsX + spanStart, boundsY + bandY + y, x - spanStart, coverage + spanStart, color);
+                    spanStart = -1;
+                }
+            }
+        }
+    }
+
+    if (buffer != (unsigned char *)stackBuffer) RL_FREE(buffer);
+}
+
+// Load image async job, run on loader threads
+static void LoadImageAsyncJob(void *userData)
+{
+    ImageAsyncLoad *load = (ImageAsyncLoad *)userData;
+
+    load->image = rl_LoadImage(load->fileName);
+}
+
+// Convert image pixels range to RGBA 32bit colors
+// NOTE: Range starts at pixel offset, compressed formats are not supported
+static void ConvertImageColors(rl_Image image, int offset, int count, rl_Color *pixels)
+{
+    const unsigned char *bytes = (const unsigned char *)image.data;
+    const unsigned short *shorts = (const unsigned short *)image.data;
+    const float *floats = (const float *)image.data;
+
+    switch (image.format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+            for (int i = 0, k = offset; i < count; i++, k++) pixels[i] = (rl_Color){ bytes[k], bytes[k], bytes[k], 255 };
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            for (int i = 0, k = offset*2; i < count; i++, k += 2) pixels[i] = (rl_Color){ bytes[k], bytes[k], bytes[k], bytes[k + 1] };
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                unsigned short pixel = shorts[offset + i];
+
+                pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
+                pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
+                pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                unsigned short pixel = shorts[offset + i];
+
+                pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
+                pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
+                pixels[i].a = 255;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                unsigned short pixel = shorts[offset + i];
+
+                pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
+                pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
+                pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
+                pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy(pixels, bytes + (size_t)offset*4, (size_t)count*4); break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            for (int i = 0, k = offset*3; i < count; i++, k += 3) pixels[i] = (rl_Color){ bytes[k], bytes[k + 1], bytes[k + 2], 255 };
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            for (int i = 0, k = offset; i < count; i++, k++) pixels[i] = (rl_Color){ (unsigned char)(floats[k]*255.0f), 0, 0, 255 };
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            for (int i = 0, k = offset*3; i < count; i++, k += 3)
+            {
+                pixels[i] = (rl_Color){ (unsigned char)(floats[k]*255.0f), (unsigned char)(floats[k + 1]*255.0f), (unsigned char)(floats[k + 2]*255.0f), 255 };
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            for (int i = 0, k = offset*4; i < count; i++, k += 4)
+            {
+                pixels[i] = (rl_Color){ (unsigned char)(floats[k]*255.0f), (unsigned char)(floats[k + 1]*255.0f), (unsigned char)(floats[k + 2]*255.0f), (unsigned char)(floats[k + 3]*255.0f) };
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        {
+            for (int i = 0, k = offset; i < count; i++, k++) pixels[i] = (rl_Color){ (unsigned char)(HalfToFloat(shorts[k])*255.0f), 0, 0, 255 };
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        {
+            for (int i = 0, k = offset*3; i < count; i++, k += 3)
+            {
+                pixels[i] = (rl_Color){ (unsigned char)(HalfToFloat(shorts[k])*255.0f), (unsigned char)(HalfToFloat(shorts[k + 1])*255.0f), (unsigned char)(HalfToFloat(shorts[k + 2])*255.0f), 255 };
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            for (int i = 0, k = offset*4; i < count; i++, k += 4)
+            {
+                pixels[i] = (rl_Color){ (unsigned char)(HalfToFloat(shorts[k])*255.0f), (unsigned char)(HalfToFloat(shorts[k + 1])*255.0f), (unsigned char)(HalfToFloat(shorts[k + 2])*255.0f), (unsigned char)(HalfToFloat(shorts[k + 3])*255.0f) };
+            }
+        } break;
+        default: break;
+    }
+}
+
+// Get image row pixels for resizer (stb_image_resize2 input callback), converted to RGBA 32bit
+static const void *GetImageResizeRow(void *buffer, const void *data, int count, int x, int y, void *userData)
+{
+    rl_Image *image = (rl_Image *)userData;
+
+    ConvertImageColors(*image, y*image->width + x, count, (rl_Color *)buffer);
+
+    return buffer;
+}
+
+// Check image file extension, case insensitive (thread-safe)
+// NOTE: rl_IsFileExtension() uses rl_TextToLower() static buffers, it can not be used from loader threads
+static bool IsImageFileExtension(const char *fileName, const char *ext)
+{
+    const char *fileExt = rl_GetFileExtension(fileName);
+    if (fileExt == NULL) return false;
+
+    int i = 0;
+    for (; (fileExt[i] != '\0') && (ext[i] != '\0'); i++)
+    {
+        char c = ((fileExt[i] >= 'A') && (fileExt[i] <= 'Z'))? fileExt[i] + ('a' - 'A') : fileExt[i];
+        if (c != ext[i]) return false;
+    }
+
+    return ((fileExt[i] == '\0') && (ext[i] == '\0'));
+}
+
+// Update image with colors view edited, converted back to image format if required
+// NOTE: Colors view is loaded with rl_LoadImageColorsView(), RGBA 32bit images are edited in place,
+// full image is set as modified, converted image data could be allocated at the same address
+static void UpdateImageColors(rl_Image *image, rl_Color *pixels)
+{
+    if ((void *)pixels != image->data)
+    {
+        int format = image->format;
+        RL_FREE(image->data);
+
+        image->data = pixels;
+        image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+        rl_ImageFormat(image, format);
+    }
+
+    SetImageDirtyRec(image, 0, 0, image->width, image->height);
+}
+
+// Get image row alpha values, returned with stride between values
+// NOTE: 8bit alpha formats are returned in place, other formats alpha is converted into buffer
+// (image width size), formats without alpha are fully opaque
+static const unsigned char *GetImageAlphaRow(rl_Image image, int y, unsigned char *buffer, int *stride)
+{
+    const unsigned char *alpha = buffer;
+    *stride = 1;
+
+    switch (image.format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            alpha = (const unsigned char *)image.data + (size_t)y*image.width*2 + 1;
+            *stride = 2;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            alpha = (const unsigned char *)image.data + (size_t)y*image.width*4 + 3;
+            *stride = 4;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            for (int x = 0; x < image.width; x++) buffer[x] = rl_GetImageColor(image, x, y).a;
+        } break;
+        default: memset(buffer, 255, image.width); break;
+    }
+
+    return alpha;
+}
+
+// Find image alpha run root (region), tree paths are halved while searching
+static int FindImageAlphaRun(ImageAlphaRun *runs, int index)
+{
+    while (runs[index].parent != index)
+    {
+        runs[index].parent = runs[runs[index].parent].parent;
+        index = runs[index].parent;
+    }
+
+    return index;
+}
+
+// Process image rows by bands on loader threads
+// NOTE: Calling thread processes the last band, then waits for the other bands
+static void ProcessImageRows(void (*process)(void *data, int startY, int endY), void *data, int height)
+{
+    #define IMAGE_ROWS_BAND_HEIGHT  64      // Minimum rows per band
+    #define MAX_IMAGE_ROWS_BANDS    32      // Maximum bands per image
+
+    int bandCount = (height + IMAGE_ROWS_BAND_HEIGHT - 1)/IMAGE_ROWS_BAND_HEIGHT;
+    if (bandCount > MAX_IMAGE_ROWS_BANDS) bandCount = MAX_IMAGE_ROWS_BANDS;
+    if (bandCount < 1) bandCount = 1;
+
+    ImageRowsBand bands[MAX_IMAGE_ROWS_BANDS] = { 0 };
+    int jobIds[MAX_IMAGE_ROWS_BANDS] = { 0 };
+
+    for (int i = 0; i < bandCount; i++)
+    {
+        bands[i].process = process;
+        bands[i].data = data;
+        bands[i].startY = (int)((long long)height*i/bandCount);
+        bands[i].endY = (int)((long long)height*(i + 1)/bandCount);
+
+        // NOTE: Bands not queued (loader queue full) are processed on calling thread
+        jobIds[i] = (i < (bandCount - 1))? AddLoaderJob(ProcessImageRowsJob, &bands[i]) : -1;
+        if (jobIds[i] < 0) ProcessImageRowsJob(&bands[i]);
+    }
+
+    for (int i = 0; i < bandCount; i++) if (jobIds[i] >= 0) WaitLoaderJob(jobIds[i]);
+}
+
+// Process image rows band job, run on loader threads
+static void ProcessImageRowsJob(void *userData)
+{
+    ImageRowsBand *band = (ImageRowsBand *)userData;
+
+    band->process(band->data, band->startY, band->endY);
+}
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Warp image with inverse affine transform, bilinear filtered
+// NOTE: Destination pixels mapped out of source image are left transparent (zero)
+static void ImageWarp(rl_Image *image, int width, int height, const float *m)
+{
+    int format = image->format;
+    bool floatChannels = ((format == PIXELFORMAT_UNCOMPRESSED_R32) || (format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) || (format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32));
+
+    // Packed and half float formats are warped as 8bit or float channels and converted back
+    if (!floatChannels && (format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) &&
+        (format != PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+        bool halfChannels = ((format == PIXELFORMAT_UNCOMPRESSED_R16) || (format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) || (format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16));
+
+        rl_ImageFormat(image, halfChannels? PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 : PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        ImageWarp(image, width, height, m);
+        rl_ImageFormat(image, format);
+        return;
+    }
+
+    ImageWarpData warp = { 0 };
+    warp.image = *image;
+    warp.data = (unsigned char *)RL_CALLOC(width*height, rl_GetPixelDataSize(1, 1, format));
+    warp.width = width;
+    warp.height = height;
+    for (int i = 0; i < 6; i++) warp.m[i] = m[i];
+
+    ProcessImageRows(floatChannels? ImageWarpRowsFloat : ImageWarpRows, &warp, height);
+
+    RL_FREE(image->data);
+    image->data = warp.data;
+    image->width = width;
+    image->height = height;
+}
+
+// Warp image rows, 8bit channels
+// NOTE: Source position is stepped incrementally in 16.16 fixed point along the row,
+// bilinear weights use 8bit fractions, neighbor pixels are clamped to image borders
+static void ImageWarpRows(void *data, int startY, int endY)
+{
+    const ImageWarpData *warp = (const ImageWarpData *)data;
+    const unsigned char *src = (const unsigned char *)warp->image.data;
+    int srcWidth = warp->image.width;
+    int srcHeight = warp->image.height;
+    int channels = rl_GetPixelDataSize(1, 1, warp->image.format);
+
+    long long maxU = (long long)srcWidth << 16;
+    long long maxV = (long long)srcHeight << 16;
+    long long du = (long long)(warp->m[0]*65536.0f);
+    long long dv = (long long)(warp->m[3]*65536.0f);
+
+    for (int y = startY; y < endY; y++)
+    {
+        unsigned char *dst = warp->data + (size_t)y*warp->width*channels;
+
+        // NOTE: Row start is computed in floating point to avoid accumulating error along image height
+        long long u = (long long)floor(((double)warp->m[1]*y + warp->m[2])*65536.0);
+        long long v = (long long)floor(((double)warp->m[4]*y + warp->m[5])*65536.0);
+
+        for (int x = 0; x < warp->width; x++, u += du, v += dv, dst += channels)
+        {
+            if ((u < 0) || (u >= maxU) || (v < 0) || (v >= maxV)) continue;
+
+            int x1 = (int)(u >> 16);
+            int y1 = (int)(v >> 16);
+            int fx = (int)(u >> 8) & 0xff;
+            int fy = (int)(v >> 8) & 0xff;
+            int offsetX = (x1 < (srcWidth - 1))? channels : 0;
+            int offsetY = (y1 < (srcHeight - 1))? srcWidth*channels : 0;
+
+            const unsigned char *p = src + ((size_t)y1*srcWidth + x1)*channels;
+
+            for (int i = 0; i < channels; i++)
+            {
+                int top = p[i]*(256 - fx) + p[i + offsetX]*fx;
+                int bottom = p[i + offsetY]*(256 - fx) + p[i + offsetY + offsetX]*fx;
+
+                dst[i] = (unsigned char)((top*(256 - fy) + bottom*fy + 32768) >> 16);
+            }
+        }
+    }
+}
+
+// Warp image rows, 32bit float channels
+static void ImageWarpRowsFloat(void *data, int startY, int endY)
+{
+    const ImageWarpData *warp = (const ImageWarpData *)data;
+    const float *src = (const float *)warp->image.data;
+    int srcWidth = warp->image.width;
+    int srcHeight = warp->image.height;
+    int channels = rl_GetPixelDataSize(1, 1, warp->image.format)/4;
+
+    for (int y = startY; y < endY; y++)
+    {
+        float *dst = (float *)warp->data + (size_t)y*warp->width*channels;
+        float rowU = warp->m[1]*y + warp->m[2];
+        float rowV = warp->m[4]*y + warp->m[5];
+
+        for (int x = 0; x < warp->width; x++, dst += channels)
+        {
+            float u = warp->m[0]*x + rowU;
+            float v = warp->m[3]*x + rowV;
+
+            if ((u < 0.0f) || (u >= (float)srcWidth) || (v < 0.0f) || (v >= (float)srcHeight)) continue;
+
+            int x1 = (int)u;
+            int y1 = (int)v;
+            float fx = u - (float)x1;
+            float fy = v - (float)y1;
+            int offsetX = (x1 < (srcWidth - 1))? channels : 0;
+            int offsetY = (y1 < (srcHeight - 1))? srcWidth*channels : 0;
+
+            const float *p = src + ((size_t)y1*srcWidth + x1)*channels;
+
+            for (int i = 0; i < channels; i++)
+            {
+                float top = p[i] + (p[i + offsetX] - p[i])*fx;
+                float bottom = p[i + offsetY] + (p[i + offsetY + offsetX] - p[i + offsetY])*fx;
+
+                dst[i] = top + (bottom - top)*fy;
+            }
+        }
+    }
+}
+
+// Rotate pixel data 90deg, destination size is height x width
+// NOTE: Pixels are moved by square blocks so source and destination lines stay in cache
+static void ImageRotateData(const unsigned char *src, unsigned char *dst, int width, int height, int bytesPerPixel, bool clockwise)
+{
+    #define IMAGE_ROTATE_BLOCK_SIZE     32      // Block size in pixels
+
+    for (int by = 0; by < height; by += IMAGE_ROTATE_BLOCK_SIZE)
+    {
+        int endY = ((by + IMAGE_ROTATE_BLOCK_SIZE) < height)? (by + IMAGE_ROTATE_BLOCK_SIZE) : height;
+
+        for (int bx = 0; bx < width; bx += IMAGE_ROTATE_BLOCK_SIZE)
+        {
+            int endX = ((bx + IMAGE_ROTATE_BLOCK_SIZE) < width)? (bx + IMAGE_ROTATE_BLOCK_SIZE) : width;
+
+            for (int y = by; y < endY; y++)
+            {
+                const unsigned char *srcPixel = src + ((size_t)y*width + bx)*bytesPerPixel;
+
+                // Clockwise: source (x, y) moves to destination (height - 1 - y, x)
+                // Counter-clockwise: source (x, y) moves to destination (y, width - 1 - x)
+                long long dstIndex = clockwise? ((long long)bx*height + (height - 1 - y)) : ((long long)(width - 1 - bx)*height + y);
+                int dstStep = clockwise? height : -height;
+
+                switch (bytesPerPixel)
+                {
+                    case 1: for (int x = bx; x < endX; x++, srcPixel += 1, dstIndex += dstStep) dst[dstIndex] = *srcPixel; break;
+                    case 2: for (int x = bx; x < endX; x++, srcPixel += 2, dstIndex += dstStep) memcpy(dst + dstIndex*2, srcPixel, 2); break;
+                    case 4: for (int x = bx; x < endX; x++, srcPixel += 4, dstIndex += dstStep) memcpy(dst + dstIndex*4, srcPixel, 4); break;
+                    default: for (int x = bx; x < endX; x++, srcPixel += bytesPerPixel, dstIndex += dstStep) memcpy(dst + dstIndex*bytesPerPixel, srcPixel, bytesPerPixel); break;
+                }
+            }
+        }
+    }
+}
+
+#endif      // SUPPORT_IMAGE_MANIPULATION
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Generate perlin noise image rows
+static void GenImagePerlinNoiseRows(void *data, int startY, int endY)
+{
+    const ImageNoiseData *noise = (const ImageNoiseData *)data;
+    rl_Color *pixels = (rl_Color *)noise->image.data;
+    int width = noise->image.width;
+
+    float factorX = noise->cellsX/(float)width;
+    float factorY = noise->cellsY/(float)noise->image.height;
+
+    for (int y = startY; y < endY; y++)
+    {
+        float ny = (float)(y + noise->offsetY)*factorY;
+
+        for (int x = 0; x < width; x++)
+        {
+            float nx = (float)(x + noise->offsetX)*factorX;
+
+            // Basic perlin noise implementation (not used)
+            //float p = (stb_perlin_noise3(nx, ny, 0.0f, 0, 0, 0);
+
+            // Calculate a better perlin noise using fbm (fractal brownian motion)
+            // Typical values to start playing with:
+            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
+            //   gain       =  0.5   -- relative weighting applied to each successive octave
+            //   octaves    =  6     -- number of "octaves" of noise3() to sum
+            float p = stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, noise->octaves);
+
+            // Clamp between -1.0f and 1.0f
+            if (p < -1.0f) p = -1.0f;
+            if (p > 1.0f) p = 1.0f;
+
+            // We need to normalize the data from [-1..1] to [0..1]
+            float np = (p + 1.0f)/2.0f;
+
+            int intensity = (int)(np*255.0f);
+            pixels[y*width + x] = (rl_Color){ intensity, intensity, intensity, 255 };
+        }
+    }
+}
+
+// Generate cellular image rows
+static void GenImageCellularRows(void *data, int startY, int endY)
+{
+    const ImageCellularData *cellular = (const ImageCellularData *)data;
+    int tileSize = cellular->tileSize;
+
+    for (int y = startY; y < endY; y++)
+    {
+        int tileY = y/tileSize;
+
+        for (int x = 0; x < cellular->width; x++)
+        {
+            int tileX = x/tileSize;
+
+            // NOTE: Seeds positions are integers, squared distances are compared exactly
+            int minDistanceSqr = -1;
+
+            // Check all adjacent tiles
+            for (int i = -1; i < 2; i++)
+            {
+                if ((tileX + i < 0) || (tileX + i >= cellular->seedsPerRow)) continue;
+
+                for (int j = -1; j < 2; j++)
+                {
+                    if ((tileY + j < 0) || (tileY + j >= cellular->seedsPerCol)) continue;
+
+                    rl_Vector2 neighborSeed = cellular->seeds[(tileY + j)*cellular->seedsPerRow + tileX + i];
+
+                    int dx = x - (int)neighborSeed.x;
+                    int dy = y - (int)neighborSeed.y;
+                    if ((minDistanceSqr < 0) || ((dx*dx + dy*dy) < minDistanceSqr)) minDistanceSqr = dx*dx + dy*dy;
+                }
+            }
+
+            float minDistance = (minDistanceSqr >= 0)? (float)sqrt((double)minDistanceSqr) : 65536.0f;
+
+            // I made this up, but it seems to give good results at all tile sizes
+            int intensity = (int)(minDistance*256.0f/tileSize);
+            if (intensity > 255) intensity = 255;
+
+            cellular->pixels[y*cellular->width + x] = (rl_Color){ intensity, intensity, intensity, 255 };
+        }
+    }
+}
+
+// Generate noise image rows
+static void GenImageNoiseRows(void *data, int startY, int endY)
+{
+    const ImageNoiseData *noise = (const ImageNoiseData *)data;
+    int width = noise->image.width;
+    int height = noise->image.height;
+
+    float factorX = noise->cellsX/(float)width;
+    float factorY = noise->cellsY/(float)height;
+    float periodX = noise->tileable? noise->cellsX : 0.0f;
+    float periodY = noise->tileable? noise->cellsY : 0.0f;
+
+    for (int y = startY; y < endY; y++)
+    {
+        float ny = (float)y*factorY;
+
+        for (int x = 0; x < width; x++)
+        {
+            float nx = (float)x*factorX;
+
+            // Normalize value from [-1..1] to [0..1]
+            float value = (GetNoiseValue(noise, nx, ny, periodX, periodY) + 1.0f)*0.5f;
+            if (value < 0.0f) value = 0.0f;
+            else if (value > 1.0f) value = 1.0f;
+
+            switch (noise->image.format)
+            {
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: ((unsigned char *)noise->image.data)[y*width + x] = (unsigned char)(value*255.0f + 0.5f); break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+                {
+                    unsigned char intensity = (unsigned char)(value*255.0f + 0.5f);
+                    ((rl_Color *)noise->image.data)[y*width + x] = (rl_Color){ intensity, intensity, intensity, 255 };
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32: ((float *)noise->image.data)[y*width + x] = value; break;
+                default: break;
+            }
+        }
+    }
+}
+
+// Get noise value [-1..1] at position (cells units)
+// NOTE: Octaves are summed as fractal brownian motion (lacunarity 2.0, gain 0.5), periods 0 for no wrapping,
+// wrapping perlin noise octaves with periods above NOISE_PERLIN_MAX_PERIOD are not added
+static float GetNoiseValue(const ImageNoiseData *noise, float x, float y, float periodX, float periodY)
+{
+    float sum = 0.0f;
+    float amplitude = 1.0f;
+    float totalAmplitude = 0.0f;
+    float frequency = 1.0f;
+
+    for (int i = 0; i < noise->octaves; i++)
+    {
+        float value = 0.0f;
+        float fx = x*frequency;
+        float fy = y*frequency;
+        int wrapX = (int)(periodX*frequency);
+        int wrapY = (int)(periodY*frequency);
+
+        if ((noise->type == NOISE_PERLIN) && ((wrapX > NOISE_PERLIN_MAX_PERIOD) || (wrapY > NOISE_PERLIN_MAX_PERIOD))) break;
+
+        switch (noise->type)
+        {
+            case NOISE_PERLIN:
+            {
+                if (periodX > 0.0f) value = stb_perlin_noise3_wrap_nonpow2(fx, fy, 0.0f, wrapX, wrapY, 0, (unsigned char)(noise->seed + i));
+                else value = stb_perlin_noise3_seed(fx, fy, 0.0f, 0, 0, 0, noise->seed + i);
+            } break;
+            case NOISE_SIMPLEX:
+            {
+                if (periodX > 0.0f)
+                {
+                    // Simplex lattice can not wrap on a rectangle, wrapping is achieved blending four
+                    // samples offset by the periods, weighted by distance to opposite borders
+                    float px = periodX*frequency;
+                    float py = periodY*frequency;
+                    float wx = fx/px;
+                    float wy = fy/py;
+
+                    value = GetSimplexNoise(fx, fy, noise->seed + i)*(1.0f - wx)*(1.0f - wy) +
+                            GetSimplexNoise(fx - px, fy, noise->seed + i)*wx*(1.0f - wy) +
+                            GetSimplexNoise(fx, fy - py, noise->seed + i)*(1.0f - wx)*wy +
+                            GetSimplexNoise(fx - px, fy - py, noise->seed + i)*wx*wy;
+                }
+                else value = GetSimplexNoise(fx, fy, noise->seed + i);
+            } break;
+            case NOISE_CELLULAR: value = GetCellularNoise(fx, fy, wrapX, wrapY, noise->seed + i); break;
+            default: break;
+        }
+
+        sum += value*amplitude;
+        totalAmplitude += amplitude;
+        amplitude *= 0.5f;
+        frequency *= 2.0f;
+    }
+
+    return sum/totalAmplitude;
+}
+
+// Get simplex noise value [-1..1] at position
+// REF: Simplex noise demystified - Stefan Gustavson
+static float GetSimplexNoise(float x, float y, int seed)
+{
+    static const float gradients[8][2] = { { 1, 1 }, { -1, 1 }, { 1, -1 }, { -1, -1 }, { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+    const float F2 = 0.36602540378f;    // 0.5*(sqrt(3) - 1)
+    const float G2 = 0.21132486540f;    // (3 - sqrt(3))/6
+
+    // Skew input space to find simplex cell
+    float s = (x + y)*F2;
+    int i = (int)floorf(x + s);
+    int j = (int)floorf(y + s);
+    float t = (float)(i + j)*G2;
+
+    // Simplex corners positions relative to position
+    float x0 = x - ((float)i - t);
+    float y0 = y - ((float)j - t);
+    int i1 = (x0 > y0)? 1 : 0;
+    int j1 = (x0 > y0)? 0 : 1;
+    float corners[3][2] = { { x0, y0 }, { x0 - (float)i1 + G2, y0 - (float)j1 + G2 }, { x0 - 1.0f + 2.0f*G2, y0 - 1.0f + 2.0f*G2 } };
+    int offsets[3][2] = { { 0, 0 }, { i1, j1 }, { 1, 1 } };
+
+    float value = 0.0f;
+
+    for (int c = 0; c < 3; c++)
+    {
+        float falloff = 0.5f - corners[c][0]*corners[c][0] - corners[c][1]*corners[c][1];
+
+        if (falloff > 0.0f)
+        {
+            int hash = stb__perlin_randtab[stb__perlin_randtab[(i + offsets[c][0] + seed) & 255] + ((j + offsets[c][1]) & 255)];
+            const float *gradient = gradients[hash & 7];
+
+            falloff *= falloff;
+            value += falloff*falloff*(gradient[0]*corners[c][0] + gradient[1]*corners[c][1]);
+        }
+    }
+
+    return 70.0f*value;
+}
+
+// Get cellular noise value [-1..1] at position, periods 0 for no wrapping
+// NOTE: One feature point per cell, value is the distance to nearest feature point (F1) in cells units
+static float GetCellularNoise(float x, float y, int periodX, int periodY, int seed)
+{
+    int cellX = (int)floorf(x);
+    int cellY = (int)floorf(y);
+    float minDistanceSqr = 2.0f;
+
+    for (int j = -1; j <= 1; j++)
+    {
+        for (int i = -1; i <= 1; i++)
+        {
+            int neighborX = cellX + i;
+            int neighborY = cellY + j;
+
+            // Feature point is hashed from cell coordinates, wrapped cells share feature points
+            int hashX = (periodX > 0)? ((neighborX%periodX) + periodX)%periodX : neighborX;
+            int hashY = (periodY > 0)? ((neighborY%periodY) + periodY)%periodY : neighborY;
+            int hash = stb__perlin_randtab[stb__perlin_randtab[(hashX + seed) & 255] + (hashY & 255)];
+
+            float featureX = (float)neighborX + ((float)stb__perlin_randtab[hash] + 0.5f)/256.0f;
+            float featureY = (float)neighborY + ((float)stb__perlin_randtab[hash + 1] + 0.5f)/256.0f;
+            float dx = featureX - x;
+            float dy = featureY - y;
+            float distanceSqr = dx*dx + dy*dy;
+
+            if (distanceSqr < minDistanceSqr) minDistanceSqr = distanceSqr;
+        }
+    }
+
+    // Nearest feature point distance is in [0..sqrt(2)], mapped to [-1..1]
+    float distance = sqrtf(minDistanceSqr);
+    if (distance > 1.0f) distance = 1.0f;
+
+    return distance*2.0f - 1.0f;
+}
+#endif
+
+// Get pixel data from image as rl_Vector4 array (float normalized)
+static rl_Vector4 *LoadImageDataNormalized(rl_Image image)
+{
+    rl_Vector4 *pixels = (rl_Vector4 *)RL_MALLOC(image.width*image.height*sizeof(rl_Vector4));
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    else if (GetImageFloatFormat(image.format) != 0) GetImagePixelsFloat(image, 0, image.width*image.height, pixels);  // Half-float converted in batches
+    else
+    {
+        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        {
+            switch (image.format)
+            {
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+
+                    k += 2;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
+                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
+                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
+                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
+                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
+                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
+                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+
+                    k += 4;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                    pixels[i].w = 1.0f;
+
+                    k += 3;
+                } break;
+                default: break;
+            }
+        }
+    }
+
+    return pixels;
+}
+
+// Load virtual texture tile data, run on loader threads
+static void LoadVirtualTextureTileJob(void *userData)
+{
+    VirtualTextureLoad *load = (VirtualTextureLoad *)userData;
+
+    load->success = LoadFileDataRange(load->fileName, load->offset, load->data, load->dataSize);
+}
+
+// Set virtual texture tile resident, tile data uploaded into a free cache slot or least recently used one
+// NOTE: Tiles used on current frame are not evicted, returns false if no slot is available
+static bool SetVirtualTextureTile(rl_VirtualTexture *texture, const VirtualTextureLoad *load, bool pinned)
+{
+    VirtualTextureContext *ctx = (VirtualTextureContext *)texture->ctxData;
+    unsigned int oldest = ctx->frame;
+    int slot = -1;
+
+    for (int i = 0; i < ctx->slotCount; i++)
+    {
+        if (ctx->slots[i].tile < 0)
+        {
+            slot = i;
+            break;
+        }
+
+        if (!ctx->slots[i].pinned && (ctx->slots[i].lastUsed < oldest))
+        {
+            oldest = ctx->slots[i].lastUsed;
+            slot = i;
+        }
+    }
+
+    if (slot < 0) return false;
+
+    if (ctx->slots[slot].tile >= 0) ctx->tileSlots[ctx->slots[slot].tile] = -1;
+
+    ctx->slots[slot].tile = load->tile;
+    ctx->slots[slot].lastUsed = ctx->frame;
+    ctx->slots[slot].pinned = pinned;
+    ctx->tileSlots[load->tile] = slot;
+
+    const int slotSize = texture->tileSize + 2*VIRTUAL_TEXTURE_TILE_BORDER;
+    rl_UpdateTextureRec(texture->cache, (rl_Rectangle){ (float)((slot%ctx->slotsPerRow)*slotSize), (float)((slot/ctx->slotsPerRow)*slotSize), (float)slotSize, (float)slotSize }, load->data);
+
+    ctx->indirectionDirty = true;
+
+    return true;
+}
+
+// Request virtual texture tile, resident tiles are marked as used
+// NOTE: Requests over cache size are skipped, they could not be resident at the same time
+static void RequestVirtualTextureTile(VirtualTextureContext *ctx, int tile)
+{
+    int slot = ctx->tileSlots[tile];
+
+    if (slot >= 0) ctx->slots[slot].lastUsed = ctx->frame;
+    else if ((slot == -1) && (ctx->requestCount < ctx->slotCount))
+    {
+        ctx->tileSlots[tile] = -2;
+        ctx->requests[ctx->requestCount] = tile;
+        ctx->requestCount++;
+    }
+}
+
+// Get virtual texture level for scale (screen pixels per texel)
+static int GetVirtualTextureLevel(const rl_VirtualTexture *texture, float scale)
+{
+    int level = 0;
+
+    if ((scale > 0.0f) && (scale < 1.0f)) level = (int)floorf(log2f(1.0f/scale));
+    if (level > (texture->levels - 1)) level = texture->levels - 1;
+
+    return level;
+}
+
+// Update virtual texture indirection from resident tiles, finest level resident per level 0 tile
+static void UpdateVirtualTextureIndirection(rl_VirtualTexture *texture)
+{
+    VirtualTextureContext *ctx = (VirtualTextureContext *)texture->ctxData;
+
+    for (int y = 0; y < ctx->tilesY[0]; y++)
+    {
+        for (int x = 0; x < ctx->tilesX[0]; x++)
+        {
+            unsigned char *pixel = ctx->indirection + 4*(y*ctx->tilesX[0] + x);
+            pixel[3] = 0;
+
+            for (int l = 0; l < texture->levels; l++)
+            {
+                int slot = ctx->tileSlots[ctx->firstTile[l] + (y >> l)*ctx->tilesX[l] + (x >> l)];
+
+                if (slot >= 0)
+                {
+                    pixel[0] = (unsigned char)(slot%ctx->slotsPerRow);
+                    pixel[1] = (unsigned char)(slot/ctx->slotsPerRow);
+                    pixel[2] = (unsigned char)l;
+                    pixel[3] = 255;
+                    break;
+                }
+            }
+        }
+    }
+
+    rl_UpdateTexture(texture->indirection, ctx->indirection);
+    ctx->indirectionDirty = false;
+}
+
+#if defined(SUPPORT_VIDEO_PLAYBACK)
+// Load and decode video frame, run on loader threads
+static void DecodeVideoFrameJob(void *userData)
+{
+    VideoFrameDecode *decode = (VideoFrameDecode *)userData;
+
+    decode->success = LoadFileDataRange(decode->fileName, decode->offset, decode->data, decode->dataSize) &&
+                      DecodeVideoFrameQOI(decode->data, decode->dataSize, decode->pixels, decode->width, decode->height);
+}
+
+// Decode QOI frame into pixels buffer (R8G8B8A8), frame size must match buffer size
+// NOTE: qoi_decode() allocates a new buffer per image, decoding into frames buffers avoids allocations
+static bool DecodeVideoFrameQOI(const unsigned char *data, int dataSize, unsigned char *pixels, int width, int height)
+{
+    if ((dataSize < 22) || (memcmp(data, "qoif", 4) != 0)) return false;
+
+    int frameWidth = (data[4] << 24) | (data[5] << 16) | (data[6] << 8) | data[7];
+    int frameHeight = (data[8] << 24) | (data[9] << 16) | (data[10] << 8) | data[11];
+    if ((frameWidth != width) || (frameHeight != height)) return false;
+
+    rl_Color index[64] = { 0 };
+    rl_Color pixel = { 0, 0, 0, 255 };
+    rl_Color *output = (rl_Color *)pixels;
+    int pixelCount = width*height;
+    int end = dataSize - 8;         // QOI stream end padding
+    int position = 14;              // QOI header size
+    int run = 0;
+
+    for (int i = 0; i < pixelCount; i++)
+    {
+        if (run > 0) run--;
+        else if (position < end)
+        {
+            int op = data[position++];
+
+            if (op == 0xfe)         // QOI_OP_RGB
+            {
+                pixel.r = data[position];
+                pixel.g = data[position + 1];
+                pixel.b = data[position + 2];
+                position += 3;
+            }
+            else if (op == 0xff)    // QOI_OP_RGBA
+            {
+                pixel.r = data[position];
+                pixel.g = data[position + 1];
+                pixel.b = data[position + 2];
+                pixel.a = data[position + 3];
+                position += 4;
+            }
+            else if ((op & 0xc0) == 0x00) pixel = index[op];    // QOI_OP_INDEX
+            else if ((op & 0xc0) == 0x40)   // QOI_OP_DIFF
+            {
+                pixel.r += ((op >> 4) & 0x03) - 2;
+                pixel.g += ((op >> 2) & 0x03) - 2;
+                pixel.b += (op & 0x03) - 2;
+            }
+            else if ((op & 0xc0) == 0x80)   // QOI_OP_LUMA
+            {
+                int diff = data[position++];
+                int greenDiff = (op & 0x3f) - 32;
+
+                pixel.r += greenDiff - 8 + ((diff >> 4) & 0x0f);
+                pixel.g += greenDiff;
+                pixel.b += greenDiff - 8 + (diff & 0x0f);
+            }
+            else run = op & 0x3f;           // QOI_OP_RUN
+
+            index[(pixel.r*3 + pixel.g*5 + pixel.b*7 + pixel.a*11)%64] = pixel;
+        }
+
+        output[i] = pixel;
+    }
+
+    return true;
+}
+
+// Start video frame decoding on loader threads
+// NOTE: If loader queue is full decoding is requested again on next update
+static void StartVideoFrameDecode(rl_Video video, VideoFrameDecode *decode, int frame)
+{
+    VideoContext *ctx = (VideoContext *)video.ctxData;
+
+    decode->frame = frame;
+    decode->offset = ctx->frameIndex[2*frame];
+    decode->dataSize = (int)ctx->frameIndex[2*frame + 1];
+    decode->ready = false;
+    decode->success = false;
+    decode->jobId = AddLoaderJob(DecodeVideoFrameJob, decode);
+
+    if (decode->jobId < 0) decode->frame = -1;
+}
+#endif
+
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+// Export image pixels as PNG file data, using current compression level
+// NOTE: Compression levels 0-3 filter and compress rows by bands on loader threads,
+// higher levels use stb_image_write single threaded compression (smaller files)
+static unsigned char *ExportImagePNG(const unsigned char *pixels, int width, int height, int channels, int *dataSize)
+{
+    *dataSize = 0;
+
+    if (imageExportCompression > PNG_FAST_COMPRESSION_LEVEL) return stbi_write_png_to_mem(pixels, width*channels, width, height, channels, dataSize);
+
+    size_t rowSize = (size_t)width*channels + 1;
+    if (rowSize*height > 0x7fffffff) { TRACELOG(LOG_WARNING, "IMAGE: PNG export data too large"); return NULL; }
+
+    ImageExportPNGData png = { 0 };
+    png.pixels = pixels;
+    png.width = width;
+    png.height = height;
+    png.channels = channels;
+    png.level = imageExportCompression;
+    png.rowBound = rowSize + rowSize/8 + 8;
+    png.filtered = (unsigned char *)RL_MALLOC(rowSize*height);
+    png.compressed = (unsigned char *)RL_MALLOC(png.rowBound*height);
+    png.bandSizes = (int *)RL_CALLOC(height, sizeof(int));
+    png.bandEnds = (int *)RL_CALLOC(height, sizeof(int));
+
+    if ((png.filtered == NULL) || (png.compressed == NULL) || (png.bandSizes == NULL) || (png.bandEnds == NULL))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to allocate PNG export data");
+        RL_FREE(png.filtered);
+        RL_FREE(png.compressed);
+        RL_FREE(png.bandSizes);
+        RL_FREE(png.bandEnds);
+        return NULL;
+    }
+
+    // Fixed Huffman codes (RFC 1951, 3.2.6), bit reversed to be written starting from least significant bit
+    for (int i = 0; i < 288; i++)
+    {
+        unsigned int code = 0;
+        int length = 0;
+
+        if (i < 144) { code = 0x30 + i; length = 8; }
+        else if (i < 256) { code = 0x190 + i - 144; length = 9; }
+        else if (i < 280) { code = i - 256; length = 7; }
+        else { code = 0xc0 + i - 280; length = 8; }
+
+        unsigned int reversed = 0;
+        for (int b = 0; b < length; b++) reversed |= ((code >> b) & 1) << (length - 1 - b);
+
+        png.literalCodes[i] = (unsigned short)reversed;
+        png.literalLengths[i] = (unsigned char)length;
+    }
+
+    for (int s = 0; s < 29; s++)
+    {
+        for (int l = pngLengthBase[s]; (l < pngLengthBase[s] + (1 << pngLengthExtra[s])) && (l <= 258); l++) png.lengthSymbols[l] = (unsigned char)s;
+    }
+
+    for (int s = 0; s < 30; s++)
+    {
+        for (int d = pngDistanceBase[s]; d < pngDistanceBase[s] + (1 << pngDistanceExtra[s]); d++)
+        {
+            png.distanceSymbols[(d <= 256)? (d - 1) : (256 + ((d - 1) >> 7))] = (unsigned char)s;
+        }
+    }
+
+    ProcessImageRows(ExportImagePNGRows, &png, height);
+
+    size_t compressedSize = 0;
+    bool bandsFailed = false;
+
+    for (int y = 0; y < height; y = png.bandEnds[y])
+    {
+        if (png.bandSizes[y] < 0) bandsFailed = true;
+        else compressedSize += png.bandSizes[y];
+    }
+
+    if (bandsFailed)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to allocate PNG export rows compression data");
+        RL_FREE(png.filtered);
+        RL_FREE(png.compressed);
+        RL_FREE(png.bandSizes);
+        RL_FREE(png.bandEnds);
+        return NULL;
+    }
+
+    // Filtered data checksum (adler32), modulo is applied every 5552 bytes to avoid overflow
+    unsigned int s1 = 1, s2 = 0;
+    size_t filteredSize = rowSize*height;
+
+    for (size_t i = 0; i < filteredSize; )
+    {
+        size_t blockEnd = ((i + 5552) < filteredSize)? (i + 5552) : filteredSize;
+
+        for (; i < blockEnd; i++)
+        {
+            s1 += png.filtered[i];
+            s2 += s1;
+        }
+
+        s1 %= 65521;
+        s2 %= 65521;
+    }
+
+    int idatSize = (int)compressedSize + 6;     // zlib header and checksum
+    unsigned char *fileData = NULL;
+
+    if (compressedSize < (size_t)0x7fffff00 - 64)
+    {
+        fileData = (unsigned char *)RL_MALLOC(8 + 25 + 12 + idatSize + 12);
+        if (fileData == NULL) TRACELOG(LOG_WARNING, "IMAGE: Failed to allocate PNG file data");
+    }
+    else TRACELOG(LOG_WARNING, "IMAGE: PNG export data too large");
+
+    if (fileData != NULL)
+    {
+        int size = 0;
+
+        const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', 0x0d, 0x0a, 0x1a, 0x0a };
+        memcpy(fileData, signature, 8);
+        size += 8;
+
+        // Header chunk: size, bit depth 8, color type, compression, filter and interlace methods
+        const unsigned char colorTypes[5] = { 0, 0, 4, 2, 6 };
+        unsigned char *header = fileData + size + 8;
+        header[0] = (unsigned char)(width >> 24); header[1] = (unsigned char)(width >> 16); header[2] = (unsigned char)(width >> 8); header[3] = (unsigned char)width;
+        header[4] = (unsigned char)(height >> 24); header[5] = (unsigned char)(height >> 16); header[6] = (unsigned char)(height >> 8); header[7] = (unsigned char)height;
+        header[8] = 8;
+        header[9] = colorTypes[channels];
+        header[10] = 0;
+        header[11] = 0;
+        header[12] = 0;
+        size += WriteChunkPNG(fileData + size, "IHDR", 13);
+
+        // Data chunk: zlib stream, compressed bands concatenated
+        unsigned char *idat = fileData + size + 8;
+        idat[0] = 0x78;         // Deflate, 32K window
+        idat[1] = 0x01;         // Fastest compression, header check bits
+        int offset = 2;
+
+        for (int y = 0; y < height; y = png.bandEnds[y])
+        {
+            memcpy(idat + offset, png.compressed + png.rowBound*y, png.bandSizes[y]);
+            offset += png.bandSizes[y];
+        }
+
+        idat[offset] = (unsigned char)(s2 >> 8); idat[offset + 1] = (unsigned char)s2;
+        idat[offset + 2] = (unsigned char)(s1 >> 8); idat[offset + 3] = (unsigned char)s1;
+        size += WriteChunkPNG(fileData + size, "IDAT", idatSize);
+
+        size += WriteChunkPNG(fileData + size, "IEND", 0);
+
+        *dataSize = size;
+    }
+
+    RL_FREE(png.filtered);
+    RL_FREE(png.compressed);
+    RL_FREE(png.bandSizes);
+    RL_FREE(png.bandEnds);
+
+    return fileData;
+}
+
+// Filter and compress PNG image rows band
+// NOTE: Matches are searched within band only, hash table keeps more candidates with higher compression levels
+static void ExportImagePNGRows(void *data, int startY, int endY)
+{
+    ImageExportPNGData *png = (ImageExportPNGData *)data;
+    int bpp = png->channels;
+    int rowSize = png->width*bpp;
+    unsigned char *input = png->filtered + (size_t)startY*(rowSize + 1);
+    int inputSize = (endY - startY)*(rowSize + 1);
+    bool lastBand = (endY == png->height);
+
+    // Filter rows, filter with lowest sum of absolute differences is selected per row (libpng heuristic)
+    // NOTE: Stored blocks (level 0) are not filtered, level 1 only tries cheaper filters (None, Sub, Up)
+    int filterCount = (png->level == 0)? 1 : ((png->level == 1)? 3 : 5);
+    unsigned char *zeroRow = (unsigned char *)RL_CALLOC(rowSize, 1);
+    unsigned char *candidate = (unsigned char *)RL_MALLOC(rowSize);
+
+    // NOTE: Band failure is reported to ExportImagePNG() through band size, every band is still processed
+    png->bandEnds[startY] = endY;
+
+    if ((zeroRow == NULL) || (candidate == NULL))
+    {
+        RL_FREE(candidate);
+        RL_FREE(zeroRow);
+        png->bandSizes[startY] = -1;
+        return;
+    }
+
+    for (int y = startY; y < endY; y++)
+    {
+        const unsigned char *row = png->pixels + (size_t)y*rowSize;
+        const unsigned char *prev = (y > 0)? (row - rowSize) : zeroRow;
+        unsigned char *filtered = input + (size_t)(y - startY)*(rowSize + 1);
+
+        filtered[0] = 0;
+        unsigned int bestCost = FilterRowPNG(0, row, prev, rowSize, bpp, filtered + 1);
+
+        for (int filter = 1; filter < filterCount; filter++)
+        {
+            unsigned int cost = FilterRowPNG(filter, row, prev, rowSize, bpp, candidate);
+
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                filtered[0] = (unsigned char)filter;
+                memcpy(filtered + 1, candidate, rowSize);
+            }
+        }
+    }
+
+    RL_FREE(candidate);
+    RL_FREE(zeroRow);
+
+    PNGBitWriter writer = { 0 };
+    writer.data = png->compressed + png->rowBound*startY;
+
+    if (png->level == 0)
+    {
+        // Stored blocks, up to 65535 bytes per block
+        for (int i = 0; i < inputSize; i += 65535)
+        {
+            int blockSize = ((inputSize - i) < 65535)? (inputSize - i) : 65535;
+
+            WriteBitsPNG(&writer, (lastBand && ((i + blockSize) == inputSize))? 1 : 0, 1);
+            WriteBitsPNG(&writer, 0, 2);
+            if (writer.count > 0) WriteBitsPNG(&writer, 0, 8 - writer.count);
+            WriteBitsPNG(&writer, blockSize, 16);
+            WriteBitsPNG(&writer, ~blockSize & 0xffff, 16);
+
+            memcpy(writer.data + writer.size, input + i, blockSize);
+            writer.size += blockSize;
+        }
+    }
+    else
+    {
+        // One fixed Huffman codes block, matches found with hash of next 4 bytes
+        int ways = (png->level == 1)? 1 : ((png->level == 2)? 2 : 4);
+        int *buckets = (int *)RL_MALLOC(((size_t)ways << PNG_FAST_HASH_BITS)*sizeof(int));
+
+        if (buckets == NULL)
+        {
+            png->bandSizes[startY] = -1;
+            return;
+        }
+
+        memset(buckets, 0xff, ((size_t)ways << PNG_FAST_HASH_BITS)*sizeof(int));
+
+        WriteBitsPNG(&writer, lastBand? 1 : 0, 1);
+        WriteBitsPNG(&writer, 1, 2);
+
+        int position = 0;
+
+        while (position < inputSize)
+        {
+            int bestLength = 0;
+            int bestDistance = 0;
+
+            if ((position + 4) <= inputSize)
+            {
+                unsigned int value = 0;
+                memcpy(&value, input + position, 4);
+                int *bucket = buckets + (size_t)ways*((value*2654435761u) >> (32 - PNG_FAST_HASH_BITS));
+
+                int maxLength = inputSize - position;
+                if (maxLength > 258) maxLength = 258;
+
+                for (int w = 0; w < ways; w++)
+                {
+                    int match = bucket[w];
+                    if ((match < 0) || ((position - match) > 32768)) break;
+
+                    unsigned int matchValue = 0;
+                    memcpy(&matchValue, input + match, 4);
+                    if (matchValue != value) continue;
+
+                    int length = 4;
+                    while ((length < maxLength) && (input[match + length] == input[position + length])) length++;
+
+                    if (length > bestLength)
+                    {
+                        bestLength = length;
+                        bestDistance = position - match;
+                    }
+                }
+
+                // Most recent position first, older candidates are shifted out
+                for (int w = ways - 1; w > 0; w--) bucket[w] = bucket[w - 1];
+                bucket[0] = position;
+            }
+
+            if (bestLength > 0)
+            {
+                int lengthSymbol = png->lengthSymbols[bestLength];
+                WriteBitsPNG(&writer, png->literalCodes[257 + lengthSymbol], png->literalLengths[257 + lengthSymbol]);
+                if (pngLengthExtra[lengthSymbol] > 0) WriteBitsPNG(&writer, bestLength - pngLengthBase[lengthSymbol], pngLengthExtra[lengthSymbol]);
+
+                int distanceSymbol = png->distanceSymbols[(bestDistance <= 256)? (bestDistance - 1) : (256 + ((bestDistance - 1) >> 7))];
+                unsigned int distanceCode = 0;
+                for (int b = 0; b < 5; b++) distanceCode |= ((distanceSymbol >> b) & 1) << (4 - b);
+                WriteBitsPNG(&writer, distanceCode, 5);
+                if (pngDistanceExtra[distanceSymbol] > 0) WriteBitsPNG(&writer, bestDistance - pngDistanceBase[distanceSymbol], pngDistanceExtra[distanceSymbol]);
+
+                // Positions within match are also hashed with higher compression levels
+                if (png->level > 1)
+                {
+                    for (int i = position + 1; (i < (position + bestLength)) && ((i + 4) <= inputSize); i++)
+                    {
+                        unsigned int value = 0;
+                        memcpy(&value, input + i, 4);
+                        int *bucket = buckets + (size_t)ways*((value*2654435761u) >> (32 - PNG_FAST_HASH_BITS));
+
+                        for (int w = ways - 1; w > 0; w--) bucket[w] = bucket[w - 1];
+                        bucket[0] = i;
+                    }
+                }
+
+                position += bestLength;
+            }
+            else
+            {
+                WriteBitsPNG(&writer, png->literalCodes[input[position]], png->literalLengths[input[position]]);
+                position++;
+            }
+        }
+
+        WriteBitsPNG(&writer, png->literalCodes[256], png->literalLengths[256]);    // End of block
+
+        // Bands not last are byte aligned with an empty stored block (not final)
+        if (!lastBand)
+        {
+            WriteBitsPNG(&writer, 0, 3);
+            if (writer.count > 0) WriteBitsPNG(&writer, 0, 8 - writer.count);
+            WriteBitsPNG(&writer, 0x0000, 16);
+            WriteBitsPNG(&writer, 0xffff, 16);
+        }
+        else if (writer.count > 0) WriteBitsPNG(&writer, 0, 8 - writer.count);
+
+        RL_FREE(buckets);
+    }
+
+    png->bandSizes[startY] = writer.size;
+}
+
+// Filter PNG image row, returns filtered row cost (sum of absolute values)
+// NOTE: Filters: 0-None, 1-Sub, 2-Up, 3-Average, 4-Paeth, previous row is zeros for first row
+static unsigned int FilterRowPNG(int filter, const unsigned char *row, const unsigned char *prev, int rowSize, int bpp, unsigned char *filtered)
+{
+    // NOTE: First pixel has no left neighbour, Average and Paeth predictors reduce to previous row value
+    switch (filter)
+    {
+        case 1:
+        {
+            for (int i = 0; i < bpp; i++) filtered[i] = row[i];
+            for (int i = bpp; i < rowSize; i++) filtered[i] = (unsigned char)(row[i] - row[i - bpp]);
+        } break;
+        case 2: for (int i = 0; i < rowSize; i++) filtered[i] = (unsigned char)(row[i] - prev[i]); break;
+        case 3:
+        {
+            for (int i = 0; i < bpp; i++) filtered[i] = (unsigned char)(row[i] - prev[i]/2);
+            for (int i = bpp; i < rowSize; i++) filtered[i] = (unsigned char)(row[i] - (row[i - bpp] + prev[i])/2);
+        } break;
+        case 4:
+        {
+            for (int i = 0; i < bpp; i++) filtered[i] = (unsigned char)(row[i] - prev[i]);
+            for (int i = bpp; i < rowSize; i++)
+            {
+                int a = row[i - bpp];
+                int b = prev[i];
+                int c = prev[i - bpp];
+                int pa = abs(b - c);
+                int pb = abs(a - c);
+                int pc = abs(a + b - 2*c);
+
+                filtered[i] = (unsigned char)(row[i] - (((pa <= pb) && (pa <= pc))? a : ((pb <= pc)? b : c)));
+            }
+        } break;
+        default: memcpy(filtered, row, rowSize); break;
+    }
+
+    unsigned int cost = 0;
+    for (int i = 0; i < rowSize; i++) cost += abs((signed char)filtered[i]);
+
+    return cost;
+}
+
+// Write bits to PNG compressed data, up to 16 bits per call
+static void WriteBitsPNG(PNGBitWriter *writer, unsigned int bits, int count)
+{
+    writer->buffer |= (unsigned long long)bits << writer->count;
+    writer->count += count;
+
+    while (writer->count >= 8)
+    {
+        writer->data[writer->size++] = (unsigned char)writer->buffer;
+        writer->buffer >>= 8;
+        writer->count -= 8;
+    }
+}
+
+// Write PNG chunk length, type and CRC around chunk data, returns chunk size
+// NOTE: Chunk data is expected after chunk length and type (8 bytes)
+static int WriteChunkPNG(unsigned char *chunk, const char *type, int dataSize)
+{
+    chunk[0] = (unsigned char)(dataSize >> 24);
+    chunk[1] = (unsigned char)(dataSize >> 16);
+    chunk[2] = (unsigned char)(dataSize >> 8);
+    chunk[3] = (unsigned char)dataSize;
+    memcpy(chunk + 4, type, 4);
+
+    unsigned int crc = ComputeCRC32PNG(chunk + 4, dataSize + 4);
+    unsigned char *end = chunk + 8 + dataSize;
+    end[0] = (unsigned char)(crc >> 24);
+    end[1] = (unsigned char)(crc >> 16);
+    end[2] = (unsigned char)(crc >> 8);
+    end[3] = (unsigned char)crc;
+
+    return dataSize + 12;
+}
+
+// Compute PNG chunk CRC-32 (ISO 3309, reflected polynomial 0xedb88320)
+// NOTE: Half-byte lookup table, no table initialization required (thread-safe)
+static unsigned int ComputeCRC32PNG(const unsigned char *data, int dataSize)
+{
+    static const unsigned int crcTable[16] = {
+        0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+        0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
+    };
+
+    unsigned int crc = 0xffffffff;
+
+    for (int i = 0; i < dataSize; i++)
+    {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ crcTable[crc & 0x0f];
+        crc = (crc >> 4) ^ crcTable[crc & 0x0f];
+    }
+
+    return ~crc;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+// Load GIF frames delay (milliseconds) scanning file blocks, frames are not decoded
+// NOTE: Image data sub-blocks are skipped, frame delay is taken from the last Graphic Control Extension
+static int *LoadFrameDelaysGIF(const unsigned char *fileData, int dataSize, int *frameCount)
+{
+    int *delays = NULL;
+    int capacity = 0;
+    int count = 0;
+    int delay = 0;
+
+    *frameCount = 0;
+
+    if ((dataSize < 13) || (memcmp(fileData, "GIF", 3) != 0)) return NULL;
+
+    int offset = 13;    // Header (6 bytes) + Logical Screen Descriptor (7 bytes)
+    if (fileData[10] & 0x80) offset += 3*(1 << ((fileData[10] & 0x07) + 1));   // Global Color Table
+
+    bool finished = false;
+
+    while (!finished && (offset < dataSize))
+    {
+        unsigned char block = fileData[offset++];
+
+        if (block == 0x21)          // Extension block
+        {
+            if (offset >= dataSize) break;
+            unsigned char label = fileData[offset++];
+
+            // Graphic Control Extension: [size:4][flags][delay:2][transparent index]
+            if ((label == 0xf9) && ((offset + 5) < dataSize)) delay = 10*(fileData[offset + 2] | (fileData[offset + 3] << 8));
+
+            // Skip extension data sub-blocks
+            while ((offset < dataSize) && (fileData[offset] != 0)) offset += fileData[offset] + 1;
+            offset++;
+        }
+        else if (block == 0x2c)     // Image Descriptor: [x:2][y:2][w:2][h:2][flags]
+        {
+            if ((offset + 9) >= dataSize) break;
+
+            unsigned char flags = fileData[offset + 8];
+            offset += 9;
+            if (flags & 0x80) offset += 3*(1 << ((flags & 0x07) + 1));  // Local Color Table
+            offset++;   // LZW minimum code size
+
+            // Skip image data sub-blocks
+            while ((offset < dataSize) && (fileData[offset] != 0)) offset += fileData[offset] + 1;
+            offset++;
+
+            if (count >= capacity)
+            {
+                capacity = (capacity == 0)? 16 : capacity*2;
+                delays = (int *)RL_REALLOC(delays, capacity*sizeof(int));
+            }
+
+            delays[count++] = delay;
+        }
+        else finished = true;      // Trailer (0x3b) or unknown block
+    }
+
+    *frameCount = count;
+    return delays;
+}
+
+// Rewind animated image decoder to first frame
+static void RewindImageAnimation(ImageAnimationContext *ctx)
+{
+    RL_FREE(ctx->gif.out);
+    RL_FREE(ctx->gif.background);
+    RL_FREE(ctx->gif.history);
+    memset(&ctx->gif, 0, sizeof(stbi__gif));
+
+    stbi__start_mem(&ctx->stream, ctx->fileData, ctx->dataSize);
+    ctx->decodedFrame = -1;
+}
+
+// Decode next animated image frame into decoder output buffer (ctx->gif.out)
+static bool DecodeNextImageAnimationFrame(ImageAnimationContext *ctx)
+{
+    int comp = 0;
+    unsigned char *twoBack = (ctx->decodedFrame >= 1)? ctx->twoBack : NULL;
+    unsigned char *out = stbi__gif_load_next(&ctx->stream, &ctx->gif, &comp, 4, twoBack);
+
+    if ((out == NULL) || (out == (unsigned char *)&ctx->stream)) return false;     // Error or end of animation marker
+
+    int size = ctx->gif.w*ctx->gif.h*4;
+
+    if (ctx->previous == NULL)
+    {
+        ctx->previous = (unsigned char *)RL_MALLOC(size);
+        ctx->twoBack = (unsigned char *)RL_MALLOC(size);
+    }
+
+    // Keep last two decoded frames, required to restore previous frame on disposal
+    unsigned char *temp = ctx->twoBack;
+    ctx->twoBack = ctx->previous;
+    ctx->previous = temp;
+    memcpy(ctx->previous, out, size);
+
+    ctx->decodedFrame++;
+
+    return true;
+}
+
+// Decode next animated image frame ahead, run on loader threads
+// NOTE: Decoder is rewound to first frame after last frame (looping playback)
+static void PrefetchImageAnimationFrameJob(void *userData)
+{
+    ImageAnimationContext *ctx = (ImageAnimationContext *)userData;
+
+    if ((ctx->decodedFrame + 1) >= ctx->frameCount) RewindImageAnimation(ctx);
+
+    ctx->prefetchSuccess = DecodeNextImageAnimationFrame(ctx);
+}
+
+// Wait animated image next frame prefetch, decoder state is available after it
+// NOTE: Prefetched frame delay is updated on calling thread, frames delays are not accessed by loader threads
+static void WaitImageAnimationPrefetch(rl_ImageAnimation *anim)
+{
+    ImageAnimationContext *ctx = (ImageAnimationContext *)anim->ctxData;
+
+    if (ctx->prefetchJobId < 0) return;
+
+    WaitLoaderJob(ctx->prefetchJobId);
+    ctx->prefetchJobId = -1;
+
+    if (ctx->prefetchSuccess) anim->frameDelays[ctx->decodedFrame] = ctx->gif.delay;
+}
+#endif
+
 #endif      // SUPPORT_MODULE_RTEXTURES
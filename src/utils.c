@@ -48,6 +48,41 @@
 #include <stdio.h>                      // Required for: FILE, fopen(), fseek(), ftell(), fread(), fwrite(), fprintf(), vprintf(), fclose()
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
+#include <limits.h>                     // Required for: INT_MAX
+
+#if defined(SUPPORT_COMPRESSION_API)
+    #include "external/sinfl.h"         // Required for: sinflate(), implementation in rcore module
+#endif
+
+// Loader threads, on platforms supporting them
+#if defined(SUPPORT_LOADER_THREADS) && !defined(__EMSCRIPTEN__)
+    #define LOADER_THREADS
+    #if defined(_WIN32)
+        // NOTE: Declaring required Win32 functions, including windows.h conflicts with raylib symbols
+        __declspec(dllimport) void *__stdcall CreateThread(void *attributes, size_t stackSize, unsigned long (__stdcall *start)(void *), void *param, unsigned long flags, unsigned long *threadId);
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+        __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+        __declspec(dllimport) void __stdcall AcquireSRWLockExclusive(void **lock);
+        __declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(void **lock);
+        __declspec(dllimport) void __stdcall AcquireSRWLockShared(void **lock);
+        __declspec(dllimport) void __stdcall ReleaseSRWLockShared(void **lock);
+        __declspec(dllimport) int __stdcall SleepConditionVariableSRW(void **condition, void **lock, unsigned long milliseconds, unsigned long flags);
+        __declspec(dllimport) void __stdcall WakeAllConditionVariable(void **condition);
+    #else
+        #include <pthread.h>            // Required for: pthread_create(), pthread_join(), pthread_mutex_t, pthread_cond_t
+    #endif
+#endif
+
+// Memory mapped file data, on platforms supporting it
+#if defined(SUPPORT_STANDARD_FILEIO) && !defined(PLATFORM_ANDROID) && !defined(__EMSCRIPTEN__) && \
+    (defined(__linux__) || defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__NetBSD__))
+    #define FILEIO_MEMORY_MAPPING
+    #include <sys/mman.h>               // Required for: mmap(), munmap()
+    #include <sys/stat.h>               // Required for: fstat()
+    #include <fcntl.h>                  // Required for: open()
+    #include <unistd.h>                 // Required for: close(), sysconf()
+    #include <stdint.h>                 // Required for: uintptr_t
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -55,6 +90,104 @@
 #ifndef MAX_TRACELOG_MSG_LENGTH
     #define MAX_TRACELOG_MSG_LENGTH     256         // Max length of one trace-log message
 #endif
+#ifndef MAX_FILEPATH_LENGTH
+    #define MAX_FILEPATH_LENGTH        4096         // Maximum length for filepaths
+#endif
+#ifndef MAX_FILEIO_PACKS
+    #define MAX_FILEIO_PACKS              8         // Max number of pack files mounted at the same time
+#endif
+#ifndef MAX_LOADER_THREADS
+    #define MAX_LOADER_THREADS            4         // Max number of loader threads
+#endif
+#ifndef MAX_LOADER_JOBS
+    #define MAX_LOADER_JOBS             256         // Max number of loader jobs pending at the same time
+#endif
+
+// Seek file to 64bit offset (from file beginning) or to file end, get 64bit file position
+#if defined(_WIN32)
+    #define FILEIO_SEEK(file, offset)   _fseeki64(file, offset, SEEK_SET)
+    #define FILEIO_SEEK_END(file)       _fseeki64(file, 0, SEEK_END)
+    #define FILEIO_TELL(file)           _ftelli64(file)
+#else
+    #define FILEIO_SEEK(file, offset)   fseeko(file, (off_t)(offset), SEEK_SET)
+    #define FILEIO_SEEK_END(file)       fseeko(file, 0, SEEK_END)
+    #define FILEIO_TELL(file)           (long long)ftello(file)
+#endif
+
+#define PACK_FILE_VERSION               100         // Pack file format version
+#define PACK_DATA_ALIGNMENT              16         // Pack entries data alignment, in bytes
+#define PACK_MAX_SIZE               INT_MAX         // Pack file maximum size (2GB), offsets and sizes are 32bit
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Pack file format
+//   Header: "rPAK" | version | entryCount | indexOffset (4x 32bit)
+//   Entries data: every entry data starts aligned to PACK_DATA_ALIGNMENT
+//   Index: entryCount*PackEntry (sorted by name) | namesSize (32bit) | names ('\0' terminated)
+// NOTE: Entries with size != dataSize are DEFLATE compressed, pack file size is limited to PACK_MAX_SIZE
+typedef struct PackEntry {
+    unsigned int offset;            // Entry data offset in pack file
+    unsigned int size;              // Entry data size in pack file
+    unsigned int dataSize;          // Entry data size uncompressed
+    unsigned int nameOffset;        // Entry name offset in names data
+} PackEntry;
+
+// Mounted pack file
+typedef struct PackFile {
+    char *fileName;                 // Pack file name
+    char *mountPath;                // Mount path, prefix for entries names
+    int entryCount;                 // Number of entries
+    PackEntry *entries;             // Entries index, sorted by name
+    char *names;                    // Entries names data
+    unsigned char *data;            // Pack file mapped data (if memory mapping supported)
+    int dataSize;                   // Pack file mapped data size
+    int fd;                         // Pack file descriptor, uncompressed entries are mapped from it (if memory mapping supported)
+    FILE *file;                     // Pack file opened for reading (if memory mapping not supported)
+} PackFile;
+
+// Loader job state
+typedef enum {
+    LOADER_JOB_FREE = 0,            // Job slot available
+    LOADER_JOB_QUEUED,              // Job waiting for a loader thread
+    LOADER_JOB_RUNNING,             // Job running on a loader thread
+    LOADER_JOB_DONE                 // Job finished, waiting to be released
+} LoaderJobState;
+
+// Loader job
+typedef struct LoaderJob {
+    LoaderJobCallback callback;     // Job callback
+    void *userData;                 // Job callback user data
+    LoaderJobState state;           // Job state
+    bool async;                     // Job added by async loading functions, counted for progress
+    int generation;                 // Job slot generation, incremented on release so reused slots get new ids
+} LoaderJob;
+
+// Loader threads state
+typedef struct LoaderData {
+    bool ready;                     // Loader threads initialized
+    bool closing;                   // Loader threads requested to exit
+#if defined(LOADER_THREADS)
+#if defined(_WIN32)
+    void *threads[MAX_LOADER_THREADS];  // Loader threads handles
+    void *lock;                     // Jobs lock (SRWLOCK)
+    void *jobQueued;                // Job queued condition (CONDITION_VARIABLE)
+    void *jobDone;                  // Job done condition (CONDITION_VARIABLE)
+#else
+    pthread_t threads[MAX_LOADER_THREADS];  // Loader threads
+    pthread_mutex_t lock;           // Jobs lock
+    pthread_cond_t jobQueued;       // Job queued condition
+    pthread_cond_t jobDone;         // Job done condition
+#endif
+#endif
+    int threadCount;                // Loader threads running
+    LoaderJob jobs[MAX_LOADER_JOBS];    // Jobs slots, job id is generation*MAX_LOADER_JOBS + slot index
+    int queue[MAX_LOADER_JOBS];     // Queued jobs slots (FIFO)
+    int queueHead;                  // Queue first job position
+    int queueCount;                 // Queue jobs count
+    int jobsAdded;                  // Async load jobs added since async loading was idle (progress)
+    int jobsDone;                   // Async load jobs done since async loading was idle (progress)
+} LoaderData;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -67,6 +200,29 @@ static SaveFileDataCallback saveFileData = NULL;    // rl_SaveFileText callback
 static LoadFileTextCallback loadFileText = NULL;    // rl_LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // rl_SaveFileText callback function pointer
 
+static PackFile packs[MAX_FILEIO_PACKS] = { 0 };    // Mounted pack files
+static int packCount = 0;                           // Mounted pack files count
+#if defined(LOADER_THREADS)
+#if defined(_WIN32)
+static void *packsLock = NULL;                      // Mounted packs lock (SRWLOCK): shared to load entries, exclusive to mount/unmount
+static void *packsFileLock = NULL;                  // Packs file reading lock (SRWLOCK), file position is shared
+#else
+static pthread_rwlock_t packsLock = PTHREAD_RWLOCK_INITIALIZER;    // Mounted packs lock: shared to load entries, exclusive to mount/unmount
+#if !defined(FILEIO_MEMORY_MAPPING)
+static pthread_mutex_t packsFileLock = PTHREAD_MUTEX_INITIALIZER;  // Packs file reading lock, file position is shared
+#endif
+#endif
+#endif
+
+static LoaderData loader = { 0 };                   // Loader threads jobs
+#if defined(LOADER_THREADS)
+#if defined(_WIN32)
+static void *loaderInitLock = NULL;                 // Loader threads initialization lock (SRWLOCK), first jobs can be added concurrently
+#else
+static pthread_mutex_t loaderInitLock = PTHREAD_MUTEX_INITIALIZER; // Loader threads initialization lock, first jobs can be added concurrently
+#endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
 //----------------------------------------------------------------------------------
@@ -85,6 +241,25 @@ static const char *internalDataPath = NULL;         // Android internal data pat
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
+static int ComparePackEntryNames(const void *a, const void *b);               // Compare pack entries names, used to sort pack index
+static const PackEntry *FindPackEntry(const char *fileName, PackFile **pack);  // Find file entry in mounted packs (last mounted first)
+static unsigned char *LoadPackEntryData(PackFile *pack, const PackEntry *entry, int extraSize); // Load pack entry data, uncompressed
+#if defined(FILEIO_MEMORY_MAPPING)
+static unsigned char *MoveDataToMapping(unsigned char *data, int dataSize); // Move loaded data to an anonymous memory mapping
+#endif
+
+#if defined(LOADER_THREADS)
+static void InitLoaderThreads(void);                // Initialize loader threads
+static void ProcessLoaderJobs(void);                // Process queued jobs until loader is closed (loader thread)
+static void RunQueuedLoaderJob(void);               // Run first queued job on calling thread (loader locked)
+#endif
+static void LockLoader(void);                       // Lock loader jobs
+static void UnlockLoader(void);                     // Unlock loader jobs
+static int GetLoaderJobSlot(int id);                // Get loader job slot from job id, -1 if job id was already released
+static int AddLoaderJobSlot(LoaderJobCallback callback, void *userData, bool async); // Add job to loader threads queue, async load jobs are counted for progress
+static void LockPacks(bool exclusive);              // Lock mounted packs, shared to load entries, exclusive to mount/unmount
+static void UnlockPacks(bool exclusive);            // Unlock mounted packs
+
 #if defined(PLATFORM_ANDROID)
 FILE *funopen(const void *cookie, int (*readfn)(void *, char *, int), int (*writefn)(void *, const char *, int),
               fpos_t (*seekfn)(void *, fpos_t, int), int (*closefn)(void *));
@@ -187,6 +362,20 @@ unsigned char *rl_LoadFileData(const char *fileName, int *dataSize)
 
     if (fileName != NULL)
     {
+        // NOTE: Packs can not be unmounted while loading an entry
+        LockPacks(false);
+        PackFile *pack = NULL;
+        const PackEntry *entry = FindPackEntry(fileName, &pack);
+
+        if (entry != NULL)
+        {
+            data = LoadPackEntryData(pack, entry, 0);
+            if (data != NULL) *dataSize = (int)entry->dataSize;
+            UnlockPacks(false);
+            return data;
+        }
+        UnlockPacks(false);
+
         if (loadFileData)
         {
             data = loadFileData(fileName, dataSize);
@@ -251,6 +440,107 @@ void rl_UnloadFileData(unsigned char *data)
     RL_FREE(data);
 }
 
+// Load file data as memory mapped byte array (read)
+// NOTE: File pages are loaded on access and shared with the system file cache, no heap copy is made,
+// data is private: it can be modified without changing the file. Useful to decode data directly from file.
+// Uncompressed packed files are mapped directly from their pack file, but compressed packed files and
+// custom loaded files (rl_SetLoadFileDataCallback()) are loaded and copied to an anonymous mapping.
+// On platforms without memory mapping support data is loaded with rl_LoadFileData()
+unsigned char *rl_LoadFileDataMapped(const char *fileName, int *dataSize)
+{
+    unsigned char *data = NULL;
+    *dataSize = 0;
+
+#if defined(FILEIO_MEMORY_MAPPING)
+    if (fileName == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
+        return NULL;
+    }
+
+    LockPacks(false);
+    PackFile *pack = NULL;
+    const PackEntry *entry = FindPackEntry(fileName, &pack);
+    bool packed = (entry != NULL);
+
+    if (packed && (entry->size == entry->dataSize) && (entry->size > 0) && (pack->fd != -1))
+    {
+        // Uncompressed packed data is mapped from pack file, mapping must start at a memory page boundary
+        size_t pageOffset = entry->offset%(size_t)sysconf(_SC_PAGESIZE);
+        void *mapping = mmap(NULL, pageOffset + entry->size, PROT_READ | PROT_WRITE, MAP_PRIVATE, pack->fd, (off_t)(entry->offset - pageOffset));
+
+        if (mapping != MAP_FAILED)
+        {
+            data = (unsigned char *)mapping + pageOffset;
+            *dataSize = (int)entry->size;
+        }
+    }
+    UnlockPacks(false);
+
+    if (data != NULL)
+    {
+        TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully from pack", fileName);
+        return data;
+    }
+
+    if ((loadFileData != NULL) || packed)
+    {
+        // Custom loaded and compressed packed data is moved to an anonymous mapping, so it can be unloaded as any mapped data
+        int size = 0;
+        unsigned char *fileData = rl_LoadFileData(fileName, &size);
+
+        data = MoveDataToMapping(fileData, size);
+        if (data != NULL) *dataSize = size;
+
+        return data;
+    }
+
+    int file = open(fileName, O_RDONLY);
+
+    if (file != -1)
+    {
+        struct stat info = { 0 };
+
+        if ((fstat(file, &info) == 0) && (info.st_size > 0) && (info.st_size <= 2147483647))
+        {
+            void *mapping = mmap(NULL, (size_t)info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+
+            if (mapping != MAP_FAILED)
+            {
+                data = (unsigned char *)mapping;
+                *dataSize = (int)info.st_size;
+
+                TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully", fileName);
+            }
+            else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to map file", fileName);
+        }
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read file", fileName);
+
+        close(file);    // NOTE: Mapping keeps a reference to the file
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+#else
+    data = rl_LoadFileData(fileName, dataSize);
+#endif
+
+    return data;
+}
+
+// Unload file data mapped by rl_LoadFileDataMapped()
+void rl_UnloadFileDataMapped(unsigned char *data, int dataSize)
+{
+#if defined(FILEIO_MEMORY_MAPPING)
+    if ((data != NULL) && (dataSize > 0))
+    {
+        // Data mapped from pack files might not start at a memory page boundary
+        size_t pageOffset = (uintptr_t)data%(size_t)sysconf(_SC_PAGESIZE);
+        munmap(data - pageOffset, pageOffset + dataSize);
+    }
+#else
+    rl_UnloadFileData(data);
+#endif
+}
+
 // Save data to file from buffer
 bool rl_SaveFileData(const char *fileName, void *data, int dataSize)
 {
@@ -288,6 +578,76 @@ bool rl_SaveFileData(const char *fileName, void *data, int dataSize)
     return success;
 }
 
+// Get file length in bytes (64bit), returns 0 if file can not be opened
+long long GetFileDataLength(const char *fileName)
+{
+    long long size = 0;
+
+#if defined(SUPPORT_STANDARD_FILEIO)
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        if (FILEIO_SEEK_END(file) == 0) size = FILEIO_TELL(file);
+        if (size < 0) size = 0;
+
+        fclose(file);
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: Standard file io not supported, file size can not be retrieved");
+#endif
+
+    return size;
+}
+
+// Load file data range into buffer, returns true on success
+// NOTE: Offset is 64bit, file data ranges can be loaded from files bigger than INT_MAX
+bool LoadFileDataRange(const char *fileName, long long offset, void *data, int dataSize)
+{
+    bool success = false;
+
+#if defined(SUPPORT_STANDARD_FILEIO)
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        if ((FILEIO_SEEK(file, offset) == 0) && ((int)fread(data, 1, dataSize, file) == dataSize)) success = true;
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read file data range (%i bytes)", fileName, dataSize);
+
+        fclose(file);
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: Standard file io not supported, file data ranges can not be loaded");
+#endif
+
+    return success;
+}
+
+// Save data range into file, file is created (or truncated) when offset is 0, returns true on success
+bool SaveFileDataRange(const char *fileName, long long offset, const void *data, int dataSize)
+{
+    bool success = false;
+
+#if defined(SUPPORT_STANDARD_FILEIO)
+    FILE *file = fopen(fileName, (offset == 0)? "wb" : "r+b");
+
+    if (file != NULL)
+    {
+        if ((FILEIO_SEEK(file, offset) == 0) && ((int)fwrite(data, 1, dataSize, file) == dataSize)) success = true;
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to write file data range (%i bytes)", fileName, dataSize);
+
+        if (fclose(file) != 0) success = false;
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: Standard file io not supported, file data ranges can not be saved");
+#endif
+
+    return success;
+}
+
 // Export data to code (.h), returns true on success
 bool rl_ExportDataAsCode(const unsigned char *data, int dataSize, const char *fileName)
 {
@@ -349,6 +709,20 @@ char *rl_LoadFileText(const char *fileName)
 
     if (fileName != NULL)
     {
+        // NOTE: Packs can not be unmounted while loading an entry
+        LockPacks(false);
+        PackFile *pack = NULL;
+        const PackEntry *entry = FindPackEntry(fileName, &pack);
+
+        if (entry != NULL)
+        {
+            text = (char *)LoadPackEntryData(pack, entry, 1);
+            if (text != NULL) text[entry->dataSize] = '\0';
+            UnlockPacks(false);
+            return text;
+        }
+        UnlockPacks(false);
+
         if (loadFileText)
         {
             text = loadFileText(fileName);
@@ -439,6 +813,436 @@ bool rl_SaveFileText(const char *fileName, char *text)
     return success;
 }
 
+// Mount pack file, its files are loaded by file functions as if located at mountPath
+// NOTE: Files are looked up in mounted packs before custom file callbacks and disk, last mounted first,
+// pack index is loaded in memory and pack data is memory mapped (if supported) for entries data access
+bool rl_MountPack(const char *fileName, const char *mountPath)
+{
+    bool success = false;
+
+    if (packCount >= MAX_FILEIO_PACKS)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to mount pack, max packs mounted reached (%i)", fileName, MAX_FILEIO_PACKS);
+        return false;
+    }
+
+    PackFile pack = { 0 };
+    unsigned int header[4] = { 0 };
+    bool validHeader = false;
+
+#if defined(FILEIO_MEMORY_MAPPING)
+    pack.data = rl_LoadFileDataMapped(fileName, &pack.dataSize);
+    pack.fd = open(fileName, O_RDONLY);
+
+    if (pack.dataSize >= (int)sizeof(header))
+    {
+        memcpy(header, pack.data, sizeof(header));
+        validHeader = true;
+    }
+#else
+    pack.file = fopen(fileName, "rb");
+
+    if ((pack.file != NULL) && (fread(header, sizeof(header), 1, pack.file) == 1))
+    {
+        fseek(pack.file, 0, SEEK_END);
+        pack.dataSize = (int)ftell(pack.file);
+        validHeader = true;
+    }
+#endif
+
+    // NOTE: Index must fit entries, names size and at least one name character, checked with 64bit math (entries count is not trusted)
+    if (validHeader && (memcmp(header, "rPAK", 4) == 0) && (header[1] == PACK_FILE_VERSION) &&
+        (header[3] >= sizeof(header)) && (header[3] < (unsigned int)pack.dataSize) &&
+        ((unsigned long long)header[2]*sizeof(PackEntry) + sizeof(unsigned int) < (unsigned long long)pack.dataSize - header[3]))
+    {
+        // Load pack index: entries and names
+        unsigned int indexSize = (unsigned int)pack.dataSize - header[3];
+        unsigned char *index = (unsigned char *)RL_MALLOC(indexSize);
+
+#if defined(FILEIO_MEMORY_MAPPING)
+        memcpy(index, pack.data + header[3], indexSize);
+#else
+        fseek(pack.file, header[3], SEEK_SET);
+        if (fread(index, indexSize, 1, pack.file) != 1) indexSize = 0;
+#endif
+        pack.entryCount = (int)header[2];
+        pack.entries = (PackEntry *)index;
+        pack.names = (char *)index + pack.entryCount*sizeof(PackEntry) + sizeof(unsigned int);
+
+        unsigned int namesSize = 0;
+        if (indexSize > 0) memcpy(&namesSize, index + pack.entryCount*sizeof(PackEntry), sizeof(unsigned int));
+
+        // Validate index, entries must be inside pack data and names inside names data
+        success = (indexSize > 0) && (namesSize > 0) && (namesSize == indexSize - pack.entryCount*sizeof(PackEntry) - sizeof(unsigned int)) &&
+            (pack.names[namesSize - 1] == '\0');
+
+        for (int i = 0; success && (i < pack.entryCount); i++)
+        {
+            const PackEntry *entry = &pack.entries[i];
+            if ((entry->offset > header[3]) || (entry->size > header[3] - entry->offset) || (entry->nameOffset >= namesSize)) success = false;
+        }
+    }
+
+    // NOTE: Mounted packs limit is checked again, other threads could mount packs meanwhile
+    LockPacks(true);
+    if (success && (packCount >= MAX_FILEIO_PACKS))
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to mount pack, max packs mounted reached (%i)", fileName, MAX_FILEIO_PACKS);
+        success = false;
+    }
+
+    if (success)
+    {
+        pack.fileName = (char *)RL_CALLOC(strlen(fileName) + 1, 1);
+        strcpy(pack.fileName, fileName);
+
+        // Mount path is stored normalized: '/' separators, without './' prefix and with trailing '/' if not empty
+        if (mountPath == NULL) mountPath = "";
+        if ((mountPath[0] == '.') && ((mountPath[1] == '/') || (mountPath[1] == '\\') || (mountPath[1] == '\0'))) mountPath += (mountPath[1] == '\0')? 1 : 2;
+
+        int mountPathLength = (int)strlen(mountPath);
+        pack.mountPath = (char *)RL_CALLOC(mountPathLength + 2, 1);
+        for (int i = 0; i < mountPathLength; i++) pack.mountPath[i] = (mountPath[i] == '\\')? '/' : mountPath[i];
+        if ((mountPathLength > 0) && (pack.mountPath[mountPathLength - 1] != '/')) pack.mountPath[mountPathLength] = '/';
+
+#if defined(FILEIO_MEMORY_MAPPING) && defined(MADV_WILLNEED)
+        // Request the system to start reading pack data in background, entries are usually loaded shortly after mounting
+        madvise(pack.data, header[3], MADV_WILLNEED);
+#endif
+        packs[packCount] = pack;
+        packCount++;
+        UnlockPacks(true);
+
+        TRACELOG(LOG_INFO, "FILEIO: [%s] Pack mounted successfully (%i files)", fileName, pack.entryCount);
+    }
+    else
+    {
+        UnlockPacks(true);
+
+        RL_FREE(pack.entries);
+#if defined(FILEIO_MEMORY_MAPPING)
+        rl_UnloadFileDataMapped(pack.data, pack.dataSize);
+        if (pack.fd != -1) close(pack.fd);
+#else
+        if (pack.file != NULL) fclose(pack.file);
+#endif
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to mount pack, not a valid pack file", fileName);
+    }
+
+    return success;
+}
+
+// Unmount pack file
+void rl_UnmountPack(const char *fileName)
+{
+    // NOTE: Waits for entries being loaded from packs
+    LockPacks(true);
+
+    for (int i = 0; i < packCount; i++)
+    {
+        if (strcmp(packs[i].fileName, fileName) == 0)
+        {
+            RL_FREE(packs[i].fileName);
+            RL_FREE(packs[i].mountPath);
+            RL_FREE(packs[i].entries);      // NOTE: Names are stored in the same index memory
+#if defined(FILEIO_MEMORY_MAPPING)
+            rl_UnloadFileDataMapped(packs[i].data, packs[i].dataSize);
+            if (packs[i].fd != -1) close(packs[i].fd);     // NOTE: Entries mapped from pack keep their own reference
+#else
+            fclose(packs[i].file);
+#endif
+            // Keep mounting order for the remaining packs
+            for (int j = i; j < packCount - 1; j++) packs[j] = packs[j + 1];
+            packCount--;
+            memset(&packs[packCount], 0, sizeof(PackFile));
+
+            TRACELOG(LOG_INFO, "FILEIO: [%s] Pack unmounted successfully", fileName);
+            break;
+        }
+    }
+
+    UnlockPacks(true);
+}
+
+// Export directory files (recursive) to a pack file, returns true on success
+// NOTE: Entries are named by their path relative to dirPath, using '/' separators,
+// if compression is requested, entries are only stored compressed when it reduces their size,
+// pack file size is limited to PACK_MAX_SIZE (2GB), export fails if entries data and index exceed it,
+// pack is written to a temporary file renamed on success, an existing pack file is kept on failure
+bool rl_ExportPack(const char *fileName, const char *dirPath, bool compress)
+{
+    bool success = false;
+
+    char tempName[MAX_FILEPATH_LENGTH] = { 0 };
+    if (strlen(fileName) >= (MAX_FILEPATH_LENGTH - 4))
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export pack, file path too long", fileName);
+        return false;
+    }
+
+    strcpy(tempName, fileName);
+    strcat(tempName, ".tmp");
+
+    rl_FilePathList files = rl_LoadDirectoryFilesEx(dirPath, NULL, true);
+
+    if (files.count == 0)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export pack, no files found in directory", dirPath);
+        rl_UnloadDirectoryFiles(files);
+        return false;
+    }
+
+    // Sort files by relative name, pack index is sorted for fast lookup
+    int dirPathLength = (int)strlen(dirPath);
+    if ((dirPathLength > 0) && (dirPath[dirPathLength - 1] != '/') && (dirPath[dirPathLength - 1] != '\\')) dirPathLength++;
+
+    for (unsigned int i = 0; i < files.count; i++)
+    {
+        for (char *c = files.paths[i]; *c != '\0'; c++) if (*c == '\\') *c = '/';
+    }
+
+    qsort(files.paths, files.count, sizeof(char *), ComparePackEntryNames);
+
+    PackEntry *entries = (PackEntry *)RL_CALLOC(files.count, sizeof(PackEntry));
+    unsigned int namesSize = 0;
+    for (unsigned int i = 0; i < files.count; i++) namesSize += (unsigned int)strlen(files.paths[i] + dirPathLength) + 1;
+    char *names = (char *)RL_CALLOC(namesSize, 1);
+
+    FILE *packFile = ((entries != NULL) && (names != NULL))? fopen(tempName, "wb") : NULL;
+
+    if (packFile != NULL)
+    {
+        unsigned int header[4] = { 0 };
+        memcpy(header, "rPAK", 4);
+        header[1] = PACK_FILE_VERSION;
+        header[2] = files.count;
+        success = (fwrite(header, sizeof(header), 1, packFile) == 1);
+
+        unsigned int offset = sizeof(header);
+        unsigned int nameOffset = 0;
+        long long indexSize = (long long)files.count*sizeof(PackEntry) + sizeof(unsigned int) + namesSize;
+        const unsigned char padding[PACK_DATA_ALIGNMENT] = { 0 };
+
+        for (unsigned int i = 0; success && (i < files.count); i++)
+        {
+            int dataSize = 0;
+            unsigned char *data = rl_LoadFileData(files.paths[i], &dataSize);
+            unsigned char *packData = data;
+            int packDataSize = dataSize;
+#if defined(SUPPORT_COMPRESSION_API)
+            int compDataSize = 0;
+            unsigned char *compData = (compress && (dataSize > 0))? rl_CompressData(data, dataSize, &compDataSize) : NULL;
+            if ((compData != NULL) && (compDataSize < dataSize))
+            {
+                packData = compData;
+                packDataSize = compDataSize;
+            }
+#endif
+            unsigned int paddingSize = (PACK_DATA_ALIGNMENT - (packDataSize%PACK_DATA_ALIGNMENT))%PACK_DATA_ALIGNMENT;
+
+            // NOTE: Entries data and index must fit pack file maximum size, 32bit offsets would wrap
+            if ((long long)offset + packDataSize + paddingSize + indexSize > PACK_MAX_SIZE)
+            {
+                TRACELOG(LOG_WARNING, "FILEIO: [%s] Pack file exceeds maximum size (%i bytes)", fileName, PACK_MAX_SIZE);
+                success = false;
+            }
+
+            entries[i].offset = offset;
+            entries[i].size = (unsigned int)packDataSize;
+            entries[i].dataSize = (unsigned int)dataSize;
+            entries[i].nameOffset = nameOffset;
+
+            strcpy(names + nameOffset, files.paths[i] + dirPathLength);
+            nameOffset += (unsigned int)strlen(files.paths[i] + dirPathLength) + 1;
+
+            if (success && (packDataSize > 0) && (fwrite(packData, packDataSize, 1, packFile) != 1)) success = false;
+            if (success && (paddingSize > 0) && (fwrite(padding, paddingSize, 1, packFile) != 1)) success = false;
+            offset += (unsigned int)packDataSize + paddingSize;
+
+#if defined(SUPPORT_COMPRESSION_API)
+            RL_FREE(compData);
+#endif
+            rl_UnloadFileData(data);
+        }
+
+        // Write index at the end and update header index offset
+        if (success)
+        {
+            if (fwrite(entries, sizeof(PackEntry), files.count, packFile) != files.count) success = false;
+            if (fwrite(&namesSize, sizeof(unsigned int), 1, packFile) != 1) success = false;
+            if (fwrite(names, namesSize, 1, packFile) != 1) success = false;
+
+            header[3] = offset;
+            if ((fseek(packFile, 0, SEEK_SET) != 0) || (fwrite(header, sizeof(header), 1, packFile) != 1)) success = false;
+        }
+
+        if (fclose(packFile) != 0) success = false;
+
+        // Temporary file replaces pack file only when completely written, removed otherwise
+        // NOTE: rename() does not replace an existing file on Windows
+#if defined(_WIN32)
+        if (success) remove(fileName);
+#endif
+        if (success && (rename(tempName, fileName) != 0)) success = false;
+        if (!success) remove(tempName);
+    }
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Pack exported successfully (%i files)", fileName, files.count);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export pack", fileName);
+
+    RL_FREE(entries);
+    RL_FREE(names);
+    rl_UnloadDirectoryFiles(files);
+
+    return success;
+}
+
+// Check if file is available in mounted pack files
+bool IsFileInPacks(const char *fileName)
+{
+    PackFile *pack = NULL;
+
+    LockPacks(false);
+    bool result = ((fileName != NULL) && (FindPackEntry(fileName, &pack) != NULL));
+    UnlockPacks(false);
+
+    return result;
+}
+
+// Add job to loader threads queue, returns job id (-1 if queue is full)
+int AddLoaderJob(LoaderJobCallback callback, void *userData)
+{
+    return AddLoaderJobSlot(callback, userData, false);
+}
+
+// Add async load job to loader threads queue, returns job id (-1 if queue is full)
+// NOTE: Async load jobs are counted by rl_GetLoadAsyncProgress()
+int AddLoaderJobAsync(LoaderJobCallback callback, void *userData)
+{
+    return AddLoaderJobSlot(callback, userData, true);
+}
+
+// Check if loader job has finished
+bool IsLoaderJobDone(int id)
+{
+    bool done = false;
+
+    if (!loader.ready || (id < 0)) return false;
+
+    LockLoader();
+    int slot = GetLoaderJobSlot(id);
+    done = (slot >= 0) && (loader.jobs[slot].state == LOADER_JOB_DONE);
+    UnlockLoader();
+
+    return done;
+}
+
+// Wait loader job to finish and release it, returns job userData
+void *WaitLoaderJob(int id)
+{
+    void *userData = NULL;
+
+    if (!loader.ready || (id < 0)) return NULL;
+
+    LockLoader();
+
+    int slot = GetLoaderJobSlot(id);
+
+#if defined(LOADER_THREADS)
+    // NOTE: Slot can not be released by other thread while waiting, only the job id owner releases it
+    // Queued jobs are run while waiting, a job waiting other jobs (i.e. image bands) can not block all loader threads
+    while ((slot >= 0) && ((loader.jobs[slot].state == LOADER_JOB_QUEUED) || (loader.jobs[slot].state == LOADER_JOB_RUNNING)))
+    {
+        if (loader.queueCount > 0) RunQueuedLoaderJob();
+        else
+        {
+    #if defined(_WIN32)
+            SleepConditionVariableSRW(&loader.jobDone, &loader.lock, 0xffffffff, 0);
+    #else
+            pthread_cond_wait(&loader.jobDone, &loader.lock);
+    #endif
+        }
+    }
+#endif
+
+    if ((slot >= 0) && (loader.jobs[slot].state == LOADER_JOB_DONE))
+    {
+        userData = loader.jobs[slot].userData;
+
+        // Released slot gets a new generation, keeping job ids positive
+        int generation = (loader.jobs[slot].generation + 1)%(INT_MAX/MAX_LOADER_JOBS);
+        loader.jobs[slot] = (LoaderJob){ 0 };
+        loader.jobs[slot].generation = generation;
+    }
+
+    UnlockLoader();
+
+    return userData;
+}
+
+// Get asynchronous loading progress, async load jobs done since async loading was idle (0.0f..1.0f)
+// NOTE: Internal loader jobs (image bands, screenshots, video frames, tiles...) are not counted
+float rl_GetLoadAsyncProgress(void)
+{
+    float progress = 1.0f;
+
+    if (!loader.ready) return progress;
+
+    LockLoader();
+    if (loader.jobsAdded > 0) progress = (float)loader.jobsDone/(float)loader.jobsAdded;
+    UnlockLoader();
+
+    return progress;
+}
+
+// Close loader threads, queued jobs are finished
+// NOTE: Jobs not released with WaitLoaderJob() are discarded, their userData is not freed
+void CloseLoaderThreads(void)
+{
+#if defined(LOADER_THREADS)
+    if (!loader.ready) return;
+
+    LockLoader();
+    loader.closing = true;
+    #if defined(_WIN32)
+    WakeAllConditionVariable(&loader.jobQueued);
+    #else
+    pthread_cond_broadcast(&loader.jobQueued);
+    #endif
+    UnlockLoader();
+
+    for (int i = 0; i < loader.threadCount; i++)
+    {
+    #if defined(_WIN32)
+        WaitForSingleObject(loader.threads[i], 0xffffffff);
+        CloseHandle(loader.threads[i]);
+    #else
+        pthread_join(loader.threads[i], NULL);
+    #endif
+    }
+
+    #if !defined(_WIN32)
+    pthread_cond_destroy(&loader.jobDone);
+    pthread_cond_destroy(&loader.jobQueued);
+    pthread_mutex_destroy(&loader.lock);
+    #endif
+
+    TRACELOG(LOG_INFO, "LOADER: Loader threads closed successfully");
+
+    #if defined(_WIN32)
+    AcquireSRWLockExclusive(&loaderInitLock);
+    memset(&loader, 0, sizeof(LoaderData));
+    ReleaseSRWLockExclusive(&loaderInitLock);
+    #else
+    pthread_mutex_lock(&loaderInitLock);
+    memset(&loader, 0, sizeof(LoaderData));
+    pthread_mutex_unlock(&loaderInitLock);
+    #endif
+#else
+    memset(&loader, 0, sizeof(LoaderData));
+#endif
+}
+
 #if defined(PLATFORM_ANDROID)
 // Initialize asset manager from android app
 void InitAssetManager(AAssetManager *manager, const char *dataPath)
@@ -485,6 +1289,372 @@ FILE *android_fopen(const char *fileName, const char *mode)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Compare pack entries names, used to sort pack index
+static int ComparePackEntryNames(const void *a, const void *b)
+{
+    return strcmp(*(const char **)a, *(const char **)b);
+}
+
+// Find file entry in mounted packs (last mounted first)
+static const PackEntry *FindPackEntry(const char *fileName, PackFile **pack)
+{
+    // Normalize file name: '/' separators, without './' prefix
+    char name[MAX_FILEPATH_LENGTH] = { 0 };
+    if ((fileName[0] == '.') && ((fileName[1] == '/') || (fileName[1] == '\\'))) fileName += 2;
+    for (int i = 0; (fileName[i] != '\0') && (i < MAX_FILEPATH_LENGTH - 1); i++) name[i] = (fileName[i] == '\\')? '/' : fileName[i];
+
+    for (int p = packCount - 1; p >= 0; p--)
+    {
+        int mountPathLength = (int)strlen(packs[p].mountPath);
+        if (strncmp(name, packs[p].mountPath, mountPathLength) != 0) continue;
+
+        // Binary search on sorted entries names
+        const char *entryName = name + mountPathLength;
+        int low = 0;
+        int high = packs[p].entryCount - 1;
+
+        while (low <= high)
+        {
+            int mid = low + (high - low)/2;
+            int result = strcmp(entryName, packs[p].names + packs[p].entries[mid].nameOffset);
+
+            if (result == 0)
+            {
+                *pack = &packs[p];
+                return &packs[p].entries[mid];
+            }
+            else if (result < 0) high = mid - 1;
+            else low = mid + 1;
+        }
+    }
+
+    return NULL;
+}
+
+// Load pack entry data, uncompressed
+// NOTE: extraSize bytes are allocated at the end of data, not initialized
+static unsigned char *LoadPackEntryData(PackFile *pack, const PackEntry *entry, int extraSize)
+{
+    unsigned char *data = (unsigned char *)RL_MALLOC(entry->dataSize + extraSize);
+    if (data == NULL) return NULL;
+
+    const unsigned char *packData = NULL;
+
+#if defined(FILEIO_MEMORY_MAPPING)
+    packData = pack->data + entry->offset;
+#else
+    unsigned char *packDataRead = (entry->size != entry->dataSize)? (unsigned char *)RL_MALLOC(entry->size) : data;
+
+    // NOTE: Pack file position is shared by loading threads, seek and read are done together
+    #if defined(LOADER_THREADS)
+        #if defined(_WIN32)
+    AcquireSRWLockExclusive(&packsFileLock);
+        #else
+    pthread_mutex_lock(&packsFileLock);
+        #endif
+    #endif
+    bool read = (fseek(pack->file, entry->offset, SEEK_SET) == 0) && ((entry->size == 0) || (fread(packDataRead, entry->size, 1, pack->file) == 1));
+    #if defined(LOADER_THREADS)
+        #if defined(_WIN32)
+    ReleaseSRWLockExclusive(&packsFileLock);
+        #else
+    pthread_mutex_unlock(&packsFileLock);
+        #endif
+    #endif
+
+    if (!read)
+    {
+        if (packDataRead != data) RL_FREE(packDataRead);
+        RL_FREE(data);
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read pack entry", pack->fileName);
+        return NULL;
+    }
+
+    packData = packDataRead;
+#endif
+
+    if (entry->size == entry->dataSize)
+    {
+        if (packData != data) memcpy(data, packData, entry->dataSize);
+    }
+    else
+    {
+#if defined(SUPPORT_COMPRESSION_API)
+        // Decompress directly to data, uncompressed size is known
+        int length = sinflate(data, (int)entry->dataSize, packData, (int)entry->size);
+        if (length != (int)entry->dataSize)
+#endif
+        {
+            RL_FREE(data);
+            data = NULL;
+            TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to decompress pack entry", pack->fileName);
+        }
+    }
+
+#if !defined(FILEIO_MEMORY_MAPPING)
+    if (packDataRead != data) RL_FREE(packDataRead);
+#endif
+
+    return data;
+}
+
+#if defined(FILEIO_MEMORY_MAPPING)
+// Move loaded data to an anonymous memory mapping, data is unloaded
+static unsigned char *MoveDataToMapping(unsigned char *data, int dataSize)
+{
+    unsigned char *result = NULL;
+
+    if ((data != NULL) && (dataSize > 0))
+    {
+        void *mapping = mmap(NULL, dataSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (mapping != MAP_FAILED)
+        {
+            memcpy(mapping, data, dataSize);
+            result = (unsigned char *)mapping;
+        }
+    }
+
+    RL_FREE(data);
+
+    return result;
+}
+#endif
+
+#if defined(LOADER_THREADS)
+#if defined(_WIN32)
+static unsigned long __stdcall LoaderThreadMain(void *arg) { ProcessLoaderJobs(); return 0; }
+#else
+static void *LoaderThreadMain(void *arg) { ProcessLoaderJobs(); return NULL; }
+#endif
+
+// Initialize loader threads
+// NOTE: On failure, jobs are run on the calling thread
+static void InitLoaderThreads(void)
+{
+#if !defined(_WIN32)
+    pthread_mutex_init(&loader.lock, NULL);
+    pthread_cond_init(&loader.jobQueued, NULL);
+    pthread_cond_init(&loader.jobDone, NULL);
+#endif
+
+    for (int i = 0; i < MAX_LOADER_THREADS; i++)
+    {
+#if defined(_WIN32)
+        loader.threads[i] = CreateThread(NULL, 0, LoaderThreadMain, NULL, 0, NULL);
+        if (loader.threads[i] == NULL) break;
+#else
+        if (pthread_create(&loader.threads[i], NULL, LoaderThreadMain, NULL) != 0) break;
+#endif
+        loader.threadCount++;
+    }
+
+    loader.ready = true;
+
+    if (loader.threadCount > 0) TRACELOG(LOG_INFO, "LOADER: Loader threads initialized successfully (%i threads)", loader.threadCount);
+    else TRACELOG(LOG_WARNING, "LOADER: Failed to initialize loader threads, jobs run on calling thread");
+}
+
+// Process queued jobs until loader is closed (loader thread)
+static void ProcessLoaderJobs(void)
+{
+    LockLoader();
+
+    while (true)
+    {
+        while (!loader.closing && (loader.queueCount == 0))
+        {
+#if defined(_WIN32)
+            SleepConditionVariableSRW(&loader.jobQueued, &loader.lock, 0xffffffff, 0);
+#else
+            pthread_cond_wait(&loader.jobQueued, &loader.lock);
+#endif
+        }
+
+        // NOTE: Queued jobs are finished before exiting
+        if (loader.queueCount == 0) break;
+
+        RunQueuedLoaderJob();
+    }
+
+    UnlockLoader();
+}
+
+// Run first queued job on calling thread
+// NOTE: Loader must be locked and queue not empty, lock is released while job callback runs
+static void RunQueuedLoaderJob(void)
+{
+    int slot = loader.queue[loader.queueHead];
+    loader.queueHead = (loader.queueHead + 1)%MAX_LOADER_JOBS;
+    loader.queueCount--;
+
+    LoaderJob job = loader.jobs[slot];
+    loader.jobs[slot].state = LOADER_JOB_RUNNING;
+
+    UnlockLoader();
+    job.callback(job.userData);
+    LockLoader();
+
+    loader.jobs[slot].state = LOADER_JOB_DONE;
+    if (job.async) loader.jobsDone++;
+
+#if defined(_WIN32)
+    WakeAllConditionVariable(&loader.jobDone);
+#else
+    pthread_cond_broadcast(&loader.jobDone);
+#endif
+}
+
+#endif  // LOADER_THREADS
+
+// Add job to loader threads queue, async load jobs are counted for progress
+// NOTE: Loader threads are initialized on first job added, without loader threads the job is run immediately
+static int AddLoaderJobSlot(LoaderJobCallback callback, void *userData, bool async)
+{
+    int id = -1;
+    int slot = -1;
+
+#if defined(LOADER_THREADS)
+    // NOTE: Loader is initialized once, other threads (i.e. loader jobs) could be adding first jobs at the same time
+    #if defined(_WIN32)
+    AcquireSRWLockExclusive(&loaderInitLock);
+    if (!loader.ready) InitLoaderThreads();
+    ReleaseSRWLockExclusive(&loaderInitLock);
+    #else
+    pthread_mutex_lock(&loaderInitLock);
+    if (!loader.ready) InitLoaderThreads();
+    pthread_mutex_unlock(&loaderInitLock);
+    #endif
+#else
+    loader.ready = true;
+#endif
+    LockLoader();
+
+    for (int i = 0; i < MAX_LOADER_JOBS; i++)
+    {
+        if (loader.jobs[i].state == LOADER_JOB_FREE)
+        {
+            slot = i;
+            break;
+        }
+    }
+
+    if (slot >= 0)
+    {
+        id = loader.jobs[slot].generation*MAX_LOADER_JOBS + slot;
+
+        loader.jobs[slot].callback = callback;
+        loader.jobs[slot].userData = userData;
+        loader.jobs[slot].async = async;
+
+        if (async)
+        {
+            // Progress is restarted when all previous async load jobs are done
+            if (loader.jobsDone == loader.jobsAdded)
+            {
+                loader.jobsAdded = 0;
+                loader.jobsDone = 0;
+            }
+
+            loader.jobsAdded++;
+        }
+
+        if (loader.threadCount > 0)
+        {
+            loader.jobs[slot].state = LOADER_JOB_QUEUED;
+            loader.queue[(loader.queueHead + loader.queueCount)%MAX_LOADER_JOBS] = slot;
+            loader.queueCount++;
+#if defined(LOADER_THREADS)
+    #if defined(_WIN32)
+            WakeAllConditionVariable(&loader.jobQueued);
+    #else
+            pthread_cond_signal(&loader.jobQueued);
+    #endif
+#endif
+        }
+        else
+        {
+            loader.jobs[slot].state = LOADER_JOB_RUNNING;
+
+            UnlockLoader();
+            callback(userData);
+            LockLoader();
+
+            loader.jobs[slot].state = LOADER_JOB_DONE;
+            if (async) loader.jobsDone++;
+        }
+    }
+    else TRACELOG(LOG_WARNING, "LOADER: Failed to add job, max loader jobs pending reached (%i)", MAX_LOADER_JOBS);
+
+    UnlockLoader();
+
+    return id;
+}
+
+// Get loader job slot from job id, -1 if job id was already released
+// NOTE: Loader must be locked
+static int GetLoaderJobSlot(int id)
+{
+    int slot = id%MAX_LOADER_JOBS;
+
+    if ((loader.jobs[slot].state == LOADER_JOB_FREE) || (loader.jobs[slot].generation != id/MAX_LOADER_JOBS)) slot = -1;
+
+    return slot;
+}
+
+// Lock loader jobs
+static void LockLoader(void)
+{
+#if defined(LOADER_THREADS)
+    #if defined(_WIN32)
+    AcquireSRWLockExclusive(&loader.lock);
+    #else
+    pthread_mutex_lock(&loader.lock);
+    #endif
+#endif
+}
+
+// Unlock loader jobs
+static void UnlockLoader(void)
+{
+#if defined(LOADER_THREADS)
+    #if defined(_WIN32)
+    ReleaseSRWLockExclusive(&loader.lock);
+    #else
+    pthread_mutex_unlock(&loader.lock);
+    #endif
+#endif
+}
+
+// Lock mounted packs
+// NOTE: Shared lock to find and load entries, exclusive lock to mount and unmount packs
+static void LockPacks(bool exclusive)
+{
+#if defined(LOADER_THREADS)
+    #if defined(_WIN32)
+    if (exclusive) AcquireSRWLockExclusive(&packsLock);
+    else AcquireSRWLockShared(&packsLock);
+    #else
+    if (exclusive) pthread_rwlock_wrlock(&packsLock);
+    else pthread_rwlock_rdlock(&packsLock);
+    #endif
+#endif
+}
+
+// Unlock mounted packs
+static void UnlockPacks(bool exclusive)
+{
+#if defined(LOADER_THREADS)
+    #if defined(_WIN32)
+    if (exclusive) ReleaseSRWLockExclusive(&packsLock);
+    else ReleaseSRWLockShared(&packsLock);
+    #else
+    (void)exclusive;
+    pthread_rwlock_unlock(&packsLock);
+    #endif
+#endif
+}
+
 #if defined(PLATFORM_ANDROID)
 static int android_read(void *cookie, char *data, int dataSize)
 {
@@ -69,6 +69,24 @@
 extern "C" {            // Prevents name mangling of functions
 #endif
 
+bool IsFileInPacks(const char *fileName);                              // Check if file is available in mounted pack files
+
+// File data ranges, using standard file io (custom file callbacks and pack files are not used)
+// NOTE: Every call opens its own file handle, ranges can be loaded from loader threads jobs
+long long GetFileDataLength(const char *fileName);                                               // Get file length in bytes (64bit), returns 0 if file can not be opened
+bool LoadFileDataRange(const char *fileName, long long offset, void *data, int dataSize);        // Load file data range into buffer, returns true on success
+bool SaveFileDataRange(const char *fileName, long long offset, const void *data, int dataSize);  // Save data range into file (file created on offset 0), returns true on success
+
+// Loader threads jobs, callback is run on a loader thread (or calling thread if not supported)
+// NOTE: Jobs callbacks must be thread-safe, they should not use static buffers (i.e. rl_TextFormat())
+// Jobs can wait other jobs, WaitLoaderJob() runs queued jobs while waiting
+typedef void (*LoaderJobCallback)(void *userData);                     // Loader job callback
+int AddLoaderJob(LoaderJobCallback callback, void *userData);          // Add job to loader threads queue, returns job id (-1 if queue is full)
+int AddLoaderJobAsync(LoaderJobCallback callback, void *userData);     // Add async load job to loader threads queue, counted by rl_GetLoadAsyncProgress()
+bool IsLoaderJobDone(int id);                                          // Check if loader job has finished (false if job id was already released)
+void *WaitLoaderJob(int id);                                           // Wait loader job to finish and release it, returns job userData
+void CloseLoaderThreads(void);                                         // Close loader threads, queued jobs are finished
+
 #if defined(PLATFORM_ANDROID)
 void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initialize asset manager from android app
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!